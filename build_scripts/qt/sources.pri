@@ -10,18 +10,31 @@ SOURCES += src/main.cpp\
     src/tabcontrollers/UtilitiesTabController.cpp \
     src/tabcontrollers/VideoTabController.cpp \
     src/utils/ChaperoneUtils.cpp \
+    src/utils/ChaperoneGeometryBlob.cpp \
+    src/utils/HapticScheduler.cpp \
+    src/utils/TaskScheduler.cpp \
+    src/utils/VRSettingsCache.cpp \
+    src/utils/OpenVRSettingsBackend.cpp \
     src/openvr/openvr_init.cpp \
     src/openvr/ivrinput.cpp \
     src/utils/setup.cpp \
     src/utils/paths.cpp \
     src/utils/FrameRateUtils.cpp \
+    src/utils/StartupProfiler.cpp \
     src/keyboard_input/keyboard_input.cpp \
     src/keyboard_input/input_parser.cpp \
+    src/keyboard_input/input_sender.cpp \
+    src/keyboard_input/keyboard_macro.cpp \
+    src/keyboard_input/macro_executor.cpp \
     src/settings/settings.cpp \
     src/settings/settings_object.cpp \
+    src/settings/profile_list_model.cpp \
+    src/settings/profile_collection.cpp \
+    src/settings/settings_snapshot.cpp \
 
 
 HEADERS += src/overlaycontroller.h \
+    src/application_strings.h \
     src/tabcontrollers/AudioTabController.h \
     src/tabcontrollers/ChaperoneTabController.h \
     src/tabcontrollers/FixFloorTabController.h \
@@ -34,8 +47,14 @@ HEADERS += src/overlaycontroller.h \
     src/tabcontrollers/audiomanager/AudioManager.h \
     src/keyboard_input/keyboard_input.h \
     src/media_keys/media_keys.h \
+    src/media_keys/now_playing.h \
     src/utils/Matrix.h \
     src/utils/ChaperoneUtils.h \
+    src/utils/ChaperoneRetryBackoff.h \
+    src/utils/ChaperoneGeometryBlob.h \
+    src/utils/HapticScheduler.h \
+    src/utils/TaskScheduler.h \
+    src/utils/VRSettingsCache.h \
     src/quaternion/quaternion.h \
     src/tabcontrollers/audiomanager/AudioManagerDummy.h \
     src/openvr/openvr_init.h \
@@ -47,14 +66,27 @@ HEADERS += src/overlaycontroller.h \
     src/utils/setup.h \
     src/utils/paths.h \
     src/utils/FrameRateUtils.h \
+    src/utils/StartupProfiler.h \
     src/keyboard_input/input_parser.h \
     src/keyboard_input/input_sender.h \
+    src/keyboard_input/keyboard_macro.h \
+    src/keyboard_input/macro_executor.h \
     src/settings/settings.h \
+    src/settings/setting_definitions.h \
     src/settings/internal/setting_value.h \
     src/settings/internal/settings_internal.h \
     src/settings/internal/settings_controller.h \
     src/settings/internal/specific_setting_value.h \
+    src/settings/internal/dirty_settings.h \
+    src/settings/internal/settings_persister.h \
+    src/settings/internal/setting_subscriptions.h \
+    src/settings/internal/ini_group_hashes.h \
+    src/settings/internal/settings_file_watcher.h \
     src/settings/settings_object.h \
+    src/settings/profile_store.h \
+    src/settings/profile_list_model.h \
+    src/settings/profile_collection.h \
+    src/settings/settings_snapshot.h \
     src/settings/internal/settings_object_data.h
 
 win32 {
@@ -65,20 +97,28 @@ win32 {
 }
 
 unix:!macx {
+    SOURCES += src/keyboard_input/input_sender_linux.cpp \
+        src/keyboard_input/input_session_uinput.cpp
+    HEADERS += src/keyboard_input/input_session_uinput.h \
+        src/keyboard_input/evdev_keycodes.h
+
     !noX11 {
         message(X11 features enabled.)
-        SOURCES += src/keyboard_input/input_sender_X11.cpp
+        SOURCES += src/keyboard_input/input_session_X11.cpp
+        HEADERS += src/keyboard_input/input_session_X11.h
         CONFIG += x11
         LIBS += -lXtst
     }
     else {
         message(X11 features disabled.)
-        SOURCES += src/keyboard_input/input_sender_dummy.cpp
+        DEFINES += NO_X11
     }
 
     !noDBUS {
         message(DBUS features enabled.)
-        SOURCES += src/media_keys/media_keys_dbus.cpp
+        SOURCES += src/media_keys/media_keys_dbus.cpp \
+            src/media_keys/mpris_player_registry.cpp
+        HEADERS += src/media_keys/mpris_player_registry.h
         QT += dbus
     }
     else {
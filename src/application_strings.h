@@ -0,0 +1,15 @@
+#pragma once
+
+namespace application_strings
+{
+constexpr auto applicationOrganizationName = "AdvancedSettings-Team";
+constexpr auto applicationName = "OVR Advanced Settings";
+constexpr const char* applicationKey = "steam.overlay.1009850";
+constexpr const char* applicationDisplayName = "OVR Advanced Settings";
+constexpr const char* versionCheckUrl
+    = "https://raw.githubusercontent.com/OpenVR-Advanced-Settings/"
+      "OpenVR-AdvancedSettings/master/ver/versioncheck.json";
+
+constexpr const char* applicationVersionString = APPLICATION_VERSION;
+
+} // namespace application_strings
@@ -0,0 +1,103 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include "input_parser.h"
+
+/*!
+   \brief Linux input event codes of the keys.
+
+   The values are the KEY_* codes of <linux/input-event-codes.h>, which are
+   part of the kernel ABI. That header can't be used here: several of its
+   macros have the same names as \c Token values, include it after this
+   file and don't name those values below it.
+ */
+namespace evdev
+{
+constexpr std::size_t k_tokenCount
+    = static_cast<std::size_t>( Token::MODIFIER_TILDE ) + 1;
+
+constexpr std::array<unsigned short, k_tokenCount> makeKeycodes() noexcept
+{
+    std::array<unsigned short, k_tokenCount> codes{};
+    const auto set = [&codes]( const Token token, const unsigned short code ) {
+        codes[static_cast<std::size_t>( token )] = code;
+    };
+    // Consecutive keys of a keyboard row have consecutive codes.
+    const auto setRow = [&codes]( const std::string_view keys,
+                                  unsigned short code ) {
+        for ( const auto key : keys )
+        {
+            codes[static_cast<unsigned char>( key )] = code++;
+        }
+    };
+
+    set( Token::KEY_ESC, 1 );
+    setRow( "1234567890", 2 );
+    set( Token::KEY_MINUS, 12 );
+    set( Token::KEY_EQUALS, 13 );
+    set( Token::KEY_BACKSPACE, 14 );
+    set( Token::KEY_TAB, 15 );
+    setRow( "qwertyuiop", 16 );
+    set( Token::KEY_LEFTBRACKET, 26 );
+    set( Token::KEY_RIGHTBRACKET, 27 );
+    set( Token::KEY_ENTER, 28 );
+    set( Token::MODIFIER_CTRL, 29 );
+    setRow( "asdfghjkl", 30 );
+    set( Token::KEY_SEMICOLON, 39 );
+    set( Token::KEY_APOSTROPHE, 40 );
+    set( Token::MODIFIER_TILDE, 41 );
+    set( Token::MODIFIER_SHIFT, 42 );
+    set( Token::KEY_BACKSLASH, 43 );
+    setRow( "zxcvbnm", 44 );
+    set( Token::KEY_COMMA, 51 );
+    set( Token::KEY_PERIOD, 52 );
+    set( Token::KEY_SLASH, 53 );
+    set( Token::MODIFIER_RSHIFT, 54 );
+    set( Token::KEY_KPSTAR, 55 );
+    set( Token::MODIFIER_ALT, 56 );
+    set( Token::KEY_SPACE, 57 );
+    set( Token::KEY_CAPS, 58 );
+
+    set( Token::KEY_F1, 59 );
+    set( Token::KEY_F2, 60 );
+    set( Token::KEY_F3, 61 );
+    set( Token::KEY_F4, 62 );
+    set( Token::KEY_F5, 63 );
+    set( Token::KEY_F6, 64 );
+    set( Token::KEY_F7, 65 );
+    set( Token::KEY_F8, 66 );
+    set( Token::KEY_F9, 67 );
+
+    set( Token::KEY_SCRLOCK, 70 );
+    set( Token::KEY_KPMINUS, 74 );
+    set( Token::KEY_KPPLUS, 78 );
+    set( Token::KEY_KPSLASH, 98 );
+    set( Token::KEY_PRNSCRN, 99 );
+    set( Token::KEY_UPARROW, 103 );
+    set( Token::KEY_PGUP, 104 );
+    set( Token::KEY_LEFTARROW, 105 );
+    set( Token::KEY_RIGHTARROW, 106 );
+    set( Token::KEY_END, 107 );
+    set( Token::KEY_DOWNARROW, 108 );
+    set( Token::KEY_PGDN, 109 );
+    set( Token::KEY_INS, 110 );
+    set( Token::KEY_DEL, 111 );
+    set( Token::KEY_PAUSE, 119 );
+    set( Token::MODIFIER_SUPER, 125 );
+
+    return codes;
+}
+
+constexpr auto k_keycodes = makeKeycodes();
+
+/*!
+   \brief Code \a token is sent as, 0 if it has none.
+ */
+constexpr unsigned short keycode( const Token token ) noexcept
+{
+    const auto index = static_cast<std::size_t>( token );
+    return index < k_keycodes.size() ? k_keycodes[index] : 0;
+}
+
+} // namespace evdev
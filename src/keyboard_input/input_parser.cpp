@@ -1,223 +1,198 @@
 #include "input_parser.h"
+#include <array>
+#include <string_view>
 
-std::optional<Token> getModifier( const char& character ) noexcept
+namespace
 {
-    switch ( character )
+struct NamedKey
+{
+    std::string_view name;
+    Token token;
+};
+
+// Sorted by name, so keys sharing a prefix are next to each other and the
+// lexer can narrow the candidates one character at a time.
+constexpr std::array<NamedKey, 31> k_namedKeys = { {
+    { "BACKSPACE", Token::KEY_BACKSPACE },
+    { "CAPS", Token::KEY_CAPS },
+    { "DEL", Token::KEY_DEL },
+    { "DOWNARROW", Token::KEY_DOWNARROW },
+    { "END", Token::KEY_END },
+    { "ENTER", Token::KEY_ENTER },
+    { "ESC", Token::KEY_ESC },
+    { "F1", Token::KEY_F1 },
+    { "F2", Token::KEY_F2 },
+    { "F3", Token::KEY_F3 },
+    { "F4", Token::KEY_F4 },
+    { "F5", Token::KEY_F5 },
+    { "F6", Token::KEY_F6 },
+    { "F7", Token::KEY_F7 },
+    { "F8", Token::KEY_F8 },
+    { "F9", Token::KEY_F9 },
+    { "INS", Token::KEY_INS },
+    { "KPMINUS", Token::KEY_KPMINUS },
+    { "KPPLUS", Token::KEY_KPPLUS },
+    { "KPSLASH", Token::KEY_KPSLASH },
+    { "KPSTAR", Token::KEY_KPSTAR },
+    { "LEFTARROW", Token::KEY_LEFTARROW },
+    { "PAUSE", Token::KEY_PAUSE },
+    { "PGDN", Token::KEY_PGDN },
+    { "PGUP", Token::KEY_PGUP },
+    { "PRNSCRN", Token::KEY_PRNSCRN },
+    { "RIGHTARROW", Token::KEY_RIGHTARROW },
+    { "SCRLOCK", Token::KEY_SCRLOCK },
+    { "SPACE", Token::KEY_SPACE },
+    { "TAB", Token::KEY_TAB },
+    { "UPARROW", Token::KEY_UPARROW },
+} };
+
+constexpr bool namedKeysSortedWithoutPrefixes() noexcept
+{
+    for ( std::size_t i = 1; i < k_namedKeys.size(); ++i )
     {
-    case '^':
-        return Token::MODIFIER_CTRL;
-    case '*':
-        return Token::MODIFIER_ALT;
-    case '>':
-        return Token::MODIFIER_SHIFT;
-    case '#':
-        return Token::MODIFIER_SUPER;
-    default:
-        return std::nullopt;
+        const auto previous = k_namedKeys[i - 1].name;
+        const auto current = k_namedKeys[i].name;
+        if ( !( previous < current )
+             || current.substr( 0, previous.size() ) == previous )
+        {
+            return false;
+        }
     }
+    return true;
 }
 
-std::optional<Token> getNumberOrLetter( const char& character ) noexcept
+// A key name that is the prefix of another would end the match early.
+static_assert( namedKeysSortedWithoutPrefixes(),
+               "Key names must be sorted and none may prefix another." );
+
+struct NamedKeyMatch
+{
+    Token token;
+    std::size_t length;
+};
+
+/*!
+   \brief Walks the sorted key names like a trie, returns the key name
+   \a input starts with.
+ */
+constexpr std::optional<NamedKeyMatch>
+    matchNamedKey( const std::string_view input ) noexcept
 {
-    if ( islower( character ) || isdigit( character ) )
+    std::size_t first = 0;
+    std::size_t last = k_namedKeys.size();
+    for ( std::size_t depth = 0; depth < input.size(); ++depth )
     {
-        return static_cast<Token>( character );
+        const auto c = input[depth];
+        // Every candidate is longer than depth, shorter ones already matched.
+        while ( first < last && k_namedKeys[first].name[depth] < c )
+        {
+            ++first;
+        }
+        while ( first < last && k_namedKeys[last - 1].name[depth] > c )
+        {
+            --last;
+        }
+        if ( first == last )
+        {
+            return std::nullopt;
+        }
+        if ( k_namedKeys[first].name.size() == depth + 1 )
+        {
+            return NamedKeyMatch{ k_namedKeys[first].token, depth + 1 };
+        }
     }
     return std::nullopt;
 }
 
-std::optional<Token> getFunctionNumber( const char& character ) noexcept
-{
-    switch ( character )
-    {
-    case '1':
-        return Token::KEY_F1;
-    case '2':
-        return Token::KEY_F2;
-    case '3':
-        return Token::KEY_F3;
-    case '4':
-        return Token::KEY_F4;
-    case '5':
-        return Token::KEY_F5;
-    case '6':
-        return Token::KEY_F6;
-    case '7':
-        return Token::KEY_F7;
-    case '8':
-        return Token::KEY_F8;
-    case '9':
-        return Token::KEY_F9;
+static_assert( matchNamedKey( "TAB" )->token == Token::KEY_TAB );
+static_assert( matchNamedKey( "F9a" )->length == 2 );
+static_assert( !matchNamedKey( "F0" ) );
+static_assert( !matchNamedKey( "BACKSPAC" ) );
 
-    default:
-        LOG( INFO ) << "Unknown function key number: " << character;
-        return std::nullopt;
-    }
-}
+enum class CharacterKind : unsigned char
+{
+    Unknown,
+    // Lower case letters, digits and modifiers, a token of their own.
+    Single,
+    Space,
+    // Upper case letters, the start of a key name.
+    Named,
+};
+
+struct CharacterClass
+{
+    CharacterKind kind = CharacterKind::Unknown;
+    Token token = Token::TOKEN_NEW_SEQUENCE;
+};
 
-std::optional<Token> checkIfLegalCapitalLiteral( std::string input ) noexcept
+constexpr std::array<CharacterClass, 256> makeCharacterClasses() noexcept
 {
-    // C++ can't do string comparisons in switches. :(
-    if ( input == "BACKSPACE" )
-    {
-        return Token::KEY_BACKSPACE;
-    }
-    if ( input == "SPACE" )
-    {
-        return Token::KEY_SPACE;
-    }
-    if ( input == "TAB" )
-    {
-        return Token::KEY_TAB;
-    }
-    if ( input == "ESC" )
-    {
-        return Token::KEY_ESC;
-    }
-    if ( input == "INS" )
-    {
-        return Token::KEY_INS;
-    }
-    if ( input == "DEL" )
-    {
-        return Token::KEY_DEL;
-    }
-    if ( input == "END" )
-    {
-        return Token::KEY_END;
-    }
-    if ( input == "PGDN" )
-    {
-        return Token::KEY_PGDN;
-    }
-    if ( input == "PGUP" )
-    {
-        return Token::KEY_PGUP;
-    }
-    if ( input == "CAPS" )
-    {
-        return Token::KEY_CAPS;
-    }
-    if ( input == "PRNSCRN" )
-    {
-        return Token::KEY_PRNSCRN;
-    }
-    if ( input == "PAUSE" )
-    {
-        return Token::KEY_PAUSE;
-    }
-    if ( input == "SCRLOCK" )
-    {
-        return Token::KEY_SCRLOCK;
-    }
-    if ( input == "LEFTARROW" )
-    {
-        return Token::KEY_LEFTARROW;
-    }
-    if ( input == "RIGHTARROW" )
+    std::array<CharacterClass, 256> classes{};
+    for ( char c = 'a'; c <= 'z'; ++c )
     {
-        return Token::KEY_RIGHTARROW;
+        classes[static_cast<unsigned char>( c )]
+            = { CharacterKind::Single, static_cast<Token>( c ) };
     }
-    if ( input == "UPARROW" )
+    for ( char c = '0'; c <= '9'; ++c )
     {
-        return Token::KEY_UPARROW;
+        classes[static_cast<unsigned char>( c )]
+            = { CharacterKind::Single, static_cast<Token>( c ) };
     }
-    if ( input == "DOWNARROW" )
+    for ( char c = 'A'; c <= 'Z'; ++c )
     {
-        return Token::KEY_DOWNARROW;
+        classes[static_cast<unsigned char>( c )].kind = CharacterKind::Named;
     }
-    if ( input == "KPSLASH" )
+    for ( const auto c : { ' ', '\t', '\n', '\v', '\f', '\r' } )
     {
-        return Token::KEY_KPSLASH;
+        classes[static_cast<unsigned char>( c )].kind = CharacterKind::Space;
     }
-    if ( input == "KPSTAR" )
-    {
-        return Token::KEY_KPSTAR;
-    }
-    if ( input == "KPMINUS" )
-    {
-        return Token::KEY_KPMINUS;
-    }
-    if ( input == "KPPLUS" )
-    {
-        return Token::KEY_KPPLUS;
-    }
-    if ( input == "ENTER" )
-    {
-        return Token::KEY_ENTER;
-    }
-
-    return std::nullopt;
+    classes['^'] = { CharacterKind::Single, Token::MODIFIER_CTRL };
+    classes['*'] = { CharacterKind::Single, Token::MODIFIER_ALT };
+    classes['>'] = { CharacterKind::Single, Token::MODIFIER_SHIFT };
+    classes['#'] = { CharacterKind::Single, Token::MODIFIER_SUPER };
+    return classes;
 }
 
+constexpr auto k_characterClasses = makeCharacterClasses();
+
+} // namespace
+
 std::vector<Token>
-    ParseKeyboardInputsToTokens( const std::string inputs ) noexcept
+    ParseKeyboardInputsToTokens( const std::string& inputs ) noexcept
 {
     std::vector<Token> tokens{};
+    tokens.reserve( inputs.size() );
 
-    for ( auto ch = inputs.begin(), end = inputs.end(); ch != end; ++ch )
+    const std::string_view input = inputs;
+    for ( std::size_t i = 0; i < input.size(); ++i )
     {
-        if ( const auto c = getNumberOrLetter( *ch ); c.has_value() )
+        const auto& c
+            = k_characterClasses[static_cast<unsigned char>( input[i] )];
+        switch ( c.kind )
         {
-            tokens.push_back( *c );
-            continue;
-        }
-        if ( const auto c = getModifier( *ch ); c.has_value() )
-        {
-            tokens.push_back( *c );
-            continue;
-        }
+        case CharacterKind::Single:
+            tokens.push_back( c.token );
+            break;
 
-        if ( isspace( *ch ) )
-        {
+        case CharacterKind::Space:
             tokens.push_back( Token::TOKEN_NEW_SEQUENCE );
-        }
-
-        if ( !isupper( *ch ) || isspace( *ch ) )
-        {
-            LOG( INFO ) << "Unknown character found in sequence: " << *ch;
-            continue;
-        }
-        // Everything below is upper case
-
-        if ( *ch == 'F' )
-        {
-            ++ch;
-            if ( ch == end )
-            {
-                break;
-            }
-            const auto token = getFunctionNumber( *ch );
-            if ( token.has_value() )
-            {
-                tokens.push_back( *token );
-                continue;
-            }
-            else
-            {
-                // Spec says to abort on errors and submit correct values before
-                // error.
-                break;
-            }
-        }
+            break;
 
-        std::string characters;
-        characters.push_back( *ch );
-        while ( ch + 1 != end )
-        {
-            ++ch;
-            characters.push_back( *ch );
-            if ( auto c = checkIfLegalCapitalLiteral( characters );
-                 c.has_value() )
+        case CharacterKind::Named:
+            if ( const auto key = matchNamedKey( input.substr( i ) ) )
             {
-                tokens.push_back( *c );
-                characters.clear();
-                // break out of the while
+                tokens.push_back( key->token );
+                i += key->length - 1;
                 break;
             }
-        }
-        if ( ch == end )
-        {
+            // Spec says to abort on errors and submit correct values before
+            // error.
+            LOG( INFO ) << "Unknown key name in sequence: "
+                        << input.substr( i );
+            return tokens;
+
+        case CharacterKind::Unknown:
+            LOG( INFO ) << "Unknown character found in sequence: " << input[i];
             break;
         }
     }
@@ -474,6 +449,27 @@ bool isLiteral( const Token token ) noexcept
     case Token::KEY_ENTER:
         return true;
 
+    case Token::KEY_MINUS:
+        return true;
+    case Token::KEY_EQUALS:
+        return true;
+    case Token::KEY_LEFTBRACKET:
+        return true;
+    case Token::KEY_RIGHTBRACKET:
+        return true;
+    case Token::KEY_BACKSLASH:
+        return true;
+    case Token::KEY_SEMICOLON:
+        return true;
+    case Token::KEY_APOSTROPHE:
+        return true;
+    case Token::KEY_COMMA:
+        return true;
+    case Token::KEY_PERIOD:
+        return true;
+    case Token::KEY_SLASH:
+        return true;
+
     default:
         return false;
     }
@@ -79,6 +79,19 @@ enum class Token
     KEY_KPPLUS,
     KEY_ENTER,
 
+    // Symbols, only typed through quoted text. The values up to here are
+    // full, the following tokens come after the letters.
+    KEY_MINUS = 'z' + 1,
+    KEY_EQUALS,
+    KEY_LEFTBRACKET,
+    KEY_RIGHTBRACKET,
+    KEY_BACKSLASH,
+    KEY_SEMICOLON,
+    KEY_APOSTROPHE,
+    KEY_COMMA,
+    KEY_PERIOD,
+    KEY_SLASH,
+
     // Misc tokens
     TOKEN_NEW_SEQUENCE,
     TOKEN_NO_KEYUP_NEXT,
@@ -92,8 +105,11 @@ enum class Token
     MODIFIER_TILDE,
 };
 
+static_assert( static_cast<int>( Token::KEY_ENTER ) < 'a',
+               "Tokens must not share values with the letter keys." );
+
 std::vector<Token>
-    ParseKeyboardInputsToTokens( const std::string inputs ) noexcept;
+    ParseKeyboardInputsToTokens( const std::string& inputs ) noexcept;
 std::vector<Token>
     removeIncorrectTokens( const std::vector<Token>& tokens ) noexcept;
 
@@ -0,0 +1,55 @@
+#include "input_sender.h"
+
+std::vector<KeyEvent> toKeyEvents( const std::vector<Token>& tokens )
+{
+    std::vector<KeyEvent> events = {};
+    events.reserve( tokens.size() * 2 );
+
+    std::vector<Token> heldInputs = {};
+    bool noKeyUp = false;
+    for ( const auto& token : tokens )
+    {
+        if ( token == Token::TOKEN_NO_KEYUP_NEXT )
+        {
+            noKeyUp = true;
+            continue;
+        }
+
+        if ( isModifier( token ) )
+        {
+            events.push_back( { token, KeyStatus::Down } );
+            if ( !noKeyUp )
+            {
+                heldInputs.push_back( token );
+            }
+            continue;
+        }
+
+        if ( token == Token::TOKEN_NEW_SEQUENCE )
+        {
+            for ( const auto& h : heldInputs )
+            {
+                events.push_back( { h, KeyStatus::Up } );
+            }
+            heldInputs.clear();
+            continue;
+        }
+
+        if ( isLiteral( token ) )
+        {
+            events.push_back( { token, KeyStatus::Down } );
+            if ( !noKeyUp )
+            {
+                events.push_back( { token, KeyStatus::Up } );
+            }
+            continue;
+        }
+    }
+
+    for ( const auto& h : heldInputs )
+    {
+        events.push_back( { h, KeyStatus::Up } );
+    }
+
+    return events;
+}
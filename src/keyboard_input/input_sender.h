@@ -8,7 +8,35 @@ enum class KeyStatus
     Down,
 };
 
-void sendTokensAsInput( const std::vector<Token> tokens );
+struct KeyEvent
+{
+    Token token;
+    KeyStatus status;
+
+    bool operator==( const KeyEvent& other ) const noexcept
+    {
+        return token == other.token && status == other.status;
+    }
+};
+
+/*!
+   \brief Presses and releases that \a tokens stand for.
+
+   Modifiers stay pressed until the end of their sequence. After
+   \c TOKEN_NO_KEYUP_NEXT keys are only pressed.
+ */
+std::vector<KeyEvent> toKeyEvents( const std::vector<Token>& tokens );
+
+/*!
+   \brief Sends \a events in order, as one batch. Implemented by each
+   platform.
+ */
+void sendKeyEvents( const std::vector<KeyEvent>& events );
+
+inline void sendTokensAsInput( const std::vector<Token> tokens )
+{
+    sendKeyEvents( toKeyEvents( tokens ) );
+}
 
 inline void sendStringAsInput( const std::string input )
 {
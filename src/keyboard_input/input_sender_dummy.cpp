@@ -1,6 +1,6 @@
 #include "input_sender.h"
 
-void sendTokensAsInput( [[maybe_unused]] const std::vector<Token> tokens )
+void sendKeyEvents( [[maybe_unused]] const std::vector<KeyEvent>& events )
 {
     // dummy
 }
@@ -0,0 +1,95 @@
+#include "input_sender.h"
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include "input_session_uinput.h"
+#ifndef NO_X11
+#    include "input_session_X11.h"
+#endif
+
+namespace
+{
+bool isWaylandSession()
+{
+    const auto sessionType = std::getenv( "XDG_SESSION_TYPE" );
+    return std::getenv( "WAYLAND_DISPLAY" ) != nullptr
+           || ( sessionType && std::strcmp( sessionType, "wayland" ) == 0 );
+}
+
+/*!
+   \brief Picks the keyboard backend when it is first used.
+
+   XTest needs no permissions but only reaches X11 clients. uinput reaches
+   every client but needs write access to /dev/uinput. Wayland sessions try
+   uinput first, X11 sessions XTest, and each falls back to the other.
+ */
+class LinuxInputSender
+{
+public:
+    LinuxInputSender()
+    {
+        const auto opened = isWaylandSession() ? openUinput() || openX11()
+                                               : openX11() || openUinput();
+        if ( !opened )
+        {
+            LOG( ERROR ) << "No keyboard input backend available.";
+        }
+    }
+
+    void send( const std::vector<KeyEvent>& events )
+    {
+        if ( m_uinput )
+        {
+            m_uinput->send( events );
+        }
+#ifndef NO_X11
+        else if ( m_x11 )
+        {
+            m_x11->send( events );
+        }
+#endif
+    }
+
+private:
+    bool openUinput()
+    {
+        auto session = std::make_unique<UinputInputSession>();
+        if ( !session->isOpen() )
+        {
+            return false;
+        }
+        LOG( INFO ) << "Sending keyboard input through uinput.";
+        m_uinput = std::move( session );
+        return true;
+    }
+
+    bool openX11()
+    {
+#ifndef NO_X11
+        auto session = std::make_unique<X11InputSession>();
+        if ( !session->isOpen() )
+        {
+            return false;
+        }
+        LOG( INFO ) << "Sending keyboard input through XTest.";
+        m_x11 = std::move( session );
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    std::unique_ptr<UinputInputSession> m_uinput;
+#ifndef NO_X11
+    std::unique_ptr<X11InputSession> m_x11;
+#endif
+};
+
+} // namespace
+
+void sendKeyEvents( const std::vector<KeyEvent>& events )
+{
+    // Opened on first use and kept for the lifetime of the application.
+    static LinuxInputSender sender;
+    sender.send( events );
+}
@@ -76,6 +76,28 @@ WORD convertToVirtualKeycode( const Token token )
     case Token::KEY_ENTER:
         return VK_RETURN;
 
+    // Keys of the US layout, other layouts have other symbols on them.
+    case Token::KEY_MINUS:
+        return VK_OEM_MINUS;
+    case Token::KEY_EQUALS:
+        return VK_OEM_PLUS;
+    case Token::KEY_LEFTBRACKET:
+        return VK_OEM_4;
+    case Token::KEY_RIGHTBRACKET:
+        return VK_OEM_6;
+    case Token::KEY_BACKSLASH:
+        return VK_OEM_5;
+    case Token::KEY_SEMICOLON:
+        return VK_OEM_1;
+    case Token::KEY_APOSTROPHE:
+        return VK_OEM_7;
+    case Token::KEY_COMMA:
+        return VK_OEM_COMMA;
+    case Token::KEY_PERIOD:
+        return VK_OEM_PERIOD;
+    case Token::KEY_SLASH:
+        return VK_OEM_2;
+
     case Token::MODIFIER_CTRL:
         return VK_CONTROL;
     case Token::MODIFIER_ALT:
@@ -163,68 +185,15 @@ void sendKeyboardInputRaw( std::vector<INPUT> inputs )
     }
 }
 
-void sendTokensAsInput( const std::vector<Token> tokens )
+void sendKeyEvents( const std::vector<KeyEvent>& events )
 {
     std::vector<INPUT> inputs = {};
-    std::vector<Token> heldInputs = {};
-    bool noKeyUp = false;
-    for ( const auto& token : tokens )
+    inputs.reserve( events.size() );
+    for ( const auto& e : events )
     {
-        if ( token == Token::TOKEN_NO_KEYUP_NEXT )
-        {
-            noKeyUp = true;
-            continue;
-        }
-
-        if ( isModifier( token ) )
-        {
-            inputs.push_back( createInputStruct(
-                convertToVirtualKeycode( token ), KeyStatus::Down ) );
-            if ( !noKeyUp )
-            {
-                heldInputs.push_back( token );
-            }
-            continue;
-        }
-
-        if ( token == Token::TOKEN_NEW_SEQUENCE )
-        {
-            for ( const auto& h : heldInputs )
-            {
-                inputs.push_back( createInputStruct(
-                    convertToVirtualKeycode( h ), KeyStatus::Up ) );
-            }
-            heldInputs.clear();
-            continue;
-        }
-
-        if ( isLiteral( token ) )
-        {
-            inputs.push_back( createInputStruct(
-                convertToVirtualKeycode( token ), KeyStatus::Down ) );
-            if ( !noKeyUp )
-            {
-                inputs.push_back( createInputStruct(
-                    convertToVirtualKeycode( token ), KeyStatus::Up ) );
-            }
-            continue;
-        }
-        if ( token != Token::TOKEN_NO_KEYUP_NEXT )
-        {
-            noKeyUp = false;
-            continue;
-        }
-    }
-
-    if ( !heldInputs.empty() )
-    {
-        for ( const auto& h : heldInputs )
-        {
-            inputs.push_back( createInputStruct( convertToVirtualKeycode( h ),
-                                                 KeyStatus::Up ) );
-        }
+        inputs.push_back(
+            createInputStruct( convertToVirtualKeycode( e.token ), e.status ) );
     }
 
     sendKeyboardInputRaw( inputs );
-    // send inputs
 }
@@ -1,8 +1,9 @@
-#include "input_sender.h"
-#include <X11/Xlib.h>
-#include <X11/Intrinsic.h>
+#include "input_session_X11.h"
+#include <X11/keysym.h>
 #include <X11/extensions/XTest.h>
 
+namespace
+{
 unsigned int tokenToKeySym( const Token token )
 {
     switch ( token )
@@ -145,6 +146,27 @@ unsigned int tokenToKeySym( const Token token )
     case Token::KEY_ENTER:
         return XK_Return;
 
+    case Token::KEY_MINUS:
+        return XK_minus;
+    case Token::KEY_EQUALS:
+        return XK_equal;
+    case Token::KEY_LEFTBRACKET:
+        return XK_bracketleft;
+    case Token::KEY_RIGHTBRACKET:
+        return XK_bracketright;
+    case Token::KEY_BACKSLASH:
+        return XK_backslash;
+    case Token::KEY_SEMICOLON:
+        return XK_semicolon;
+    case Token::KEY_APOSTROPHE:
+        return XK_apostrophe;
+    case Token::KEY_COMMA:
+        return XK_comma;
+    case Token::KEY_PERIOD:
+        return XK_period;
+    case Token::KEY_SLASH:
+        return XK_slash;
+
     case Token::MODIFIER_CTRL:
         return XK_Control_L;
     case Token::MODIFIER_ALT:
@@ -163,83 +185,103 @@ unsigned int tokenToKeySym( const Token token )
     }
 }
 
-void sendKeyPress( const Token token,
-                   const KeyStatus status,
-                   Display* const display )
+} // namespace
+
+X11InputSession::X11InputSession( const char* const displayName )
+    : m_display( XOpenDisplay( displayName ) )
 {
-    bool keyDown = false;
+    if ( !m_display )
+    {
+        LOG( ERROR ) << "Could not open X display for keyboard input.";
+        return;
+    }
+    rebuildKeycodes();
+}
 
-    if ( status == KeyStatus::Down )
+X11InputSession::~X11InputSession()
+{
+    if ( m_display )
     {
-        keyDown = true;
+        XCloseDisplay( m_display );
     }
+}
+
+bool X11InputSession::isOpen() const noexcept
+{
+    return m_display != nullptr;
+}
 
-    XTestFakeKeyEvent( display,
-                       XKeysymToKeycode( display, tokenToKeySym( token ) ),
-                       keyDown,
-                       0 );
+KeyCode X11InputSession::keycode( const Token token ) const noexcept
+{
+    const auto index = static_cast<std::size_t>( token );
+    return index < m_keycodes.size() ? m_keycodes[index] : 0;
 }
 
-void sendTokensAsInput( const std::vector<Token> tokens )
+unsigned long long X11InputSession::sentEvents() const noexcept
 {
-    Display* const display = XOpenDisplay( nullptr );
-    XTestGrabControl( display, True );
+    return m_sentEvents;
+}
 
-    std::vector<Token> heldInputs = {};
-    bool noKeyUp = false;
-    for ( const auto& token : tokens )
+void X11InputSession::send( const std::vector<KeyEvent>& events )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if ( !m_display )
     {
-        if ( token == Token::TOKEN_NO_KEYUP_NEXT )
-        {
-            noKeyUp = true;
-            continue;
-        }
+        return;
+    }
 
-        if ( isModifier( token ) )
-        {
-            sendKeyPress( token, KeyStatus::Down, display );
-            if ( noKeyUp )
-            {
-                heldInputs.push_back( token );
-            }
-            continue;
-        }
+    handleMappingChanges();
 
-        if ( token == Token::TOKEN_NEW_SEQUENCE )
-        {
-            for ( const auto& h : heldInputs )
-            {
-                sendKeyPress( h, KeyStatus::Up, display );
-            }
-            heldInputs.clear();
-            continue;
-        }
-
-        if ( isLiteral( token ) )
-        {
-            sendKeyPress( token, KeyStatus::Down, display );
-            if ( noKeyUp )
-            {
-                sendKeyPress( token, KeyStatus::Up, display );
-            }
-            continue;
-        }
+    XTestGrabControl( m_display, True );
+    for ( const auto& e : events )
+    {
+        queueKey( e.token, e.status );
+    }
+    XTestGrabControl( m_display, False );
+    XSync( m_display, False );
+}
 
-        if ( token != Token::TOKEN_NO_KEYUP_NEXT )
+/*!
+   MappingNotify is delivered to every client without selecting it. Nothing
+   else is selected on this connection, so all pending events can be
+   dropped.
+ */
+void X11InputSession::handleMappingChanges()
+{
+    bool mappingChanged = false;
+    while ( XPending( m_display ) > 0 )
+    {
+        XEvent event;
+        XNextEvent( m_display, &event );
+        if ( event.type == MappingNotify )
         {
-            noKeyUp = false;
-            continue;
+            XRefreshKeyboardMapping( &event.xmapping );
+            mappingChanged = true;
         }
     }
+    if ( mappingChanged )
+    {
+        rebuildKeycodes();
+    }
+}
 
-    if ( !heldInputs.empty() )
+void X11InputSession::rebuildKeycodes()
+{
+    for ( std::size_t i = 0; i < m_keycodes.size(); ++i )
     {
-        for ( const auto& h : heldInputs )
-        {
-            sendKeyPress( h, KeyStatus::Up, display );
-        }
+        const auto keySym = tokenToKeySym( static_cast<Token>( i ) );
+        m_keycodes[i] = keySym == 0 ? 0 : XKeysymToKeycode( m_display, keySym );
     }
+}
 
-    XSync( display, False );
-    XTestGrabControl( display, False );
+void X11InputSession::queueKey( const Token token, const KeyStatus status )
+{
+    const auto code = keycode( token );
+    if ( code == 0 )
+    {
+        return;
+    }
+    // Only buffered by Xlib, the XSync in send() sends the whole batch.
+    XTestFakeKeyEvent( m_display, code, status == KeyStatus::Down, 0 );
+    ++m_sentEvents;
 }
@@ -0,0 +1,52 @@
+#pragma once
+#include <array>
+#include <mutex>
+#include <vector>
+#include <X11/Xlib.h>
+#include "input_parser.h"
+#include "input_sender.h"
+
+/*!
+   \brief Sends key events through XTest over one long lived display
+   connection.
+
+   The keycode of every \c Token is looked up once, and again when the
+   server reports a changed keyboard mapping. All events of a \c send call
+   are queued and flushed with a single \c XSync.
+ */
+class X11InputSession
+{
+public:
+    explicit X11InputSession( const char* displayName = nullptr );
+    ~X11InputSession();
+
+    X11InputSession( const X11InputSession& ) = delete;
+    X11InputSession& operator=( const X11InputSession& ) = delete;
+
+    bool isOpen() const noexcept;
+
+    void send( const std::vector<KeyEvent>& events );
+
+    /*!
+       \brief Keycode \a token is sent as, 0 if it has none.
+     */
+    KeyCode keycode( Token token ) const noexcept;
+
+    /*!
+       \brief Number of key events sent since the session was opened.
+     */
+    unsigned long long sentEvents() const noexcept;
+
+private:
+    static constexpr std::size_t k_tokenCount
+        = static_cast<std::size_t>( Token::MODIFIER_TILDE ) + 1;
+
+    void handleMappingChanges();
+    void rebuildKeycodes();
+    void queueKey( Token token, KeyStatus status );
+
+    Display* m_display = nullptr;
+    std::array<KeyCode, k_tokenCount> m_keycodes{};
+    unsigned long long m_sentEvents = 0;
+    std::mutex m_mutex;
+};
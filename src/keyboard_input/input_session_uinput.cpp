@@ -0,0 +1,179 @@
+#include "input_session_uinput.h"
+#include "evdev_keycodes.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+// Last, its KEY_* macros have the same names as some Token values.
+#include <linux/uinput.h>
+
+namespace
+{
+input_event makeEvent( const unsigned short type,
+                       const unsigned short code,
+                       const int value ) noexcept
+{
+    // The kernel sets the time.
+    input_event event{};
+    event.type = type;
+    event.code = code;
+    event.value = value;
+    return event;
+}
+
+bool writeAll( const int fd, const void* const data, const std::size_t size )
+{
+    const auto* bytes = static_cast<const char*>( data );
+    std::size_t written = 0;
+    while ( written < size )
+    {
+        const auto result = write( fd, bytes + written, size - written );
+        if ( result < 0 )
+        {
+            if ( errno == EINTR )
+            {
+                continue;
+            }
+            return false;
+        }
+        written += static_cast<std::size_t>( result );
+    }
+    return true;
+}
+
+} // namespace
+
+UinputInputSession::UinputInputSession( const char* const devicePath )
+    : m_fd( open( devicePath, O_WRONLY | O_CLOEXEC ) )
+{
+    if ( m_fd < 0 )
+    {
+        LOG( WARNING ) << "Could not open " << devicePath
+                       << " for keyboard input: " << std::strerror( errno );
+        return;
+    }
+    if ( !createDevice() )
+    {
+        LOG( ERROR ) << "Could not create uinput keyboard: "
+                     << std::strerror( errno );
+        close( m_fd );
+        m_fd = -1;
+    }
+}
+
+UinputInputSession::~UinputInputSession()
+{
+    if ( m_fd >= 0 )
+    {
+        ioctl( m_fd, UI_DEV_DESTROY );
+        close( m_fd );
+    }
+}
+
+bool UinputInputSession::isOpen() const noexcept
+{
+    return m_fd >= 0;
+}
+
+unsigned long long UinputInputSession::sentEvents() const noexcept
+{
+    return m_sentEvents;
+}
+
+unsigned long long UinputInputSession::sentReports() const noexcept
+{
+    return m_sentReports;
+}
+
+bool UinputInputSession::createDevice()
+{
+    if ( ioctl( m_fd, UI_SET_EVBIT, EV_KEY ) < 0
+         || ioctl( m_fd, UI_SET_EVBIT, EV_SYN ) < 0 )
+    {
+        return false;
+    }
+    for ( const auto code : evdev::k_keycodes )
+    {
+        if ( code != 0 && ioctl( m_fd, UI_SET_KEYBIT, code ) < 0 )
+        {
+            return false;
+        }
+    }
+
+    input_id id{};
+    id.bustype = BUS_VIRTUAL;
+    id.version = 1;
+
+#ifdef UI_DEV_SETUP
+    uinput_setup setup{};
+    setup.id = id;
+    std::strncpy( setup.name, k_deviceName, UINPUT_MAX_NAME_SIZE - 1 );
+    if ( ioctl( m_fd, UI_DEV_SETUP, &setup ) < 0 )
+#endif
+    {
+        // Kernels before 4.5 read the device description from a write.
+        uinput_user_dev device{};
+        device.id = id;
+        std::strncpy( device.name, k_deviceName, UINPUT_MAX_NAME_SIZE - 1 );
+        if ( !writeAll( m_fd, &device, sizeof( device ) ) )
+        {
+            return false;
+        }
+    }
+
+    return ioctl( m_fd, UI_DEV_CREATE ) >= 0;
+}
+
+void UinputInputSession::send( const std::vector<KeyEvent>& events )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if ( m_fd < 0 )
+    {
+        return;
+    }
+
+    std::vector<input_event> frames;
+    frames.reserve( events.size() * 2 + 1 );
+    // A frame is read as one change of the keyboard state, a key that
+    // changes twice needs a new frame.
+    std::vector<unsigned short> frameCodes;
+    unsigned long long keys = 0;
+    unsigned long long reports = 0;
+    for ( const auto& e : events )
+    {
+        const auto code = evdev::keycode( e.token );
+        if ( code == 0 )
+        {
+            continue;
+        }
+        if ( std::find( frameCodes.begin(), frameCodes.end(), code )
+             != frameCodes.end() )
+        {
+            frames.push_back( makeEvent( EV_SYN, SYN_REPORT, 0 ) );
+            ++reports;
+            frameCodes.clear();
+        }
+        frames.push_back(
+            makeEvent( EV_KEY, code, e.status == KeyStatus::Down ? 1 : 0 ) );
+        frameCodes.push_back( code );
+        ++keys;
+    }
+    if ( frameCodes.empty() )
+    {
+        return;
+    }
+    frames.push_back( makeEvent( EV_SYN, SYN_REPORT, 0 ) );
+    ++reports;
+
+    if ( !writeAll(
+             m_fd, frames.data(), frames.size() * sizeof( input_event ) ) )
+    {
+        LOG( ERROR ) << "Could not send keyboard input to uinput: "
+                     << std::strerror( errno );
+        return;
+    }
+    m_sentEvents += keys;
+    m_sentReports += reports;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <mutex>
+#include <string>
+#include <vector>
+#include "input_sender.h"
+
+/*!
+   \brief Sends key events through a virtual uinput keyboard, which reaches
+   Wayland and X11 clients alike.
+
+   The device is created once and kept, desktops take a moment to pick up
+   a new input device. Events of a \c send call are written with a single
+   \c write and a \c SYN_REPORT only where a key changes twice, so a batch
+   is as few input frames as possible.
+
+   Needs write access to /dev/uinput.
+ */
+class UinputInputSession
+{
+public:
+    static constexpr const char* k_deviceName
+        = "OpenVR Advanced Settings Keyboard";
+
+    explicit UinputInputSession( const char* devicePath = "/dev/uinput" );
+    ~UinputInputSession();
+
+    UinputInputSession( const UinputInputSession& ) = delete;
+    UinputInputSession& operator=( const UinputInputSession& ) = delete;
+
+    bool isOpen() const noexcept;
+
+    void send( const std::vector<KeyEvent>& events );
+
+    /*!
+       \brief Number of key events sent since the device was created.
+     */
+    unsigned long long sentEvents() const noexcept;
+
+    /*!
+       \brief Number of \c SYN_REPORT events sent since the device was
+       created.
+     */
+    unsigned long long sentReports() const noexcept;
+
+private:
+    bool createDevice();
+
+    int m_fd = -1;
+    unsigned long long m_sentEvents = 0;
+    unsigned long long m_sentReports = 0;
+    std::mutex m_mutex;
+};
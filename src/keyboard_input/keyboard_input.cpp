@@ -1,27 +1,81 @@
 #include "keyboard_input.h"
 #include "src/keyboard_input/input_sender.h"
+#include "src/keyboard_input/macro_executor.h"
+
+namespace
+{
+// VRChat only notices its debug keys while they are held down.
+constexpr std::chrono::milliseconds k_vrcDebugHold{ 100 };
+
+MacroExecutor& macroExecutor()
+{
+    // Initialises the platform sender first, so it outlives the executor,
+    // which releases held keys when it is destroyed.
+    [[maybe_unused]] static const auto senderReady
+        = ( sendKeyEvents( {} ), true );
+    static MacroExecutor executor( sendKeyEvents );
+    return executor;
+}
+
+void queueEvents( std::vector<KeyEvent> events )
+{
+    macroExecutor().run(
+        { { std::chrono::milliseconds( 0 ), std::move( events ) } } );
+}
+
+void queueTokens( const std::vector<Token>& tokens )
+{
+    queueEvents( toKeyEvents( tokens ) );
+}
+
+void holdRShiftTilde( const Token digit )
+{
+    macroExecutor().run(
+        holdKeys( toKeyEvents( { Token::MODIFIER_RSHIFT,
+                                 Token::MODIFIER_TILDE,
+                                 digit } ),
+                  k_vrcDebugHold ) );
+}
+
+} // namespace
 
 namespace keyboardinput
 {
+void prepareKeyboardInput()
+{
+    macroExecutor();
+}
+
 void sendKeyboardInput( QString input )
 {
-    sendStringAsInput( input.toStdString() );
+    sendKeyboardMacro( input.toStdString() );
+}
+
+void sendKeyboardMacro( const std::string& input )
+{
+    macroExecutor().run( parseMacro( input ) );
+}
+
+void sendKeyboardProgram( const ShortcutProgram& program )
+{
+    macroExecutor().run( program );
 }
 
 void sendKeyboardEnter()
 {
     const auto tokens = std::vector<Token>{ Token::KEY_ENTER };
 
-    sendTokensAsInput( tokens );
+    queueTokens( tokens );
 }
 
 void sendKeyboardBackspace( const int count )
 {
-    const auto tokens = std::vector<Token>{ Token::KEY_BACKSPACE };
-    for ( int i = 0; i < count; ++i )
+    if ( count <= 0 )
     {
-        sendTokensAsInput( tokens );
+        return;
     }
+    queueEvents( repeatKeys( toKeyEvents( { Token::KEY_BACKSPACE } ),
+                             static_cast<std::size_t>( count ) ) );
 }
 
 void sendKeyboardAltTab()
@@ -29,7 +83,7 @@ void sendKeyboardAltTab()
     const auto tokens
         = std::vector<Token>{ Token::MODIFIER_ALT, Token::KEY_TAB };
 
-    sendTokensAsInput( tokens );
+    queueTokens( tokens );
 }
 
 void sendKeyboardAltEnter()
@@ -37,7 +91,7 @@ void sendKeyboardAltEnter()
     const auto tokens
         = std::vector<Token>{ Token::MODIFIER_ALT, Token::KEY_ENTER };
 
-    sendTokensAsInput( tokens );
+    queueTokens( tokens );
 }
 
 void sendKeyboardCtrlC()
@@ -45,7 +99,7 @@ void sendKeyboardCtrlC()
     const auto tokens
         = std::vector<Token>{ Token::MODIFIER_CTRL, Token::KEY_c };
 
-    sendTokensAsInput( tokens );
+    queueTokens( tokens );
 }
 
 void sendKeyboardCtrlV()
@@ -53,187 +107,57 @@ void sendKeyboardCtrlV()
     const auto tokens
         = std::vector<Token>{ Token::MODIFIER_CTRL, Token::KEY_v };
 
-    sendTokensAsInput( tokens );
+    queueTokens( tokens );
 }
 
 void sendKeyboardRShiftTilde1()
 {
-    const auto tokens = std::vector<Token>{
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_RSHIFT,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_TILDE,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::KEY_1
-    };
-    sendTokensAsInput( tokens );
+    holdRShiftTilde( Token::KEY_1 );
 }
 
 void sendKeyboardRShiftTilde2()
 {
-    const auto tokens = std::vector<Token>{
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_RSHIFT,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_TILDE,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::KEY_2
-    };
-    sendTokensAsInput( tokens );
+    holdRShiftTilde( Token::KEY_2 );
 }
 
 void sendKeyboardRShiftTilde3()
 {
-    const auto tokens = std::vector<Token>{
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_RSHIFT,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_TILDE,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::KEY_3
-    };
-    sendTokensAsInput( tokens );
+    holdRShiftTilde( Token::KEY_3 );
 }
 
 void sendKeyboardRShiftTilde4()
 {
-    const auto tokens = std::vector<Token>{
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_RSHIFT,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_TILDE,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::KEY_4
-    };
-    sendTokensAsInput( tokens );
+    holdRShiftTilde( Token::KEY_4 );
 }
 
 void sendKeyboardRShiftTilde5()
 {
-    const auto tokens = std::vector<Token>{
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_RSHIFT,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_TILDE,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::KEY_5
-    };
-    sendTokensAsInput( tokens );
+    holdRShiftTilde( Token::KEY_5 );
 }
 
 void sendKeyboardRShiftTilde6()
 {
-    const auto tokens = std::vector<Token>{
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_RSHIFT,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_TILDE,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::KEY_6
-    };
-    sendTokensAsInput( tokens );
+    holdRShiftTilde( Token::KEY_6 );
 }
 
 void sendKeyboardRShiftTilde7()
 {
-    const auto tokens = std::vector<Token>{
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_RSHIFT,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_TILDE,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::KEY_7
-    };
-    sendTokensAsInput( tokens );
+    holdRShiftTilde( Token::KEY_7 );
 }
 
 void sendKeyboardRShiftTilde8()
 {
-    const auto tokens = std::vector<Token>{
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_RSHIFT,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_TILDE,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::KEY_8
-    };
-    sendTokensAsInput( tokens );
+    holdRShiftTilde( Token::KEY_8 );
 }
 
 void sendKeyboardRShiftTilde9()
 {
-    const auto tokens = std::vector<Token>{
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_RSHIFT,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_TILDE,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::KEY_9
-    };
-    sendTokensAsInput( tokens );
+    holdRShiftTilde( Token::KEY_9 );
 }
 
 void sendKeyboardRShiftTilde0()
 {
-    const auto tokens = std::vector<Token>{
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_RSHIFT,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::MODIFIER_TILDE,
-        Token::TOKEN_NO_KEYUP_NEXT, Token::KEY_0
-    };
-    sendTokensAsInput( tokens );
-}
-
-void sendKeyboardRShiftTilde1Delayed()
-{
-    const auto tokens = std::vector<Token>{ Token::MODIFIER_RSHIFT,
-                                            Token::MODIFIER_TILDE,
-                                            Token::KEY_1 };
-    sendTokensAsInput( tokens );
-}
-
-void sendKeyboardRShiftTilde2Delayed()
-{
-    const auto tokens = std::vector<Token>{ Token::MODIFIER_RSHIFT,
-                                            Token::MODIFIER_TILDE,
-                                            Token::KEY_2 };
-    sendTokensAsInput( tokens );
-}
-
-void sendKeyboardRShiftTilde3Delayed()
-{
-    const auto tokens = std::vector<Token>{ Token::MODIFIER_RSHIFT,
-                                            Token::MODIFIER_TILDE,
-                                            Token::KEY_3 };
-    sendTokensAsInput( tokens );
-}
-
-void sendKeyboardRShiftTilde4Delayed()
-{
-    const auto tokens = std::vector<Token>{ Token::MODIFIER_RSHIFT,
-                                            Token::MODIFIER_TILDE,
-                                            Token::KEY_4 };
-    sendTokensAsInput( tokens );
-}
-
-void sendKeyboardRShiftTilde5Delayed()
-{
-    const auto tokens = std::vector<Token>{ Token::MODIFIER_RSHIFT,
-                                            Token::MODIFIER_TILDE,
-                                            Token::KEY_5 };
-    sendTokensAsInput( tokens );
-}
-
-void sendKeyboardRShiftTilde6Delayed()
-{
-    const auto tokens = std::vector<Token>{ Token::MODIFIER_RSHIFT,
-                                            Token::MODIFIER_TILDE,
-                                            Token::KEY_6 };
-    sendTokensAsInput( tokens );
-}
-
-void sendKeyboardRShiftTilde7Delayed()
-{
-    const auto tokens = std::vector<Token>{ Token::MODIFIER_RSHIFT,
-                                            Token::MODIFIER_TILDE,
-                                            Token::KEY_7 };
-    sendTokensAsInput( tokens );
-}
-
-void sendKeyboardRShiftTilde8Delayed()
-{
-    const auto tokens = std::vector<Token>{ Token::MODIFIER_RSHIFT,
-                                            Token::MODIFIER_TILDE,
-                                            Token::KEY_8 };
-    sendTokensAsInput( tokens );
-}
-
-void sendKeyboardRShiftTilde9Delayed()
-{
-    const auto tokens = std::vector<Token>{ Token::MODIFIER_RSHIFT,
-                                            Token::MODIFIER_TILDE,
-                                            Token::KEY_9 };
-    sendTokensAsInput( tokens );
-}
-
-void sendKeyboardRShiftTilde0Delayed()
-{
-    const auto tokens = std::vector<Token>{ Token::MODIFIER_RSHIFT,
-                                            Token::MODIFIER_TILDE,
-                                            Token::KEY_0 };
-    sendTokensAsInput( tokens );
+    holdRShiftTilde( Token::KEY_0 );
 }
 
 } // namespace keyboardinput
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <string>
 #include <vector>
 #include <QString>
+#include "keyboard_macro.h"
 
 namespace keyboardinput
 {
@@ -16,7 +18,18 @@ enum class KeyStatus
     Down,
 };
 
+/*!
+Opens the platform sender ahead of the first shortcut. A new virtual
+keyboard takes a moment before the desktop notices it.
+*/
+void prepareKeyboardInput();
 void sendKeyboardInput( QString input );
+/*!
+Queues a shortcut, which may contain the timing annotations described at
+parseMacro(). Returns without waiting for it to be sent.
+*/
+void sendKeyboardMacro( const std::string& input );
+void sendKeyboardProgram( const ShortcutProgram& program );
 void sendKeyboardEnter();
 void sendKeyboardBackspace( const int count );
 void sendKeyboardAltTab();
@@ -31,7 +44,7 @@ void sendKeyboardCtrlV();
 // adding vrcDebug = true to [utilitiesSettings] in
 // OpenVRAdvancedSettings.ini
 
-// These just call a thread
+// Hold RShift, ~ and the digit for a moment, without blocking
 void sendKeyboardRShiftTilde1();
 void sendKeyboardRShiftTilde2();
 void sendKeyboardRShiftTilde3();
@@ -43,16 +56,4 @@ void sendKeyboardRShiftTilde8();
 void sendKeyboardRShiftTilde9();
 void sendKeyboardRShiftTilde0();
 
-// These should be run after a slight delay
-void sendKeyboardRShiftTilde1Delayed();
-void sendKeyboardRShiftTilde2Delayed();
-void sendKeyboardRShiftTilde3Delayed();
-void sendKeyboardRShiftTilde4Delayed();
-void sendKeyboardRShiftTilde5Delayed();
-void sendKeyboardRShiftTilde6Delayed();
-void sendKeyboardRShiftTilde7Delayed();
-void sendKeyboardRShiftTilde8Delayed();
-void sendKeyboardRShiftTilde9Delayed();
-void sendKeyboardRShiftTilde0Delayed();
-
 } // namespace keyboardinput
@@ -0,0 +1,354 @@
+#include "keyboard_macro.h"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <optional>
+
+namespace
+{
+std::vector<KeyEvent> parseKeys( const std::string& text )
+{
+    return toKeyEvents(
+        removeIncorrectTokens( ParseKeyboardInputsToTokens( text ) ) );
+}
+
+std::optional<int> parseNumber( const std::string& digits,
+                                const int max ) noexcept
+{
+    if ( digits.empty() || digits.size() > 5
+         || !std::all_of( digits.begin(), digits.end(), []( const char c ) {
+                return c >= '0' && c <= '9';
+            } ) )
+    {
+        return std::nullopt;
+    }
+    const auto number = std::stoi( digits );
+    if ( number > max )
+    {
+        return std::nullopt;
+    }
+    return number;
+}
+
+std::optional<std::chrono::milliseconds>
+    parseDuration( const std::string& digits ) noexcept
+{
+    const auto ms = parseNumber(
+        digits, static_cast<int>( k_maxMacroStepDelay.count() ) );
+    if ( !ms )
+    {
+        return std::nullopt;
+    }
+    return std::chrono::milliseconds( *ms );
+}
+
+struct TextKey
+{
+    bool typeable = false;
+    Token token = Token::KEY_SPACE;
+    bool shift = false;
+};
+
+constexpr std::array<TextKey, 128> makeTextKeys() noexcept
+{
+    std::array<TextKey, 128> keys{};
+    const auto set = [&keys]( const char c, const Token token, bool shift ) {
+        keys[static_cast<unsigned char>( c )] = { true, token, shift };
+    };
+
+    for ( char c = 'a'; c <= 'z'; ++c )
+    {
+        const auto upper = static_cast<char>( c - 'a' + 'A' );
+        set( c, static_cast<Token>( c ), false );
+        set( upper, static_cast<Token>( c ), true );
+    }
+    for ( char c = '0'; c <= '9'; ++c )
+    {
+        set( c, static_cast<Token>( c ), false );
+    }
+    set( ' ', Token::KEY_SPACE, false );
+    set( '\t', Token::KEY_TAB, false );
+    set( '\n', Token::KEY_ENTER, false );
+
+    // US layout.
+    set( '-', Token::KEY_MINUS, false );
+    set( '=', Token::KEY_EQUALS, false );
+    set( '[', Token::KEY_LEFTBRACKET, false );
+    set( ']', Token::KEY_RIGHTBRACKET, false );
+    set( '\\', Token::KEY_BACKSLASH, false );
+    set( ';', Token::KEY_SEMICOLON, false );
+    set( '\'', Token::KEY_APOSTROPHE, false );
+    set( ',', Token::KEY_COMMA, false );
+    set( '.', Token::KEY_PERIOD, false );
+    set( '/', Token::KEY_SLASH, false );
+    set( '`', Token::MODIFIER_TILDE, false );
+
+    set( '!', Token::KEY_1, true );
+    set( '@', Token::KEY_2, true );
+    set( '#', Token::KEY_3, true );
+    set( '$', Token::KEY_4, true );
+    set( '%', Token::KEY_5, true );
+    set( '^', Token::KEY_6, true );
+    set( '&', Token::KEY_7, true );
+    set( '*', Token::KEY_8, true );
+    set( '(', Token::KEY_9, true );
+    set( ')', Token::KEY_0, true );
+    set( '_', Token::KEY_MINUS, true );
+    set( '+', Token::KEY_EQUALS, true );
+    set( '{', Token::KEY_LEFTBRACKET, true );
+    set( '}', Token::KEY_RIGHTBRACKET, true );
+    set( '|', Token::KEY_BACKSLASH, true );
+    set( ':', Token::KEY_SEMICOLON, true );
+    set( '"', Token::KEY_APOSTROPHE, true );
+    set( '<', Token::KEY_COMMA, true );
+    set( '>', Token::KEY_PERIOD, true );
+    set( '?', Token::KEY_SLASH, true );
+    set( '~', Token::MODIFIER_TILDE, true );
+
+    return keys;
+}
+
+constexpr auto k_textKeys = makeTextKeys();
+
+/*!
+   \brief Appends the key presses that type \a text to \a events. Shift is
+   held across consecutive characters that need it.
+   \return False if \a text has a character that can't be typed, the
+   characters before it are still appended.
+ */
+bool appendText( const std::string& text, std::vector<KeyEvent>& events )
+{
+    bool shifted = false;
+    bool typeable = true;
+    for ( const auto c : text )
+    {
+        const auto index = static_cast<unsigned char>( c );
+        if ( index >= k_textKeys.size() || !k_textKeys[index].typeable )
+        {
+            LOG( INFO ) << "Character can't be typed: " << c;
+            typeable = false;
+            break;
+        }
+
+        const auto& key = k_textKeys[index];
+        if ( key.shift != shifted )
+        {
+            events.push_back(
+                { Token::MODIFIER_SHIFT,
+                  key.shift ? KeyStatus::Down : KeyStatus::Up } );
+            shifted = key.shift;
+        }
+        events.push_back( { key.token, KeyStatus::Down } );
+        events.push_back( { key.token, KeyStatus::Up } );
+    }
+    if ( shifted )
+    {
+        events.push_back( { Token::MODIFIER_SHIFT, KeyStatus::Up } );
+    }
+    return typeable;
+}
+
+/*!
+   \brief Presses or releases the keys in \a keys, in the order written.
+   \return False if \a keys has no key.
+ */
+bool appendKeyStatus( const std::string& keys,
+                      const KeyStatus status,
+                      std::vector<KeyEvent>& events )
+{
+    bool any = false;
+    for ( const auto token : ParseKeyboardInputsToTokens( keys ) )
+    {
+        if ( isLiteral( token ) || isModifier( token ) )
+        {
+            events.push_back( { token, status } );
+            any = true;
+        }
+    }
+    return any;
+}
+
+} // namespace
+
+Macro holdKeys( const std::vector<KeyEvent>& events,
+                const std::chrono::milliseconds hold )
+{
+    MacroStep press;
+    MacroStep release;
+    release.delay = hold;
+    for ( const auto& e : events )
+    {
+        if ( e.status == KeyStatus::Down )
+        {
+            press.events.push_back( e );
+            release.events.push_back( { e.token, KeyStatus::Up } );
+        }
+    }
+    std::reverse( release.events.begin(), release.events.end() );
+
+    return { std::move( press ), std::move( release ) };
+}
+
+std::vector<KeyEvent> repeatKeys( const std::vector<KeyEvent>& events,
+                                  const std::size_t count )
+{
+    std::vector<KeyEvent> repeated;
+    repeated.reserve( events.size() * count );
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        repeated.insert( repeated.end(), events.begin(), events.end() );
+    }
+    return repeated;
+}
+
+ShortcutProgram compileShortcut( const std::string& shortcut )
+{
+    return std::make_shared<const Macro>( parseMacro( shortcut ) );
+}
+
+Macro parseMacro( const std::string& input )
+{
+    Macro macro;
+    // Sent as one batch when the next wait starts.
+    MacroStep step;
+    // Written since the previous annotation, what holds and repeats use.
+    std::vector<KeyEvent> keys;
+    std::string text;
+
+    const auto takeText = [&] {
+        const auto events = parseKeys( text );
+        keys.insert( keys.end(), events.begin(), events.end() );
+        text.clear();
+    };
+    const auto takeKeys = [&] {
+        takeText();
+        step.events.insert( step.events.end(), keys.begin(), keys.end() );
+        keys.clear();
+    };
+    const auto wait = [&]( const std::chrono::milliseconds delay ) {
+        takeKeys();
+        if ( !step.events.empty() )
+        {
+            macro.push_back( std::move( step ) );
+            step = MacroStep{};
+        }
+        step.delay += delay;
+    };
+
+    for ( std::size_t i = 0; i < input.size(); ++i )
+    {
+        if ( input[i] == '"' )
+        {
+            takeText();
+            std::string quoted;
+            auto close = i + 1;
+            for ( ; close < input.size() && input[close] != '"'; ++close )
+            {
+                if ( input[close] == '\\' && close + 1 < input.size() )
+                {
+                    ++close;
+                }
+                quoted.push_back( input[close] );
+            }
+            if ( close == input.size() )
+            {
+                LOG( INFO ) << "Unterminated text in macro: " << input;
+                break;
+            }
+            i = close;
+
+            if ( !appendText( quoted, keys ) )
+            {
+                break;
+            }
+            continue;
+        }
+
+        if ( input[i] != '{' )
+        {
+            text.push_back( input[i] );
+            continue;
+        }
+
+        const auto close = input.find( '}', i );
+        if ( close == std::string::npos )
+        {
+            LOG( INFO ) << "Unterminated annotation in macro: " << input;
+            break;
+        }
+        auto annotation = input.substr( i + 1, close - i - 1 );
+        i = close;
+
+        const auto kind = annotation.empty() ? '\0' : annotation.front();
+        if ( kind == '+' || kind == '-' )
+        {
+            takeKeys();
+            if ( !appendKeyStatus( annotation.substr( 1 ),
+                                   kind == '+' ? KeyStatus::Down
+                                               : KeyStatus::Up,
+                                   step.events ) )
+            {
+                LOG( INFO ) << "Invalid keys in macro: " << input;
+                break;
+            }
+            continue;
+        }
+
+        if ( kind == 'x' )
+        {
+            const auto count = parseNumber(
+                annotation.substr( 1 ), static_cast<int>( k_maxMacroRepeat ) );
+            if ( !count )
+            {
+                LOG( INFO ) << "Invalid repeat count in macro: " << input;
+                break;
+            }
+            takeText();
+            keys = repeatKeys( keys, static_cast<std::size_t>( *count ) );
+            takeKeys();
+            continue;
+        }
+
+        const auto hold = kind == 'h';
+        if ( hold )
+        {
+            annotation.erase( 0, 1 );
+        }
+        const auto duration = parseDuration( annotation );
+        if ( !duration )
+        {
+            LOG( INFO ) << "Invalid duration in macro: " << input;
+            break;
+        }
+
+        if ( hold )
+        {
+            takeText();
+            auto held = holdKeys( keys, *duration );
+            keys.clear();
+            if ( held.front().events.empty() )
+            {
+                LOG( INFO ) << "Nothing to hold in macro: " << input;
+                continue;
+            }
+            step.events.insert( step.events.end(),
+                                held.front().events.begin(),
+                                held.front().events.end() );
+            wait( *duration );
+            step.events = std::move( held.back().events );
+        }
+        else
+        {
+            wait( *duration );
+        }
+    }
+    takeKeys();
+
+    // A trailing wait still spaces this macro from the next one.
+    if ( !step.events.empty() || step.delay.count() > 0 )
+    {
+        macro.push_back( std::move( step ) );
+    }
+
+    return macro;
+}
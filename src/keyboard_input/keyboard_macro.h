@@ -0,0 +1,55 @@
+#pragma once
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include "input_sender.h"
+
+struct MacroStep
+{
+    // Time to wait after the previous step was sent.
+    std::chrono::milliseconds delay{ 0 };
+    std::vector<KeyEvent> events;
+};
+
+using Macro = std::vector<MacroStep>;
+
+// A parsed shortcut, shared by every press instead of parsing it again.
+using ShortcutProgram = std::shared_ptr<const Macro>;
+
+constexpr std::chrono::milliseconds k_maxMacroStepDelay{ 60000 };
+constexpr std::size_t k_maxMacroRepeat = 1000;
+
+/*!
+   \brief Parses a keyboard shortcut with annotations.
+
+   Outside of braces and quotes the usual shortcut grammar applies.
+
+   \c {N} waits N milliseconds before continuing. \c {hN} presses every key
+   written since the previous annotation, holds them for N milliseconds and
+   releases them. \c {xN} repeats the keys written since the previous
+   annotation N times.
+
+   \c {+KEYS} presses KEYS and keeps them pressed until \c {-KEYS} or the
+   end of the macro. Both take keys in the shortcut grammar.
+
+   \c "text" types the text, with shift for upper case letters and symbols
+   on a US layout. Inside quotes \c \\ escapes the next character.
+
+   Every key between two waits is sent in one batch. Like the shortcut
+   parser, an invalid annotation or character ends the macro and
+   everything before it is kept.
+ */
+Macro parseMacro( const std::string& input );
+
+ShortcutProgram compileShortcut( const std::string& shortcut );
+
+/*!
+   \brief Presses the keys of \a events, waits \a hold and releases them in
+   reverse order. Releases in \a events are ignored.
+ */
+Macro holdKeys( const std::vector<KeyEvent>& events,
+                std::chrono::milliseconds hold );
+
+std::vector<KeyEvent> repeatKeys( const std::vector<KeyEvent>& events,
+                                  std::size_t count );
@@ -0,0 +1,157 @@
+#include "macro_executor.h"
+#include <algorithm>
+
+MacroExecutor::MacroExecutor( SendFunction send )
+    : m_send( std::move( send ) ), m_worker( &MacroExecutor::work, this )
+{
+}
+
+MacroExecutor::~MacroExecutor()
+{
+    stop();
+}
+
+void MacroExecutor::run( Macro macro )
+{
+    run( std::make_shared<const Macro>( std::move( macro ) ) );
+}
+
+void MacroExecutor::run( ShortcutProgram program )
+{
+    if ( !program || program->empty() )
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        if ( !m_running )
+        {
+            return;
+        }
+        if ( m_queue.size() >= k_maxQueuedMacros )
+        {
+            LOG( WARNING ) << "Too many keyboard macros queued, dropping one.";
+            return;
+        }
+        m_queue.push_back( std::move( program ) );
+    }
+    m_wake.notify_one();
+}
+
+void MacroExecutor::cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_queue.clear();
+        ++m_cancelGeneration;
+    }
+    m_wake.notify_one();
+}
+
+void MacroExecutor::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_running = false;
+        m_queue.clear();
+    }
+    m_wake.notify_one();
+    if ( m_worker.joinable() )
+    {
+        m_worker.join();
+    }
+}
+
+bool MacroExecutor::idle() const
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return !m_busy && m_queue.empty();
+}
+
+void MacroExecutor::work()
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    while ( true )
+    {
+        m_wake.wait( lock, [this] { return !m_running || !m_queue.empty(); } );
+        if ( !m_running )
+        {
+            break;
+        }
+
+        const auto macro = std::move( m_queue.front() );
+        m_queue.pop_front();
+        m_busy = true;
+
+        const auto generation = m_cancelGeneration;
+        auto due = Clock::now();
+        for ( const auto& step : *macro )
+        {
+            due += step.delay;
+            if ( !waitUntil( lock, due ) || generation != m_cancelGeneration )
+            {
+                break;
+            }
+            send( lock, step.events );
+        }
+
+        releasePressed( lock );
+        m_busy = false;
+    }
+    releasePressed( lock );
+}
+
+bool MacroExecutor::waitUntil( std::unique_lock<std::mutex>& lock,
+                               const Clock::time_point due )
+{
+    const auto generation = m_cancelGeneration;
+    const auto interrupted
+        = [&] { return !m_running || generation != m_cancelGeneration; };
+
+    m_wake.wait_until( lock, due - k_spinThreshold, interrupted );
+    while ( !interrupted() && Clock::now() < due )
+    {
+        lock.unlock();
+        std::this_thread::yield();
+        lock.lock();
+    }
+    return !interrupted();
+}
+
+void MacroExecutor::send( std::unique_lock<std::mutex>& lock,
+                          const std::vector<KeyEvent>& events )
+{
+    if ( events.empty() )
+    {
+        return;
+    }
+
+    for ( const auto& e : events )
+    {
+        const auto pressed
+            = std::find( m_pressed.begin(), m_pressed.end(), e.token );
+        if ( e.status == KeyStatus::Down && pressed == m_pressed.end() )
+        {
+            m_pressed.push_back( e.token );
+        }
+        else if ( e.status == KeyStatus::Up && pressed != m_pressed.end() )
+        {
+            m_pressed.erase( pressed );
+        }
+    }
+
+    // Sending can block, don't hold the lock during it.
+    lock.unlock();
+    m_send( events );
+    lock.lock();
+}
+
+void MacroExecutor::releasePressed( std::unique_lock<std::mutex>& lock )
+{
+    std::vector<KeyEvent> releases;
+    for ( auto it = m_pressed.rbegin(); it != m_pressed.rend(); ++it )
+    {
+        releases.push_back( { *it, KeyStatus::Up } );
+    }
+    send( lock, releases );
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "keyboard_macro.h"
+
+/*!
+   \brief Sends keyboard macros on its own worker thread, so waits inside a
+   macro never block the caller.
+
+   Macros run one after another in the order they were queued. Step delays
+   are measured from the start of the macro, so slow sends don't add up.
+   Keys a macro leaves pressed are released when it ends, is cancelled or
+   the executor is stopped.
+ */
+class MacroExecutor
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using SendFunction = std::function<void( const std::vector<KeyEvent>& )>;
+
+    // Sleeping is only as accurate as the OS timer, so the last part of a
+    // wait is spent yielding instead.
+    static constexpr std::chrono::milliseconds k_spinThreshold{ 2 };
+    static constexpr std::size_t k_maxQueuedMacros = 16;
+
+    explicit MacroExecutor( SendFunction send );
+    ~MacroExecutor();
+
+    MacroExecutor( const MacroExecutor& ) = delete;
+    MacroExecutor& operator=( const MacroExecutor& ) = delete;
+
+    /*!
+       \brief Queues \a macro. Dropped if \c k_maxQueuedMacros are waiting.
+     */
+    void run( Macro macro );
+    void run( ShortcutProgram program );
+
+    /*!
+       \brief Stops the running macro and discards queued ones.
+     */
+    void cancel();
+
+    /*!
+       \brief Stops the worker thread. Queued macros are discarded.
+     */
+    void stop();
+
+    bool idle() const;
+
+private:
+    void work();
+    bool waitUntil( std::unique_lock<std::mutex>& lock, Clock::time_point due );
+    void send( std::unique_lock<std::mutex>& lock,
+               const std::vector<KeyEvent>& events );
+    void releasePressed( std::unique_lock<std::mutex>& lock );
+
+    SendFunction m_send;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wake;
+    bool m_running = true;
+    bool m_busy = false;
+    unsigned long long m_cancelGeneration = 0;
+    std::deque<ShortcutProgram> m_queue;
+    // Keys pressed by the worker and not released yet.
+    std::vector<Token> m_pressed;
+
+    std::thread m_worker;
+};
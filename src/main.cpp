@@ -1,16 +1,20 @@
 #include "utils/setup.h"
 #include "settings/settings.h"
+#include "utils/StartupProfiler.h"
 
 INITIALIZE_EASYLOGGINGPP
 
 int main( int argc, char* argv[] )
 {
+    auto& profiler = utils::startupProfiler();
+
     setUpLogging();
 
     LOG( INFO ) << "Settings File: "
                 << settings::initializeAndGetSettingsPath();
 
     LOG( INFO ) << settings::getSettingsAndValues();
+    profiler.mark( "settings" );
 
     QCoreApplication::setAttribute( Qt::AA_Use96Dpi );
     MyQApplication mainEventLoop( argc, argv );
@@ -35,9 +39,11 @@ int main( int argc, char* argv[] )
         manifest::handleManifests( commandLineArgs.forceInstallManifest,
                                    commandLineArgs.forceRemoveManifest );
     }
+    profiler.mark( "application" );
 
     openvr_init::initializeOpenVR(
         openvr_init::OpenVrInitializationType::Overlay );
+    profiler.mark( "OpenVR" );
 
     try
     {
@@ -46,6 +52,7 @@ int main( int argc, char* argv[] )
         advsettings::OverlayController controller( commandLineArgs.desktopMode,
                                                    commandLineArgs.forceNoSound,
                                                    qmlEngine );
+        profiler.mark( "OverlayController" );
 
         constexpr auto widgetPath = "res/qml/common/mainwidget.qml";
         const auto path = paths::binaryDirectoryFindFile( widgetPath );
@@ -68,9 +75,26 @@ int main( int argc, char* argv[] )
                          << std::endl;
         }
         auto quickObj = component.create();
+        profiler.mark( "QML" );
         controller.SetWidget( qobject_cast<QQuickItem*>( quickObj ),
                               application_strings::applicationDisplayName,
                               application_strings::applicationKey );
+        profiler.mark( "widget" );
+
+        if ( !commandLineArgs.importSnapshot.isEmpty()
+             || !commandLineArgs.exportSnapshot.isEmpty() )
+        {
+            controller.finishDeferredInit();
+        }
+        // Imported first so an export in the same run contains the result.
+        if ( !commandLineArgs.importSnapshot.isEmpty() )
+        {
+            controller.importSnapshot( commandLineArgs.importSnapshot );
+        }
+        if ( !commandLineArgs.exportSnapshot.isEmpty() )
+        {
+            controller.exportSnapshot( commandLineArgs.exportSnapshot );
+        }
 
         // Attempts to install the application manifest on all "regular" starts.
         if ( !commandLineArgs.desktopMode && !commandLineArgs.forceNoManifest )
@@ -2,6 +2,7 @@
 #include <easylogging++.h>
 #include <vector>
 #include <QString>
+#include "now_playing.h"
 
 namespace keyboardinput
 {
@@ -15,4 +16,36 @@ void sendMediaPreviousSong();
 void sendMediaPausePlay();
 void sendMediaStopSong();
 
+/*!
+   \brief Finds the media players ahead of the first media key.
+ */
+void prepareMediaKeys();
+
+/*!
+   \brief The track of the active media player. Stays empty where players
+   can't be followed.
+ */
+NowPlaying& nowPlaying();
+
+/*!
+   \brief Sends media keys only to \a player, one of \c NowPlaying::players,
+   until it closes. Empty to send them to the player that started playing
+   last.
+ */
+void pinMediaPlayer( const QString& player );
+
+/*!
+   \brief The application of \a player, one of \c NowPlaying::players,
+   the same for all of its instances.
+ */
+QString mediaApplicationName( const QString& player );
+
+/*!
+   \brief Sends media keys to players of the application \a name, like
+   "vlc", when no player is pinned and one of them runs. Empty for no
+   preference. Doesn't connect to the players, it is kept until
+   \c prepareMediaKeys does.
+ */
+void setPreferredMediaApplication( const QString& name );
+
 } // namespace keyboardinput
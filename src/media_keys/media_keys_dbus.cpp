@@ -1,59 +1,106 @@
 #include "media_keys.h"
+#include "mpris_player_registry.h"
 #include <QtCore/QCoreApplication>
-#include <QtCore/QDebug>
-#include <QtCore/QStringList>
 #include <QtDBus/QtDBus>
 
 namespace keyboardinput
 {
-void callMethodForAllMediaPlayerAvailableServices( const QString& method )
+namespace
 {
-    if ( !QDBusConnection::sessionBus().isConnected() )
+void updatePlayers( const MprisPlayerRegistry& registry )
+{
+    QStringList players;
+    for ( const auto& player : registry.players() )
     {
-        LOG( ERROR ) << "Media Keys: Unable to connect to DBUS session bus.";
-        return;
+        players.append( MprisPlayerRegistry::shortName( player ) );
     }
+    nowPlaying().setPlayers(
+        players, MprisPlayerRegistry::shortName( registry.pinnedPlayer() ) );
+}
+
+// Created by prepareMediaKeys after startup, connecting to the session bus
+// takes a while. Deleted with the application, while the bus connection
+// still exists.
+MprisPlayerRegistry* g_mediaPlayers = nullptr;
+// Set from the settings before the registry exists.
+QString g_preferredApplication;
 
-    QDBusReply<QStringList> names
-        = QDBusConnection::sessionBus().interface()->registeredServiceNames();
-    if ( !names.isValid() )
+MprisPlayerRegistry& mediaPlayers()
+{
+    if ( !g_mediaPlayers )
     {
-        LOG( ERROR )
-            << "Media Keys: Error getting DBUS registered service names:";
-        LOG( ERROR ) << names.error().message();
+        auto players = new MprisPlayerRegistry(
+            QDBusConnection::sessionBus(), QCoreApplication::instance() );
+        QObject::connect( players,
+                          &MprisPlayerRegistry::nowPlayingChanged,
+                          players,
+                          [players] {
+                              nowPlaying().setState( players->nowPlaying() );
+                          } );
+        QObject::connect( players,
+                          &MprisPlayerRegistry::playersChanged,
+                          players,
+                          [players] { updatePlayers( *players ); } );
+        players->setPreferredApplication( g_preferredApplication );
+        g_mediaPlayers = players;
     }
+    return *g_mediaPlayers;
+}
 
-    foreach ( QString name, names.value() )
+} // namespace
+
+NowPlaying& nowPlaying()
+{
+    static auto model = new NowPlaying( QCoreApplication::instance() );
+    return *model;
+}
+
+void prepareMediaKeys()
+{
+    mediaPlayers();
+}
+
+void pinMediaPlayer( const QString& player )
+{
+    mediaPlayers().pinPlayer(
+        player.isEmpty() ? QString()
+                         : MprisPlayerRegistry::k_servicePrefix + player );
+    updatePlayers( mediaPlayers() );
+}
+
+QString mediaApplicationName( const QString& player )
+{
+    return MprisPlayerRegistry::applicationName(
+        MprisPlayerRegistry::k_servicePrefix + player );
+}
+
+void setPreferredMediaApplication( const QString& name )
+{
+    g_preferredApplication = name;
+    if ( g_mediaPlayers )
     {
-        if ( name.contains( "org.mpris.MediaPlayer2" ) )
-        {
-            QDBusInterface iface( name,
-                                  "/org/mpris/MediaPlayer2",
-                                  "org.mpris.MediaPlayer2.Player",
-                                  QDBusConnection::sessionBus() );
-            iface.call( method );
-        }
+        g_mediaPlayers->setPreferredApplication( name );
     }
 }
 
 void sendMediaNextSong()
 {
-    callMethodForAllMediaPlayerAvailableServices( "Next" );
+    mediaPlayers().callActive( "Next" );
 }
 
 void sendMediaPreviousSong()
 {
-    callMethodForAllMediaPlayerAvailableServices( "Previous" );
+    mediaPlayers().callActive( "Previous" );
 }
 
 void sendMediaPausePlay()
 {
-    callMethodForAllMediaPlayerAvailableServices( "PlayPause" );
+    mediaPlayers().callActive( "PlayPause" );
 }
 
 void sendMediaStopSong()
 {
-    callMethodForAllMediaPlayerAvailableServices( "Stop" );
+    mediaPlayers().callActive( "Stop" );
 }
 
 } // namespace keyboardinput
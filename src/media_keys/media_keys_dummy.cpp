@@ -2,6 +2,34 @@
 
 namespace keyboardinput
 {
+void prepareMediaKeys()
+{
+    // dummy
+}
+
+NowPlaying& nowPlaying()
+{
+    // Never changes.
+    static NowPlaying model;
+    return model;
+}
+
+void pinMediaPlayer( const QString& )
+{
+    // Media keys go to the focused application.
+}
+
+QString mediaApplicationName( const QString& player )
+{
+    // No players are listed.
+    return player;
+}
+
+void setPreferredMediaApplication( const QString& )
+{
+    // Media keys go to the focused application.
+}
+
 void sendMediaNextSong()
 {
     // dummy
@@ -56,6 +56,34 @@ void sendKeyboardInputRaw( std::vector<INPUT> inputs )
     }
 }
 
+void prepareMediaKeys()
+{
+    // Media keys are sent as key presses, nothing to prepare.
+}
+
+NowPlaying& nowPlaying()
+{
+    // Never changes.
+    static NowPlaying model;
+    return model;
+}
+
+void pinMediaPlayer( const QString& )
+{
+    // Media keys go to the focused application.
+}
+
+QString mediaApplicationName( const QString& player )
+{
+    // No players are listed.
+    return player;
+}
+
+void setPreferredMediaApplication( const QString& )
+{
+    // Media keys go to the focused application.
+}
+
 void sendMediaNextSong()
 {
     std::vector<INPUT> inputs = {};
@@ -0,0 +1,394 @@
+#include "mpris_player_registry.h"
+#include <QDBusArgument>
+#include <QDBusMessage>
+#include <QDBusPendingCallWatcher>
+#include <QDBusPendingReply>
+#include <QRegularExpression>
+#include <algorithm>
+#include <cstring>
+#include <easylogging++.h>
+#include <utility>
+
+namespace keyboardinput
+{
+namespace
+{
+constexpr auto k_busService = "org.freedesktop.DBus";
+constexpr auto k_busPath = "/org/freedesktop/DBus";
+constexpr auto k_busInterface = "org.freedesktop.DBus";
+
+constexpr auto k_playerPath = "/org/mpris/MediaPlayer2";
+constexpr auto k_playerInterface = "org.mpris.MediaPlayer2.Player";
+constexpr auto k_propertiesInterface = "org.freedesktop.DBus.Properties";
+
+constexpr auto k_playing = "Playing";
+
+bool isPlayerName( const QString& name )
+{
+    return name.startsWith( MprisPlayerRegistry::k_servicePrefix );
+}
+
+// Values nested in a variant arrive still marshalled.
+template <typename T> T fromVariant( const QVariant& value )
+{
+    if ( value.userType() == qMetaTypeId<QDBusArgument>() )
+    {
+        return qdbus_cast<T>( value.value<QDBusArgument>() );
+    }
+    return value.value<T>();
+}
+
+} // namespace
+
+MprisPlayerRegistry::MprisPlayerRegistry( const QDBusConnection& connection,
+                                          QObject* parent )
+    : QObject( parent ), m_connection( connection )
+{
+    if ( !m_connection.isConnected() )
+    {
+        LOG( ERROR ) << "Media Keys: Unable to connect to DBUS session bus.";
+        return;
+    }
+
+    // Subscribed before listing. The bus sends the signals and the reply in
+    // order, so the list already contains every name added before it.
+    m_connection.connect(
+        k_busService,
+        k_busPath,
+        k_busInterface,
+        "NameOwnerChanged",
+        this,
+        SLOT( onNameOwnerChanged( QString, QString, QString ) ) );
+    // From every sender, one match rule instead of one for each player.
+    m_connection.connect(
+        QString(),
+        k_playerPath,
+        k_propertiesInterface,
+        "PropertiesChanged",
+        this,
+        SLOT( onPropertiesChanged( QString, QVariantMap, QStringList ) ) );
+    m_connection.connect( QString(),
+                          k_playerPath,
+                          k_playerInterface,
+                          "Seeked",
+                          this,
+                          SLOT( onSeeked( qlonglong ) ) );
+
+    const auto listNames = QDBusMessage::createMethodCall(
+        k_busService, k_busPath, k_busInterface, "ListNames" );
+    auto watcher = new QDBusPendingCallWatcher(
+        m_connection.asyncCall( listNames ), this );
+    connect( watcher,
+             &QDBusPendingCallWatcher::finished,
+             this,
+             [this]( QDBusPendingCallWatcher* call ) {
+                 call->deleteLater();
+                 const QDBusPendingReply<QStringList> names = *call;
+                 if ( names.isError() )
+                 {
+                     LOG( ERROR ) << "Media Keys: Error getting DBUS "
+                                     "registered service names: "
+                                  << names.error().message();
+                 }
+                 onPlayersListed( names.isError() ? QStringList()
+                                                  : names.value() );
+             } );
+}
+
+QStringList MprisPlayerRegistry::players() const
+{
+    QStringList names;
+    for ( const auto& player : m_players )
+    {
+        names.append( player.first );
+    }
+    return names;
+}
+
+bool MprisPlayerRegistry::isReady() const noexcept
+{
+    return m_ready;
+}
+
+template <typename Predicate>
+QString MprisPlayerRegistry::lastStartedPlaying( Predicate predicate ) const
+{
+    // Ties keep the first player.
+    const std::pair<const QString, Player>* last = nullptr;
+    for ( const auto& player : m_players )
+    {
+        if ( predicate( player.first )
+             && ( !last
+                  || player.second.startedPlaying
+                         > last->second.startedPlaying ) )
+        {
+            last = &player;
+        }
+    }
+    return last ? last->first : QString();
+}
+
+QString MprisPlayerRegistry::shortName( const QString& player )
+{
+    return player.mid( static_cast<int>( std::strlen( k_servicePrefix ) ) );
+}
+
+QString MprisPlayerRegistry::applicationName( const QString& player )
+{
+    // Instances add ".instance<pid>" to the name, which may itself contain
+    // dots, like "io.bassi.Amberol".
+    static const QRegularExpression instanceSuffix( "\\.instance\\d+$" );
+    return shortName( player ).remove( instanceSuffix );
+}
+
+void MprisPlayerRegistry::pinPlayer( const QString& player )
+{
+    m_pinnedPlayer = player;
+    emit nowPlayingChanged();
+}
+
+QString MprisPlayerRegistry::pinnedPlayer() const
+{
+    return m_pinnedPlayer;
+}
+
+void MprisPlayerRegistry::setPreferredApplication( const QString& name )
+{
+    m_preferredApplication = name;
+    emit nowPlayingChanged();
+}
+
+QString MprisPlayerRegistry::activePlayer() const
+{
+    if ( m_players.count( m_pinnedPlayer ) > 0 )
+    {
+        return m_pinnedPlayer;
+    }
+    if ( !m_preferredApplication.isEmpty() )
+    {
+        const auto preferred
+            = lastStartedPlaying( [this]( const QString& player ) {
+                  return applicationName( player ) == m_preferredApplication;
+              } );
+        if ( !preferred.isEmpty() )
+        {
+            return preferred;
+        }
+    }
+    return lastStartedPlaying( []( const QString& ) { return true; } );
+}
+
+NowPlayingState MprisPlayerRegistry::nowPlaying() const
+{
+    const auto player = m_players.find( activePlayer() );
+    return player == m_players.end() ? NowPlayingState()
+                                     : player->second.state;
+}
+
+void MprisPlayerRegistry::callActive( const QString& method )
+{
+    if ( !m_ready )
+    {
+        m_pendingCalls.append( method );
+        return;
+    }
+    const auto player = m_players.find( activePlayer() );
+    if ( player != m_players.end() )
+    {
+        call( player->first, *player->second.interface, method );
+    }
+}
+
+void MprisPlayerRegistry::onNameOwnerChanged( const QString& name,
+                                              const QString& oldOwner,
+                                              const QString& newOwner )
+{
+    if ( !isPlayerName( name ) )
+    {
+        return;
+    }
+    if ( newOwner.isEmpty() )
+    {
+        if ( m_players.erase( name ) > 0 )
+        {
+            LOG( INFO ) << "Media Keys: Player " << name << " closed.";
+            if ( name == m_pinnedPlayer )
+            {
+                m_pinnedPlayer.clear();
+            }
+            emit playersChanged();
+            emit nowPlayingChanged();
+        }
+    }
+    else if ( oldOwner.isEmpty() && addPlayer( name, newOwner ) )
+    {
+        emit playersChanged();
+        emit nowPlayingChanged();
+    }
+    else if ( const auto player = m_players.find( name );
+              player != m_players.end() )
+    {
+        // Reached through the same interface, but signals come from the new
+        // owner.
+        player->second.owner = newOwner;
+        fetchProperties( name );
+    }
+}
+
+void MprisPlayerRegistry::onPropertiesChanged( const QString& interface,
+                                               const QVariantMap& changed,
+                                               const QStringList& invalidated )
+{
+    const auto player = findOwner( message().service() );
+    if ( interface != k_playerInterface || player == m_players.end() )
+    {
+        return;
+    }
+    const auto name = player->first;
+    updatePlayer( name, changed );
+    // Position isn't sent with changes, it's fetched with the rest.
+    if ( changed.contains( "PlaybackStatus" ) || changed.contains( "Metadata" )
+         || !invalidated.isEmpty() )
+    {
+        fetchProperties( name );
+    }
+}
+
+void MprisPlayerRegistry::onSeeked( const qlonglong positionUs )
+{
+    const auto player = findOwner( message().service() );
+    if ( player != m_players.end() )
+    {
+        updatePlayer( player->first, { { "Position", positionUs } } );
+    }
+}
+
+void MprisPlayerRegistry::onPlayersListed( const QStringList& names )
+{
+    for ( const auto& name : names )
+    {
+        if ( isPlayerName( name ) )
+        {
+            addPlayer( name, QString() );
+        }
+    }
+    m_ready = true;
+    emit playersChanged();
+    emit nowPlayingChanged();
+
+    for ( const auto& method : std::exchange( m_pendingCalls, {} ) )
+    {
+        callActive( method );
+    }
+}
+
+bool MprisPlayerRegistry::addPlayer( const QString& name,
+                                     const QString& owner )
+{
+    if ( m_players.count( name ) > 0 )
+    {
+        return false;
+    }
+    LOG( INFO ) << "Media Keys: Found player " << name << ".";
+    auto& player = m_players[name];
+    player.interface = std::make_unique<MprisPlayer>( name, m_connection );
+    player.owner = owner;
+    player.state.player = shortName( name );
+    fetchProperties( name );
+    return true;
+}
+
+void MprisPlayerRegistry::fetchProperties( const QString& name )
+{
+    auto getAll = QDBusMessage::createMethodCall(
+        name, k_playerPath, k_propertiesInterface, "GetAll" );
+    getAll << QString( k_playerInterface );
+    auto watcher = new QDBusPendingCallWatcher(
+        m_connection.asyncCall( getAll ), this );
+    connect( watcher,
+             &QDBusPendingCallWatcher::finished,
+             this,
+             [this, name]( QDBusPendingCallWatcher* call ) {
+                 call->deleteLater();
+                 const QDBusPendingReply<QVariantMap> properties = *call;
+                 const auto player = m_players.find( name );
+                 if ( properties.isError() || player == m_players.end() )
+                 {
+                     return;
+                 }
+                 // Players listed at startup are only known by name until
+                 // now.
+                 player->second.owner = properties.reply().service();
+                 updatePlayer( name, properties.value() );
+             } );
+}
+
+void MprisPlayerRegistry::updatePlayer( const QString& name,
+                                        const QVariantMap& properties )
+{
+    const auto activeBefore = activePlayer();
+    auto& state = m_players.at( name ).state;
+    const auto before = state;
+
+    if ( properties.contains( "PlaybackStatus" ) )
+    {
+        state.playbackStatus = properties["PlaybackStatus"].toString();
+    }
+    if ( properties.contains( "Metadata" ) )
+    {
+        const auto metadata
+            = fromVariant<QVariantMap>( properties["Metadata"] );
+        state.title = metadata["xesam:title"].toString();
+        state.artist
+            = fromVariant<QStringList>( metadata["xesam:artist"] ).join( ", " );
+        state.lengthUs = metadata["mpris:length"].toLongLong();
+    }
+    if ( properties.contains( "Position" ) )
+    {
+        state.positionUs = properties["Position"].toLongLong();
+    }
+
+    if ( state.playbackStatus == k_playing
+         && before.playbackStatus != k_playing )
+    {
+        m_players.at( name ).startedPlaying = ++m_playingCount;
+    }
+    const auto active = activePlayer();
+    if ( active != activeBefore || ( active == name && state != before ) )
+    {
+        emit nowPlayingChanged();
+    }
+}
+
+std::map<QString, MprisPlayerRegistry::Player>::iterator
+    MprisPlayerRegistry::findOwner( const QString& owner )
+{
+    return std::find_if( m_players.begin(),
+                         m_players.end(),
+                         [&owner]( const auto& player ) {
+                             return !owner.isEmpty()
+                                    && player.second.owner == owner;
+                         } );
+}
+
+void MprisPlayerRegistry::call( const QString& name,
+                                MprisPlayer& player,
+                                const QString& method )
+{
+    auto watcher
+        = new QDBusPendingCallWatcher( player.asyncCall( method ), this );
+    connect( watcher,
+             &QDBusPendingCallWatcher::finished,
+             this,
+             [name, method]( QDBusPendingCallWatcher* reply ) {
+                 reply->deleteLater();
+                 if ( reply->isError() )
+                 {
+                     LOG( WARNING )
+                         << "Media Keys: " << method << " failed for "
+                         << name << ": " << reply->error().message();
+                 }
+             } );
+}
+
+} // namespace keyboardinput
@@ -0,0 +1,161 @@
+#pragma once
+#include <QDBusAbstractInterface>
+#include <QDBusConnection>
+#include <QDBusContext>
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QVariantMap>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include "now_playing.h"
+
+namespace keyboardinput
+{
+/*!
+   \brief The org.mpris.MediaPlayer2.Player interface of one player.
+
+   Unlike QDBusInterface it doesn't introspect the player, so creating one
+   never waits for the bus.
+ */
+class MprisPlayer : public QDBusAbstractInterface
+{
+public:
+    MprisPlayer( const QString& service,
+                 const QDBusConnection& connection,
+                 QObject* parent = nullptr )
+        : QDBusAbstractInterface( service,
+                                  "/org/mpris/MediaPlayer2",
+                                  "org.mpris.MediaPlayer2.Player",
+                                  connection,
+                                  parent )
+    {
+    }
+};
+
+/*!
+   \brief Keeps the MPRIS players of a bus, an interface for each of them
+   and what they are playing, and picks the one commands go to.
+
+   The players are listed once and then followed through the bus'
+   NameOwnerChanged signal, their state through PropertiesChanged and
+   Seeked. Nothing waits for a reply, so the registry can be used from the
+   GUI thread.
+ */
+class MprisPlayerRegistry : public QObject, protected QDBusContext
+{
+    Q_OBJECT
+
+public:
+    static constexpr const char* k_servicePrefix = "org.mpris.MediaPlayer2.";
+
+    explicit MprisPlayerRegistry( const QDBusConnection& connection,
+                                  QObject* parent = nullptr );
+
+    /*!
+       \brief Bus names of the known players, sorted.
+     */
+    QStringList players() const;
+
+    /*!
+       \brief True once the players that existed at construction are known.
+     */
+    bool isReady() const noexcept;
+
+    /*!
+       \brief Name of a player without the prefix, like "vlc.instance42".
+     */
+    static QString shortName( const QString& player );
+
+    /*!
+       \brief Name of a player without the prefix and instance suffix, the
+       same for every instance of an application.
+     */
+    static QString applicationName( const QString& player );
+
+    /*!
+       \brief Makes \a player the active player until it closes. Empty to
+       unpin.
+     */
+    void pinPlayer( const QString& player );
+
+    QString pinnedPlayer() const;
+
+    /*!
+       \brief Prefers players of the application \a name, like "vlc",
+       over others. Empty for no preference.
+     */
+    void setPreferredApplication( const QString& name );
+
+    /*!
+       \brief The player commands go to.
+
+       The pinned player, else of the players of the preferred application,
+       else of all players, the one that started playing last. The first
+       player if none played yet, empty without players.
+     */
+    QString activePlayer() const;
+
+    /*!
+       \brief What the active player is playing.
+     */
+    NowPlayingState nowPlaying() const;
+
+    /*!
+       \brief Calls \a method on the active player without waiting for the
+       reply.
+
+       Calls made before the registry is ready are sent once it is.
+     */
+    void callActive( const QString& method );
+
+signals:
+    void playersChanged();
+
+    /*!
+       \brief The active player, or what it plays, may have changed.
+     */
+    void nowPlayingChanged();
+
+private slots:
+    void onNameOwnerChanged( const QString& name,
+                             const QString& oldOwner,
+                             const QString& newOwner );
+    void onPropertiesChanged( const QString& interface,
+                              const QVariantMap& changed,
+                              const QStringList& invalidated );
+    void onSeeked( qlonglong positionUs );
+
+private:
+    struct Player
+    {
+        std::unique_ptr<MprisPlayer> interface;
+        // Unique name of the connection, signals are sent from it.
+        QString owner;
+        NowPlayingState state;
+        // Order in which players started playing, 0 if it never did.
+        std::uint64_t startedPlaying = 0;
+    };
+
+    void onPlayersListed( const QStringList& names );
+    bool addPlayer( const QString& name, const QString& owner );
+    void fetchProperties( const QString& name );
+    void updatePlayer( const QString& name, const QVariantMap& properties );
+    std::map<QString, Player>::iterator findOwner( const QString& owner );
+    template <typename Predicate>
+    QString lastStartedPlaying( Predicate predicate ) const;
+    void call( const QString& name,
+               MprisPlayer& player,
+               const QString& method );
+
+    QDBusConnection m_connection;
+    std::map<QString, Player> m_players;
+    std::uint64_t m_playingCount = 0;
+    QString m_pinnedPlayer;
+    QString m_preferredApplication;
+    bool m_ready = false;
+    QStringList m_pendingCalls;
+};
+
+} // namespace keyboardinput
@@ -0,0 +1,146 @@
+#pragma once
+#include <QObject>
+#include <QString>
+#include <QStringList>
+
+namespace keyboardinput
+{
+/*!
+   \brief What a media player reports about its current track.
+
+   Times are in microseconds, like MPRIS reports them.
+ */
+struct NowPlayingState
+{
+    QString player;
+    QString title;
+    QString artist;
+    QString playbackStatus;
+    qint64 positionUs = 0;
+    qint64 lengthUs = 0;
+
+    bool operator==( const NowPlayingState& other ) const noexcept
+    {
+        return player == other.player && title == other.title
+               && artist == other.artist
+               && playbackStatus == other.playbackStatus
+               && positionUs == other.positionUs
+               && lengthUs == other.lengthUs;
+    }
+
+    bool operator!=( const NowPlayingState& other ) const noexcept
+    {
+        return !( *this == other );
+    }
+};
+
+/*!
+   \brief The track of the active media player and the players to choose
+   from, for QML.
+
+   Set by the media keys backend when a player reports a change, signals
+   are only emitted when a value differs. Players don't report progress,
+   the position is the one of the last change or seek.
+ */
+class NowPlaying : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY( QString player READ player NOTIFY changed )
+    Q_PROPERTY( QString title READ title NOTIFY changed )
+    Q_PROPERTY( QString artist READ artist NOTIFY changed )
+    Q_PROPERTY( QString playbackStatus READ playbackStatus NOTIFY changed )
+    Q_PROPERTY( double position READ position NOTIFY changed )
+    Q_PROPERTY( double length READ length NOTIFY changed )
+    Q_PROPERTY( QStringList players READ players NOTIFY playersChanged )
+    Q_PROPERTY( QString pinnedPlayer READ pinnedPlayer NOTIFY playersChanged )
+
+public:
+    using QObject::QObject;
+
+    const NowPlayingState& state() const noexcept
+    {
+        return m_state;
+    }
+
+    void setState( const NowPlayingState& state )
+    {
+        if ( state != m_state )
+        {
+            m_state = state;
+            emit changed();
+        }
+    }
+
+    void setPlayers( const QStringList& players, const QString& pinnedPlayer )
+    {
+        if ( players != m_players || pinnedPlayer != m_pinnedPlayer )
+        {
+            m_players = players;
+            m_pinnedPlayer = pinnedPlayer;
+            emit playersChanged();
+        }
+    }
+
+    QString player() const
+    {
+        return m_state.player;
+    }
+
+    QString title() const
+    {
+        return m_state.title;
+    }
+
+    QString artist() const
+    {
+        return m_state.artist;
+    }
+
+    QString playbackStatus() const
+    {
+        return m_state.playbackStatus;
+    }
+
+    /*!
+       \brief Position in the track, in seconds.
+     */
+    double position() const noexcept
+    {
+        return static_cast<double>( m_state.positionUs ) / 1e6;
+    }
+
+    /*!
+       \brief Length of the track in seconds, 0 if it is unknown.
+     */
+    double length() const noexcept
+    {
+        return static_cast<double>( m_state.lengthUs ) / 1e6;
+    }
+
+    /*!
+       \brief Names of the running players, in the form of \c player.
+     */
+    QStringList players() const
+    {
+        return m_players;
+    }
+
+    /*!
+       \brief The player media keys are pinned to, empty if none is.
+     */
+    QString pinnedPlayer() const
+    {
+        return m_pinnedPlayer;
+    }
+
+signals:
+    void changed();
+    void playersChanged();
+
+private:
+    NowPlayingState m_state;
+    QStringList m_players;
+    QString m_pinnedPlayer;
+};
+
+} // namespace keyboardinput
@@ -15,13 +15,72 @@
 #include <QCursor>
 #include <QProcess>
 #include <QMessageBox>
+#include <QSaveFile>
 #include <iostream>
 #include <cmath>
 #include <openvr.h>
 #include <easylogging++.h>
 #include "utils/Matrix.h"
-#include "keyboard_input/input_sender.h"
+#include "utils/FrameRateUtils.h"
+#include "utils/StartupProfiler.h"
+#include "keyboard_input/keyboard_input.h"
+#include "media_keys/media_keys.h"
 #include "settings/settings.h"
+#include "settings/settings_snapshot.h"
+
+namespace
+{
+QVariant toQVariant( const utils::VRSettingValue& value )
+{
+    return std::visit(
+        []( const auto& v ) {
+            using Value = std::decay_t<decltype( v )>;
+            if constexpr ( std::is_same<std::string, Value>::value )
+            {
+                return QVariant( QString::fromStdString( v ) );
+            }
+            else
+            {
+                return QVariant( v );
+            }
+        },
+        value );
+}
+
+std::optional<utils::VRSettingValue>
+    toVRSettingValue( const QVariant& value, const utils::VRSettingType type )
+{
+    switch ( type )
+    {
+    case utils::VRSettingType::Bool:
+        if ( value.canConvert<bool>() )
+        {
+            return value.toBool();
+        }
+        break;
+    case utils::VRSettingType::Int32:
+        if ( value.canConvert<int>() )
+        {
+            return value.toInt();
+        }
+        break;
+    case utils::VRSettingType::Float:
+        if ( value.canConvert<float>() )
+        {
+            return value.toFloat();
+        }
+        break;
+    case utils::VRSettingType::String:
+        if ( value.canConvert<QString>() )
+        {
+            return value.toString().toStdString();
+        }
+        break;
+    }
+    return std::nullopt;
+}
+
+} // namespace
 
 // application namespace
 namespace advsettings
@@ -69,50 +128,10 @@ OverlayController::OverlayController( bool desktopMode,
     m_runtimePathUrl = QUrl::fromLocalFile( tempRuntimePath );
     LOG( INFO ) << "VR Runtime Path: " << m_runtimePathUrl.toLocalFile();
 
-    QString activationSoundFile = m_runtimePathUrl.toLocalFile().append(
-        "/content/panorama/sounds/activation.wav" );
-    QFileInfo activationSoundFileInfo( activationSoundFile );
-    if ( activationSoundFileInfo.exists() && activationSoundFileInfo.isFile() )
-    {
-        m_activationSoundEffect.setSource(
-            QUrl::fromLocalFile( activationSoundFile ) );
-        m_activationSoundEffect.setVolume( 1.0 );
-    }
-    else
-    {
-        LOG( ERROR ) << "Could not find activation sound file "
-                     << activationSoundFile;
-    }
-
-    QString focusChangedSoundFile = m_runtimePathUrl.toLocalFile().append(
-        "/content/panorama/sounds/focus_change.wav" );
-    QFileInfo focusChangedSoundFileInfo( focusChangedSoundFile );
-    if ( focusChangedSoundFileInfo.exists()
-         && focusChangedSoundFileInfo.isFile() )
-    {
-        m_focusChangedSoundEffect.setSource(
-            QUrl::fromLocalFile( focusChangedSoundFile ) );
-        m_focusChangedSoundEffect.setVolume( 1.0 );
-    }
-    else
-    {
-        LOG( ERROR ) << "Could not find focus changed sound file "
-                     << focusChangedSoundFile;
-    }
-
-    constexpr auto alarmFileName = "res/sounds/alarm01.wav";
-    const auto alarm01SoundFile
-        = paths::binaryDirectoryFindFile( alarmFileName );
-
-    if ( alarm01SoundFile.has_value() )
-    {
-        m_alarm01SoundEffect.setSource( QUrl::fromLocalFile(
-            QString::fromStdString( ( *alarm01SoundFile ) ) ) );
-        m_alarm01SoundEffect.setVolume( 1.0 );
-    }
-    else
+    if ( !m_noSound )
     {
-        LOG( ERROR ) << "Could not find alarm01 sound file " << alarmFileName;
+        m_deferredInit.emplace_back( "sound effects",
+                                     [this] { loadSoundEffects(); } );
     }
 
     QSurfaceFormat format;
@@ -144,14 +163,19 @@ OverlayController::OverlayController( bool desktopMode,
         throw std::runtime_error( std::string( "No Overlay interface" ) );
     }
 
+    m_vrSettingsCache.setPollIntervals(
+        utils::adjustUpdateRate( k_vrSettingsMinPollCounter ),
+        utils::adjustUpdateRate( k_vrSettingsMaxPollCounter ) );
+
     // Init controllers
-    m_steamVRTabController.initStage1();
     m_chaperoneTabController.initStage1();
     m_moveCenterTabController.initStage1();
-    m_audioTabController.initStage1();
     m_settingsTabController.initStage1();
     m_utilitiesTabController.initStage1();
-    m_videoTabController.initStage1();
+    m_videoTabController.initStage1( m_vrSettingsCache );
+
+    subscribeToSettings();
+    settings::watchSettingsFile();
 
     // init action handles
 
@@ -298,24 +322,127 @@ OverlayController::OverlayController( bool desktopMode,
 
     if ( !disableVersionCheck() )
     {
-        QNetworkRequest netRequest;
-        netRequest.setUrl( QUrl( application_strings::versionCheckUrl ) );
-        netManager->get( netRequest );
+        m_deferredInit.emplace_back( "version check",
+                                     [this] { checkForNewVersion(); } );
     }
     else
     {
         LOG( INFO ) << "Version Check: Feature disabled. Not checking version.";
     }
 
+    m_deferredInit.emplace_back( "keyboard input", [] {
+        keyboardinput::prepareKeyboardInput();
+    } );
+
+    m_deferredInit.emplace_back( "media keys", [] {
+        keyboardinput::prepareMediaKeys();
+    } );
+
+    // Enumerating the audio devices can take a long time, the audio tab
+    // updates itself once they are known.
+    m_deferredInit.emplace_back( "audio devices", [this] {
+        m_audioTabController.initStage1();
+        m_audioTabController.initStage2( this );
+    } );
+
     LOG( INFO ) << "OPENSSL VERSION: "
                 << QSslSocket::sslLibraryBuildVersionString();
 }
 
+void OverlayController::loadSoundEffects()
+{
+    QString activationSoundFile = m_runtimePathUrl.toLocalFile().append(
+        "/content/panorama/sounds/activation.wav" );
+    QFileInfo activationSoundFileInfo( activationSoundFile );
+    if ( activationSoundFileInfo.exists() && activationSoundFileInfo.isFile() )
+    {
+        m_activationSoundEffect.setSource(
+            QUrl::fromLocalFile( activationSoundFile ) );
+        m_activationSoundEffect.setVolume( 1.0 );
+    }
+    else
+    {
+        LOG( ERROR ) << "Could not find activation sound file "
+                     << activationSoundFile;
+    }
+
+    QString focusChangedSoundFile = m_runtimePathUrl.toLocalFile().append(
+        "/content/panorama/sounds/focus_change.wav" );
+    QFileInfo focusChangedSoundFileInfo( focusChangedSoundFile );
+    if ( focusChangedSoundFileInfo.exists()
+         && focusChangedSoundFileInfo.isFile() )
+    {
+        m_focusChangedSoundEffect.setSource(
+            QUrl::fromLocalFile( focusChangedSoundFile ) );
+        m_focusChangedSoundEffect.setVolume( 1.0 );
+    }
+    else
+    {
+        LOG( ERROR ) << "Could not find focus changed sound file "
+                     << focusChangedSoundFile;
+    }
+
+    constexpr auto alarmFileName = "res/sounds/alarm01.wav";
+    const auto alarm01SoundFile
+        = paths::binaryDirectoryFindFile( alarmFileName );
+
+    if ( alarm01SoundFile.has_value() )
+    {
+        m_alarm01SoundEffect.setSource( QUrl::fromLocalFile(
+            QString::fromStdString( ( *alarm01SoundFile ) ) ) );
+        m_alarm01SoundEffect.setVolume( 1.0 );
+    }
+    else
+    {
+        LOG( ERROR ) << "Could not find alarm01 sound file " << alarmFileName;
+    }
+}
+
 OverlayController::~OverlayController()
 {
+    for ( const auto id : m_settingSubscriptions )
+    {
+        settings::unsubscribe( id );
+    }
     Shutdown();
 }
 
+/*!
+Keeps state derived from our own settings and the QML properties backed by
+them up to date, no matter where the setting was changed.
+*/
+void OverlayController::subscribeToSettings()
+{
+    m_chaperoneReloadDebounceTicks = settings::getSetting(
+        settings::IntSetting::CHAPERONE_reloadDebounceTicks );
+
+    m_settingSubscriptions = {
+        settings::subscribe(
+            settings::IntSetting::CHAPERONE_reloadDebounceTicks,
+            [this]( int value ) { m_chaperoneReloadDebounceTicks = value; } ),
+        settings::subscribe(
+            settings::IntSetting::APPLICATION_customTickRateMs,
+            [this]( int value ) {
+                m_verifiedCustomTickRateMs = verifyCustomTickRate( value );
+                emit customTickRateMsChanged( m_verifiedCustomTickRateMs );
+            } ),
+        settings::subscribe(
+            settings::BoolSetting::APPLICATION_crashRecoveryDisabled,
+            [this]( bool value ) {
+                emit crashRecoveryDisabledChanged( value );
+            } ),
+        settings::subscribe(
+            settings::BoolSetting::APPLICATION_vsyncDisabled,
+            [this]( bool value ) { emit vsyncDisabledChanged( value ); } ),
+        settings::subscribe(
+            settings::BoolSetting::APPLICATION_enableDebug,
+            [this]( bool value ) { emit enableDebugChanged( value ); } ),
+        settings::subscribe(
+            settings::IntSetting::APPLICATION_debugState,
+            [this]( int value ) { emit debugStateChanged( value ); } ),
+    };
+}
+
 void OverlayController::Shutdown()
 {
     disconnect( &m_pumpEventsTimer,
@@ -343,6 +470,16 @@ void OverlayController::Shutdown()
     }
     m_pFbo.reset();
 
+    m_utilitiesTabController.closeAlarmMessage();
+    m_scheduler.stop();
+
+    m_vrSettingsCache.flushWrites();
+    LOG( INFO ) << "SteamVR settings runtime reads: "
+                << m_vrSettingsCache.runtimeReads()
+                << ", writes: " << m_vrSettingsCache.runtimeWrites()
+                << ", coalesced writes: "
+                << m_vrSettingsCache.coalescedWrites();
+
     // save to settings that shutdown was safe
     setPreviousShutdownSafe( true );
 }
@@ -450,11 +587,11 @@ void OverlayController::SetWidget( QQuickItem* quickItem,
     m_steamVRTabController.initStage2( this );
     m_chaperoneTabController.initStage2( this );
     m_fixFloorTabController.initStage2( this );
-    m_audioTabController.initStage2();
     m_statisticsTabController.initStage2( this );
     m_settingsTabController.initStage2( this );
     m_utilitiesTabController.initStage2( this );
     m_moveCenterTabController.initStage2( this );
+    m_videoTabController.initStage2( this );
 }
 
 void OverlayController::OnRenderRequest()
@@ -592,7 +729,7 @@ void OverlayController::processChaperoneBindings()
     if ( m_actions.chaperoneToggle() )
     {
         m_chaperoneTabController.setDisableChaperone(
-            !( m_chaperoneTabController.disableChaperone() ), true );
+            !( m_chaperoneTabController.disableChaperone() ) );
     }
     m_chaperoneTabController.setProxState( m_actions.proxState() );
     m_chaperoneTabController.addLeftHapticClick(
@@ -646,28 +783,52 @@ void OverlayController::processKeyboardBindings()
 {
     if ( m_actions.keyboardOne() )
     {
-        const auto commands = settings::getSetting(
-            settings::StringSetting::KEYBOARDSHORTCUT_keyboardOne );
-
-        sendStringAsInput( commands );
+        m_utilitiesTabController.sendKeyboardOne();
     }
 
     if ( m_actions.keyboardTwo() )
     {
-        const auto commands = settings::getSetting(
-            settings::StringSetting::KEYBOARDSHORTCUT_keyboardTwo );
-
-        sendStringAsInput( commands );
+        m_utilitiesTabController.sendKeyboardTwo();
     }
 
     if ( m_actions.keyboardThree() )
     {
-        const auto commands = settings::getSetting(
-            settings::StringSetting::KEYBOARDSHORTCUT_keyboardThree );
+        m_utilitiesTabController.sendKeyboardThree();
+    }
+}
+/*!
+Runs the next piece of non-critical startup work. Only one is run per tick so
+the overlay stays responsive while they are worked through.
+*/
+void OverlayController::runDeferredInit()
+{
+    if ( m_deferredInit.empty() )
+    {
+        return;
+    }
+
+    const auto [name, task] = std::move( m_deferredInit.front() );
+    m_deferredInit.pop_front();
+
+    auto& profiler = utils::startupProfiler();
+    const auto start = utils::StartupProfiler::Clock::now();
+    task();
+    profiler.deferred( name, utils::StartupProfiler::Clock::now() - start );
+
+    if ( m_deferredInit.empty() )
+    {
+        LOG( INFO ) << "Deferred startup: " << profiler.deferredReport();
+    }
+}
 
-        sendStringAsInput( commands );
+void OverlayController::finishDeferredInit()
+{
+    while ( !m_deferredInit.empty() )
+    {
+        runDeferredInit();
     }
 }
+
 /*!
 Checks if an action has been activated and dispatches the related action if it
 has been.
@@ -691,14 +852,10 @@ bool OverlayController::crashRecoveryDisabled() const
         settings::BoolSetting::APPLICATION_crashRecoveryDisabled );
 }
 
-void OverlayController::setCrashRecoveryDisabled( bool value, bool notify )
+void OverlayController::setCrashRecoveryDisabled( bool value )
 {
     settings::setSetting(
         settings::BoolSetting::APPLICATION_crashRecoveryDisabled, value );
-    if ( notify )
-    {
-        emit crashRecoveryDisabledChanged( value );
-    }
 }
 
 bool OverlayController::vsyncDisabled() const
@@ -707,14 +864,10 @@ bool OverlayController::vsyncDisabled() const
         settings::BoolSetting::APPLICATION_vsyncDisabled );
 }
 
-void OverlayController::setVsyncDisabled( bool value, bool notify )
+void OverlayController::setVsyncDisabled( bool value )
 {
     settings::setSetting( settings::BoolSetting::APPLICATION_vsyncDisabled,
                           value );
-    if ( notify )
-    {
-        emit vsyncDisabledChanged( value );
-    }
 }
 
 bool OverlayController::enableDebug() const
@@ -723,14 +876,10 @@ bool OverlayController::enableDebug() const
         settings::BoolSetting::APPLICATION_enableDebug );
 }
 
-void OverlayController::setEnableDebug( bool value, bool notify )
+void OverlayController::setEnableDebug( bool value )
 {
     settings::setSetting( settings::BoolSetting::APPLICATION_enableDebug,
                           value );
-    if ( notify )
-    {
-        emit enableDebugChanged( value );
-    }
 }
 
 bool OverlayController::disableVersionCheck() const
@@ -739,13 +888,18 @@ bool OverlayController::disableVersionCheck() const
         settings::BoolSetting::APPLICATION_disableVersionCheck );
 }
 
+void OverlayController::checkForNewVersion()
+{
+    QNetworkRequest netRequest;
+    netRequest.setUrl( QUrl( application_strings::versionCheckUrl ) );
+    netManager->get( netRequest );
+}
+
 void OverlayController::setDisableVersionCheck( bool value, bool notify )
 {
     if ( !value )
     {
-        QNetworkRequest netRequest;
-        netRequest.setUrl( QUrl( application_strings::versionCheckUrl ) );
-        netManager->get( netRequest );
+        checkForNewVersion();
     }
     settings::setSetting(
         settings::BoolSetting::APPLICATION_disableVersionCheck, value );
@@ -793,14 +947,9 @@ int OverlayController::debugState() const
     return settings::getSetting( settings::IntSetting::APPLICATION_debugState );
 }
 
-void OverlayController::setDebugState( int value, bool notify )
+void OverlayController::setDebugState( int value )
 {
     settings::setSetting( settings::IntSetting::APPLICATION_debugState, value );
-
-    if ( notify )
-    {
-        emit debugStateChanged( value );
-    }
 }
 
 void OverlayController::setPreviousShutdownSafe( bool value )
@@ -814,18 +963,10 @@ int OverlayController::customTickRateMs() const
     return m_verifiedCustomTickRateMs;
 }
 
-void OverlayController::setCustomTickRateMs( int value, bool notify )
+void OverlayController::setCustomTickRateMs( int value )
 {
-    const auto verifiedTickRate = verifyCustomTickRate( value );
-
     settings::setSetting( settings::IntSetting::APPLICATION_customTickRateMs,
-                          verifiedTickRate );
-    m_verifiedCustomTickRateMs = verifiedTickRate;
-
-    if ( notify )
-    {
-        emit customTickRateMsChanged( verifiedTickRate );
-    }
+                          verifyCustomTickRate( value ) );
 }
 
 // vsync implementation:
@@ -882,17 +1023,52 @@ void OverlayController::OnTimeoutPumpEvents()
     }
 }
 
+void OverlayController::handleChaperoneDataChanged()
+{
+    if ( !m_chaperoneReloadPending )
+    {
+        return;
+    }
+    const auto maxWaitTicks
+        = m_chaperoneReloadDebounceTicks * k_chaperoneReloadMaxWaitFactor;
+    if ( m_chaperoneReloadDebounceCounter++ < m_chaperoneReloadDebounceTicks
+         && m_chaperoneReloadWaitCounter++ < maxWaitTicks )
+    {
+        return;
+    }
+    m_chaperoneReloadPending = false;
+    m_chaperoneReloadWaitCounter = 0;
+
+    m_chaperoneUtils.loadChaperoneData();
+    m_moveCenterTabController.chaperoneDataReloaded();
+    m_chaperoneTabController.chaperoneDataReloaded();
+
+    LOG( INFO ) << "Reloaded chaperone data, " << m_chaperoneReloadsAvoided
+                << " redundant reloads avoided so far.";
+}
+
 void OverlayController::mainEventLoop()
 {
     if ( !vr::VRSystem() )
         return;
 
+    auto& profiler = utils::startupProfiler();
+    if ( !profiler.finished() )
+    {
+        profiler.finish( "first tick" );
+        LOG( INFO ) << "Startup: " << profiler.report();
+    }
+    else
+    {
+        runDeferredInit();
+    }
+
     m_actions.UpdateStates();
 
     processInputBindings();
 
     vr::VREvent_t vrEvent;
-    bool chaperoneDataAlreadyUpdated = false;
+    bool chaperoneDataChanged = false;
     while ( pollNextEvent( m_ulOverlayHandle, &vrEvent ) )
     {
         switch ( vrEvent.eventType )
@@ -1002,6 +1178,7 @@ void OverlayController::mainEventLoop()
         {
             LOG( DEBUG ) << "Dashboard activated";
             m_dashboardVisible = true;
+            m_vrSettingsCache.requestPoll();
         }
         break;
 
@@ -1031,10 +1208,10 @@ void OverlayController::mainEventLoop()
         break;
 
         // Multiple ChaperoneUniverseHasChanged are often emitted at the
-        // same time (some with a little bit of delay) There is no sure way
-        // to recognize redundant events, we can only exclude redundant
-        // events during the same call of OnTimeoutPumpEvents() INFO Removed
-        // logging on play space mover for possible crashing issues.
+        // same time, some with a little bit of delay. There is no sure way
+        // to recognize redundant events, so the reload is debounced across
+        // ticks in handleChaperoneDataChanged(). INFO Removed logging on
+        // play space mover for possible crashing issues.
         case vr::VREvent_ChaperoneUniverseHasChanged:
         {
             uint64_t previousUniverseId
@@ -1044,43 +1221,36 @@ void OverlayController::mainEventLoop()
             LOG( INFO ) << "(VREvent) ChaperoneUniverseHasChanged... Previous:"
                         << previousUniverseId
                         << " Current:" << currentUniverseId;
-
-            if ( !chaperoneDataAlreadyUpdated )
-            {
-                // LOG(INFO) << "Re-loading chaperone data ...";
-                m_chaperoneUtils.loadChaperoneData();
-                // LOG(INFO) << "Found " << m_chaperoneUtils.quadsCount() <<
-                // " chaperone quads."; if
-                // (m_chaperoneUtils.isChaperoneWellFormed()) { LOG(INFO) <<
-                // "Chaperone data seems to be well-formed.";
-                //} else {
-                // LOG(INFO) << "Chaperone data is NOT well-formed.";
-                //}
-                chaperoneDataAlreadyUpdated = true;
-            }
+            chaperoneDataChanged = true;
         }
         break;
 
+        // Room setup and calibration changes. These are also what ends
+        // ChaperoneUtils' wait for collision bounds to become available.
+        case vr::VREvent_ChaperoneRoomSetupFinished:
+        case vr::VREvent_ChaperoneFlushCache:
         case vr::VREvent_ChaperoneDataHasChanged:
         {
-            if ( !chaperoneDataAlreadyUpdated )
-            {
-                // LOG(INFO) << "Re-loading chaperone data ...";
-                m_chaperoneUtils.loadChaperoneData();
-                // LOG(INFO) << "Found " << m_chaperoneUtils.quadsCount() <<
-                // " chaperone quads."; if
-                // (m_chaperoneUtils.isChaperoneWellFormed()) { LOG(INFO) <<
-                // "Chaperone data seems to be well-formed.";
-                //} else {
-                // LOG(INFO) << "Chaperone data is NOT well-formed.";
-                //}
-                chaperoneDataAlreadyUpdated = true;
-            }
+            chaperoneDataChanged = true;
         }
         break;
         }
     }
 
+    if ( chaperoneDataChanged )
+    {
+        if ( m_chaperoneReloadPending )
+        {
+            m_chaperoneReloadsAvoided++;
+        }
+        // Trailing edge, every new event restarts the window. The wait
+        // since the first event is capped in handleChaperoneDataChanged().
+        m_chaperoneReloadPending = true;
+        m_chaperoneReloadDebounceCounter = 0;
+        m_chaperoneUtils.chaperoneEventReceived();
+    }
+    handleChaperoneDataChanged();
+
     vr::TrackedDevicePose_t devicePoses[vr::k_unMaxTrackedDeviceCount];
     vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(
         vr::TrackingUniverseStanding,
@@ -1121,13 +1291,12 @@ void OverlayController::mainEventLoop()
         devicePoses, leftSpeed, rightSpeed );
     m_chaperoneTabController.eventLoopTick( devicePoses );
     m_audioTabController.eventLoopTick();
+    m_vrSettingsCache.tick();
 
     if ( vr::VROverlay()->IsDashboardVisible() )
     {
         m_settingsTabController.dashboardLoopTick();
-        m_steamVRTabController.dashboardLoopTick();
         m_fixFloorTabController.dashboardLoopTick( devicePoses );
-        m_videoTabController.dashboardLoopTick();
     }
 
     if ( m_ulOverlayThumbnailHandle != vr::k_ulOverlayHandleInvalid )
@@ -1365,6 +1534,95 @@ void OverlayController::RotateCollisionBounds( float angle, bool commit )
     }
 }
 
+bool OverlayController::exportSnapshot( const QString& fileName )
+{
+    auto snapshot = settings::createSnapshot();
+    for ( const auto& e : m_vrSettingsCache.watchedValues() )
+    {
+        snapshot.runtimeSettings.push_back(
+            { e.section, e.key, toQVariant( e.value ) } );
+    }
+
+    QSaveFile file( fileName );
+    if ( !file.open( QIODevice::WriteOnly )
+         || file.write( settings::encodeSnapshot( snapshot ) ) < 0
+         || !file.commit() )
+    {
+        LOG( ERROR ) << "Could not write settings snapshot '"
+                     << fileName.toStdString()
+                     << "': " << file.errorString().toStdString();
+        return false;
+    }
+
+    LOG( INFO ) << "Exported settings snapshot to '" << fileName.toStdString()
+                << "': " << snapshot.settings.size() << " settings, "
+                << snapshot.profiles.size() << " profile lists, "
+                << snapshot.runtimeSettings.size() << " SteamVR settings.";
+    return true;
+}
+
+bool OverlayController::importSnapshot( const QString& fileName )
+{
+    QFile file( fileName );
+    if ( !file.open( QIODevice::ReadOnly ) )
+    {
+        LOG( ERROR ) << "Could not read settings snapshot '"
+                     << fileName.toStdString()
+                     << "': " << file.errorString().toStdString();
+        return false;
+    }
+
+    const auto snapshot = settings::decodeSnapshot( file.readAll() );
+    if ( !snapshot )
+    {
+        return false;
+    }
+
+    auto changes = settings::applySnapshot( *snapshot );
+    if ( !changes )
+    {
+        LOG( ERROR ) << "Settings snapshot '" << fileName.toStdString()
+                     << "' was not applied.";
+        return false;
+    }
+
+    std::map<std::pair<std::string, std::string>, utils::VRSettingType>
+        watchedTypes;
+    for ( const auto& e : m_vrSettingsCache.watchedValues() )
+    {
+        watchedTypes.emplace( std::make_pair( e.section, e.key ), e.type );
+    }
+
+    m_vrSettingsCache.flushWrites();
+    const auto writesBefore = m_vrSettingsCache.runtimeWrites();
+    for ( const auto& v : snapshot->runtimeSettings )
+    {
+        const auto type = watchedTypes.find( { v.group, v.key } );
+        if ( type == watchedTypes.end() )
+        {
+            continue;
+        }
+        if ( const auto value = toVRSettingValue( v.value, type->second ) )
+        {
+            m_vrSettingsCache.set( v.group, v.key, *value );
+        }
+    }
+    m_vrSettingsCache.flushWrites();
+    changes->runtimeSettings = static_cast<int>(
+        m_vrSettingsCache.runtimeWrites() - writesBefore );
+
+    LOG( INFO ) << "Imported settings snapshot '" << fileName.toStdString()
+                << "': changed " << changes->settings << " settings, "
+                << changes->profiles << " profiles, "
+                << changes->runtimeSettings << " SteamVR settings. "
+                << changes->unknownSettings << " unknown settings skipped.";
+    // Video and chaperone settings are applied by their subscriptions. The
+    // playspace motion reads its settings on every frame, only the controls
+    // of its page keep their values until they are loaded again.
+    LOG( INFO ) << "Playspace page shows imported settings after a restart.";
+    return true;
+}
+
 bool OverlayController::isPreviousShutdownSafe()
 {
     return settings::getSetting(
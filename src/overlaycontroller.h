@@ -23,12 +23,18 @@
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QNetworkRequest>
+#include <deque>
+#include <functional>
 #include <memory>
 #include <easylogging++.h>
 
+#include "application_strings.h"
 #include "openvr/openvr_init.h"
 
 #include "utils/ChaperoneUtils.h"
+#include "utils/VRSettingsCache.h"
+#include "utils/TaskScheduler.h"
+#include "settings/settings.h"
 
 #include "tabcontrollers/SteamVRTabController.h"
 #include "tabcontrollers/ChaperoneTabController.h"
@@ -42,20 +48,6 @@
 
 #include "openvr/ivrinput.h"
 
-namespace application_strings
-{
-constexpr auto applicationOrganizationName = "AdvancedSettings-Team";
-constexpr auto applicationName = "OVR Advanced Settings";
-constexpr const char* applicationKey = "steam.overlay.1009850";
-constexpr const char* applicationDisplayName = "OVR Advanced Settings";
-constexpr const char* versionCheckUrl
-    = "https://raw.githubusercontent.com/OpenVR-Advanced-Settings/"
-      "OpenVR-AdvancedSettings/master/ver/versioncheck.json";
-
-constexpr const char* applicationVersionString = APPLICATION_VERSION;
-
-} // namespace application_strings
-
 // application namespace
 namespace advsettings
 {
@@ -66,15 +58,14 @@ namespace advsettings
 // Values chosen based on update speed priority
 // Avoid setting values to the same numbers.
 constexpr int k_audioSettingsUpdateCounter = 89;
-constexpr int k_chaperoneSettingsUpdateCounter = 101;
 constexpr int k_moveCenterSettingsUpdateCounter = 83;
 constexpr int k_settingsTabSettingsUpdateCounter = 157;
-constexpr int k_steamVrSettingsUpdateCounter = 97;
 constexpr int k_utilitiesSettingsUpdateCounter = 19;
 
-// Dashboard Updates These can be faster as they should only be running while
-// Dashboard is active.
-constexpr int k_videoDashboardUpdateCounter = 47;
+// SteamVR settings are polled by the VRSettingsCache. The interval starts at
+// the minimum and backs off to the maximum while nothing changes.
+constexpr int k_vrSettingsMinPollCounter = 97;
+constexpr int k_vrSettingsMaxPollCounter = 97 * 8;
 
 // k_nonVsyncTickRate determines number of ms we wait to force the next event
 // loop tick when vsync is too late due to dropped frames.
@@ -138,10 +129,28 @@ class OverlayController : public QObject
     QUrl m_runtimePathUrl;
 
     utils::ChaperoneUtils m_chaperoneUtils;
+    utils::VRSettingsCache m_vrSettingsCache{
+        std::make_unique<utils::OpenVRSettingsBackend>()
+    };
+    int m_chaperoneReloadDebounceTicks = 0;
+    bool m_chaperoneReloadPending = false;
+    int m_chaperoneReloadDebounceCounter = 0;
+    // Ticks since the first event of a pending reload. Events that keep
+    // coming would otherwise postpone the reload forever.
+    int m_chaperoneReloadWaitCounter = 0;
+    static constexpr int k_chaperoneReloadMaxWaitFactor = 4;
+    unsigned long long m_chaperoneReloadsAvoided = 0;
+    void handleChaperoneDataChanged();
 
     QSoundEffect m_activationSoundEffect;
     QSoundEffect m_focusChangedSoundEffect;
     QSoundEffect m_alarm01SoundEffect;
+    void loadSoundEffects();
+
+    // Startup work that is not needed for the first tick, run one task per
+    // tick afterwards.
+    std::deque<std::pair<const char*, std::function<void()>>> m_deferredInit;
+    void runDeferredInit();
 
     uint64_t m_currentFrame = 0;
     uint64_t m_lastFrame = 0;
@@ -151,9 +160,13 @@ class OverlayController : public QObject
 
     input::SteamIVRInput m_actions;
 
+    std::vector<settings::SubscriptionId> m_settingSubscriptions;
+    void subscribeToSettings();
+
     QNetworkAccessManager* netManager = new QNetworkAccessManager( this );
     QJsonDocument m_remoteVersionJsonDocument = QJsonDocument();
     QJsonObject m_remoteVersionJsonObject;
+    void checkForNewVersion();
 
 public: // I know it's an ugly hack to make them public to enable external
         // access, but I am too lazy to implement getters.
@@ -168,6 +181,10 @@ class OverlayController : public QObject
     VideoTabController m_videoTabController;
 
 private:
+    // After the tab controllers, stopped before their tasks could outlive
+    // them.
+    utils::TaskScheduler m_scheduler;
+
     QPoint getMousePositionForEvent( vr::VREvent_Mouse_t mouse );
     void processInputBindings();
     void processMediaKeyBindings();
@@ -224,6 +241,26 @@ class OverlayController : public QObject
         return m_chaperoneUtils;
     }
 
+    utils::VRSettingsCache& vrSettingsCache() noexcept
+    {
+        return m_vrSettingsCache;
+    }
+
+    // Timers and blocking runtime calls, instead of threads of their own.
+    utils::TaskScheduler& scheduler() noexcept
+    {
+        return m_scheduler;
+    }
+
+    // Runs the startup work that is left at once. Snapshots from the
+    // command line need it, some SteamVR settings are only watched after.
+    void finishDeferredInit();
+
+    // Settings, profiles and the watched SteamVR settings in one file.
+    bool exportSnapshot( const QString& fileName );
+    // Only SteamVR settings that we watch are applied from the snapshot.
+    bool importSnapshot( const QString& fileName );
+
     Q_INVOKABLE QString getVersionString();
     Q_INVOKABLE QUrl getVRRuntimePathUrl();
 
@@ -259,14 +296,14 @@ public slots:
     void setAlarm01SoundVolume( float vol );
     void cancelAlarm01Sound();
 
-    void setCrashRecoveryDisabled( bool value, bool notify = true );
-    void setEnableDebug( bool value, bool notify = true );
+    void setCrashRecoveryDisabled( bool value );
+    void setEnableDebug( bool value );
     void setDisableVersionCheck( bool value, bool notify = true );
     void setNewVersionDetected( bool value, bool notify = true );
     void setVersionCheckText( QString value, bool notify = true );
-    void setVsyncDisabled( bool value, bool notify = true );
-    void setCustomTickRateMs( int value, bool notify = true );
-    void setDebugState( int value, bool notify = true );
+    void setVsyncDisabled( bool value );
+    void setCustomTickRateMs( int value );
+    void setDebugState( int value );
 
 signals:
     void keyBoardInputSignal( QString input, unsigned long userValue = 0 );
@@ -110,7 +110,8 @@ MyStackViewPage {
                     Layout.minimumWidth: 799
                     Layout.preferredWidth: 799
                     Layout.fillWidth: true
-                    model: [""]
+                    model: MoveCenterTabController.offsetProfilesModel
+                    textRole: "display"
                     onCurrentIndexChanged: {
                         if (currentIndex > 0) {
                             offsetApplyProfileButton.enabled = true
@@ -633,12 +634,6 @@ MyStackViewPage {
 
     }
     function reloadOffsetProfiles() {
-        var profiles = [""]
-        var profileCount = MoveCenterTabController.getOffsetProfileCount()
-        for (var i = 0; i < profileCount; i++) {
-            profiles.push(MoveCenterTabController.getOffsetProfileName(i))
-        }
         offsetProfileComboBox.currentIndex = 0
-        offsetProfileComboBox.model = profiles
     }
 }
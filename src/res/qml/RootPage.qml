@@ -186,7 +186,8 @@ MyStackViewPage {
                            Layout.maximumWidth: 378
                            Layout.minimumWidth: 378
                            Layout.preferredWidth: 378
-                           model: [""]
+                           model: VideoTabController.videoProfilesModel
+                           textRole: "display"
                            onCurrentIndexChanged: {
                                if (currentIndex > 0) {
                                    summaryVideoProfileApplyButton.enabled = true
@@ -224,7 +225,8 @@ MyStackViewPage {
                            Layout.minimumWidth: 378
                            Layout.preferredWidth: 378
                            Layout.fillWidth: true
-                           model: [""]
+                           model: ChaperoneTabController.chaperoneProfilesModel
+                           textRole: "display"
                            onCurrentIndexChanged: {
                                if (currentIndex > 0) {
                                    summaryChaperoneProfileApplyButton.enabled = true
@@ -564,23 +566,11 @@ MyStackViewPage {
 
 
     function reloadChaperoneProfiles() {
-       var profiles = [""]
-       var profileCount = ChaperoneTabController.getChaperoneProfileCount()
-       for (var i = 0; i < profileCount; i++) {
-           profiles.push(ChaperoneTabController.getChaperoneProfileName(i))
-       }
        summaryChaperoneProfileComboBox.currentIndex = 0
-       summaryChaperoneProfileComboBox.model = profiles
     }
 
 
     function reloadVideoProfiles() {
-       var profiles = [""]
-       var profileCount = VideoTabController.getVideoProfileCount()
-       for (var i = 0; i < profileCount; i++) {
-           profiles.push(VideoTabController.getVideoProfileName(i))
-       }
        summaryVideoProfileComboBox.currentIndex = 0
-       summaryVideoProfileComboBox.model = profiles
     }
 }
@@ -57,7 +57,7 @@ MyStackViewPage {
             id: disableCrashRecoveryToggle
             text: "Disable Automatic Crash Recovery of Chaperone Config"
             onCheckedChanged: {
-                OverlayController.setCrashRecoveryDisabled(checked, true)
+                OverlayController.setCrashRecoveryDisabled(checked)
             }
         }
 
@@ -76,7 +76,7 @@ MyStackViewPage {
                 id: vsyncDisabledToggle
                 text: "Disable App Vsync"
                 onCheckedChanged: {
-                    OverlayController.setVsyncDisabled(checked, true)
+                    OverlayController.setVsyncDisabled(checked)
                     customTickRateText.visible = checked
                     customTickRateLabel.visible = checked
                     customTickRateMsLabel.visible = checked
@@ -186,7 +186,7 @@ MyStackViewPage {
                 id: debugToggle
                 text: "Debug"
                 onCheckedChanged: {
-                    OverlayController.setEnableDebug(checked, true)
+                    OverlayController.setEnableDebug(checked)
                 }
             }
 
@@ -31,7 +31,8 @@ ColumnLayout {
         MyComboBox {
             id: audioProfileComboBox
             Layout.preferredWidth: 250
-            model: [""]
+            model: AudioTabController.audioProfilesModel
+            textRole: "display"
             enabled: false
             visible: false
             onCurrentIndexChanged: {
@@ -110,12 +111,6 @@ ColumnLayout {
         }
     }
     function reloadAudioProfiles() {
-        var profiles = [""]
-        var profileCount = AudioTabController.getAudioProfileCount()
-        for (var i = 0; i < profileCount; i++) {
-            profiles.push(AudioTabController.getAudioProfileName(i))
-        }
         audioProfileComboBox.currentIndex = 0
-        audioProfileComboBox.model = profiles
     }
 }
@@ -183,7 +183,8 @@ MyStackViewPage {
                     Layout.minimumWidth: 799
                     Layout.preferredWidth: 799
                     Layout.fillWidth: true
-                    model: [""]
+                    model: ChaperoneTabController.chaperoneProfilesModel
+                    textRole: "display"
                     onCurrentIndexChanged: {
                         if (currentIndex > 0) {
                             chaperoneApplyProfileButton.enabled = true
@@ -466,7 +467,7 @@ MyStackViewPage {
                 id: chaperoneDisableChaperone
                 text: "Disable Chaperone"
                 onCheckedChanged: {
-                    ChaperoneTabController.setDisableChaperone(this.checked, false)
+                    ChaperoneTabController.setDisableChaperone(this.checked)
                     if(this.checked){
                         chaperoneFadeDistanceMinus.enabled = false;
                         chaperoneFadeDistancePlus.enabled = false;
@@ -597,12 +598,6 @@ MyStackViewPage {
     }
 
     function reloadChaperoneProfiles() {
-        var profiles = [""]
-        var profileCount = ChaperoneTabController.getChaperoneProfileCount()
-        for (var i = 0; i < profileCount; i++) {
-            profiles.push(ChaperoneTabController.getChaperoneProfileName(i))
-        }
         chaperoneProfileComboBox.currentIndex = 0
-        chaperoneProfileComboBox.model = profiles
     }
 }
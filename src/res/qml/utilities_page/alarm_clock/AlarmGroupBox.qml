@@ -33,7 +33,7 @@ GroupBox {
                 id: alarmClockToggle
                 text: ""
                 onCheckedChanged: {
-                    UtilitiesTabController.setAlarmEnabled(checked, false)
+                    UtilitiesTabController.setAlarmEnabled(checked)
                 }
             }
             
@@ -137,7 +137,7 @@ GroupBox {
                 id: alarmDontAnnoyToggle
                 text: "Don't Annoy me"
                 onCheckedChanged: {
-                    UtilitiesTabController.setAlarmIsModal(!checked, false)
+                    UtilitiesTabController.setAlarmIsModal(!checked)
                 }
             }
         }
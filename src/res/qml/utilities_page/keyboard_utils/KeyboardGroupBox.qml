@@ -351,7 +351,6 @@ GroupBox {
                 triggeredOnStart: false
 
                 onTriggered: {
-                    UtilitiesTabController.sendKeyboardRShiftTilde1Delayed()
                     rShiftTilde1Button.enabled = true
                     rShiftTilde2Button.enabled = true
                     rShiftTilde3Button.enabled = true
@@ -374,7 +373,6 @@ GroupBox {
                 triggeredOnStart: false
 
                 onTriggered: {
-                    UtilitiesTabController.sendKeyboardRShiftTilde2Delayed()
                     rShiftTilde1Button.enabled = true
                     rShiftTilde2Button.enabled = true
                     rShiftTilde3Button.enabled = true
@@ -397,7 +395,6 @@ GroupBox {
                 triggeredOnStart: false
 
                 onTriggered: {
-                    UtilitiesTabController.sendKeyboardRShiftTilde3Delayed()
                     rShiftTilde1Button.enabled = true
                     rShiftTilde2Button.enabled = true
                     rShiftTilde3Button.enabled = true
@@ -420,7 +417,6 @@ GroupBox {
                 triggeredOnStart: false
 
                 onTriggered: {
-                    UtilitiesTabController.sendKeyboardRShiftTilde4Delayed()
                     rShiftTilde1Button.enabled = true
                     rShiftTilde2Button.enabled = true
                     rShiftTilde3Button.enabled = true
@@ -443,7 +439,6 @@ GroupBox {
                 triggeredOnStart: false
 
                 onTriggered: {
-                    UtilitiesTabController.sendKeyboardRShiftTilde5Delayed()
                     rShiftTilde1Button.enabled = true
                     rShiftTilde2Button.enabled = true
                     rShiftTilde3Button.enabled = true
@@ -466,7 +461,6 @@ GroupBox {
                 triggeredOnStart: false
 
                 onTriggered: {
-                    UtilitiesTabController.sendKeyboardRShiftTilde6Delayed()
                     rShiftTilde1Button.enabled = true
                     rShiftTilde2Button.enabled = true
                     rShiftTilde3Button.enabled = true
@@ -489,7 +483,6 @@ GroupBox {
                 triggeredOnStart: false
 
                 onTriggered: {
-                    UtilitiesTabController.sendKeyboardRShiftTilde7Delayed()
                     rShiftTilde1Button.enabled = true
                     rShiftTilde2Button.enabled = true
                     rShiftTilde3Button.enabled = true
@@ -512,7 +505,6 @@ GroupBox {
                 triggeredOnStart: false
 
                 onTriggered: {
-                    UtilitiesTabController.sendKeyboardRShiftTilde8Delayed()
                     rShiftTilde1Button.enabled = true
                     rShiftTilde2Button.enabled = true
                     rShiftTilde3Button.enabled = true
@@ -535,7 +527,6 @@ GroupBox {
                 triggeredOnStart: false
 
                 onTriggered: {
-                    UtilitiesTabController.sendKeyboardRShiftTilde9Delayed()
                     rShiftTilde1Button.enabled = true
                     rShiftTilde2Button.enabled = true
                     rShiftTilde3Button.enabled = true
@@ -558,7 +549,6 @@ GroupBox {
                 triggeredOnStart: false
 
                 onTriggered: {
-                    UtilitiesTabController.sendKeyboardRShiftTilde0Delayed()
                     rShiftTilde1Button.enabled = true
                     rShiftTilde2Button.enabled = true
                     rShiftTilde3Button.enabled = true
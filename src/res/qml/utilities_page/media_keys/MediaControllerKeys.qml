@@ -61,6 +61,68 @@ GroupBox {
                     UtilitiesTabController.sendMediaNextSong()
                 }
             }
+
+            MyComboBox {
+                id: mediaPlayerComboBox
+                property var nowPlaying: UtilitiesTabController.nowPlaying
+                Layout.leftMargin: 20
+                Layout.fillWidth: true
+                // The first entry sends the keys to the player that started
+                // playing last.
+                model: ["Last playing player"].concat(nowPlaying.players)
+                currentIndex: nowPlaying.players.indexOf(nowPlaying.pinnedPlayer) + 1
+                onActivated: {
+                    UtilitiesTabController.pinMediaPlayer(index > 0 ? model[index] : "")
+                }
+            }
+        }
+
+        ColumnLayout {
+            // Updated by the player, there is nothing to poll.
+            property var nowPlaying: UtilitiesTabController.nowPlaying
+            visible: nowPlaying.title !== ""
+            Layout.fillWidth: true
+
+            function formatTime(seconds) {
+                var s = Math.floor(seconds)
+                var m = Math.floor(s / 60)
+                s = s % 60
+                return m + ":" + (s < 10 ? "0" : "") + s
+            }
+
+            function statusText() {
+                var text = nowPlaying.playbackStatus
+                // Players don't report progress, only show a position that
+                // doesn't move.
+                if (nowPlaying.playbackStatus !== "Playing") {
+                    text += " at " + formatTime(nowPlaying.position)
+                }
+                if (nowPlaying.length > 0) {
+                    text += " / " + formatTime(nowPlaying.length)
+                }
+                return text + " - " + nowPlaying.player
+            }
+
+            MyText {
+                text: parent.nowPlaying.title
+                elide: Text.ElideRight
+                Layout.fillWidth: true
+            }
+
+            MyText {
+                text: parent.nowPlaying.artist
+                visible: text !== ""
+                elide: Text.ElideRight
+                Layout.fillWidth: true
+            }
+
+            MyText {
+                text: parent.statusText()
+                color: "#aaaaaa"
+                font.pointSize: 16
+                elide: Text.ElideRight
+                Layout.fillWidth: true
+            }
         }
     }
 }
@@ -50,7 +50,8 @@ GroupBox {
             MyComboBox {
                 id: videoProfileComboBox
                 Layout.fillWidth: true
-                model: [""]
+                model: VideoTabController.videoProfilesModel
+                textRole: "display"
                 onCurrentIndexChanged: {
                     if (currentIndex > 0) {
                         videoApplyProfileButton.enabled = true
@@ -117,13 +118,7 @@ GroupBox {
 
     }
     function reloadVideoProfiles() {
-        var profiles = [""]
-        var profileCount = VideoTabController.getVideoProfileCount()
-        for (var i = 0; i < profileCount; i++) {
-            profiles.push(VideoTabController.getVideoProfileName(i))
-        }
         videoProfileComboBox.currentIndex = 0
-        videoProfileComboBox.model = profiles
     }
 
 
@@ -0,0 +1,69 @@
+#pragma once
+#include <bitset>
+#include <cstddef>
+
+namespace settings
+{
+/*!
+   \brief Tracks which settings of one enum type have unsaved changes.
+
+   One bit per enum value, so marking the same setting repeatedly costs
+   nothing and a flush visits every changed setting exactly once.
+ */
+template <typename Setting> class DirtySettings
+{
+public:
+    constexpr static auto size
+        = static_cast<std::size_t>( Setting::LAST_ENUMERATOR ) + 1;
+
+    void mark( const Setting setting ) noexcept
+    {
+        m_dirty.set( static_cast<std::size_t>( setting ) );
+    }
+
+    [[nodiscard]] bool isDirty( const Setting setting ) const noexcept
+    {
+        return m_dirty.test( static_cast<std::size_t>( setting ) );
+    }
+
+    [[nodiscard]] bool any() const noexcept
+    {
+        return m_dirty.any();
+    }
+
+    [[nodiscard]] std::size_t count() const noexcept
+    {
+        return m_dirty.count();
+    }
+
+    void clear() noexcept
+    {
+        m_dirty.reset();
+    }
+
+    /*!
+       \brief Calls \a save with every dirty setting and clears all marks.
+     */
+    template <typename SaveFunction> void flush( SaveFunction save )
+    {
+        if ( m_dirty.none() )
+        {
+            return;
+        }
+
+        for ( std::size_t index = 0; index < size; ++index )
+        {
+            if ( m_dirty.test( index ) )
+            {
+                save( static_cast<Setting>( index ) );
+            }
+        }
+
+        m_dirty.reset();
+    }
+
+private:
+    std::bitset<size> m_dirty;
+};
+
+} // namespace settings
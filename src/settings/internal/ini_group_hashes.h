@@ -0,0 +1,96 @@
+#pragma once
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <map>
+#include <set>
+#include <string>
+
+namespace settings
+{
+/*!
+   \brief Remembers a hash of every [group] section of an ini file so that
+   only the groups that were edited have to be parsed again.
+
+   Keys written before the first group header are tracked under an empty
+   group name.
+ */
+class IniGroupHashes
+{
+public:
+    /*!
+       \brief Stores the hashes of the groups in \a iniContent.
+       \return Groups that were added, removed or changed since the last
+       call.
+     */
+    std::set<std::string> update( const QByteArray& iniContent )
+    {
+        auto hashes = hashGroups( iniContent );
+
+        std::set<std::string> changed;
+        for ( const auto& [group, hash] : hashes )
+        {
+            const auto it = m_hashes.find( group );
+            if ( it == m_hashes.end() || it->second != hash )
+            {
+                changed.insert( group );
+            }
+        }
+        for ( const auto& [group, hash] : m_hashes )
+        {
+            if ( hashes.count( group ) == 0 )
+            {
+                changed.insert( group );
+            }
+        }
+
+        m_hashes = std::move( hashes );
+        return changed;
+    }
+
+private:
+    static std::map<std::string, QByteArray>
+        hashGroups( const QByteArray& iniContent )
+    {
+        std::map<std::string, QByteArray> hashes;
+
+        std::string group;
+        QCryptographicHash hash( QCryptographicHash::Md5 );
+        auto hasContent = false;
+
+        const auto finishGroup = [&] {
+            if ( hasContent )
+            {
+                hashes[group] = hash.result();
+            }
+            hash.reset();
+            hasContent = false;
+        };
+
+        for ( const auto& rawLine : iniContent.split( '\n' ) )
+        {
+            const auto line = rawLine.trimmed();
+            if ( line.startsWith( '[' ) && line.endsWith( ']' ) )
+            {
+                finishGroup();
+                group = line.mid( 1, line.size() - 2 ).toStdString();
+                // An empty group still exists, its removal is a change.
+                hasContent = true;
+                continue;
+            }
+            if ( line.isEmpty() )
+            {
+                continue;
+            }
+            hash.addData( line );
+            hash.addData( "\n", 1 );
+            hasContent = true;
+        }
+        finishGroup();
+
+        return hashes;
+    }
+
+    std::map<std::string, QByteArray> m_hashes;
+};
+
+} // namespace settings
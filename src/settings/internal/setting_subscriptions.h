@@ -0,0 +1,88 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace settings
+{
+/*!
+   \brief Callbacks for changes of settings of one enum type.
+
+   Subscriptions are stored per setting, so publishing a change only visits
+   the callbacks of that setting. Callbacks run synchronously on the thread
+   that changed the setting.
+ */
+template <typename Setting, typename Value> class SettingSubscriptions
+{
+public:
+    using Callback = std::function<void( const Value& )>;
+
+    constexpr static auto size
+        = static_cast<std::size_t>( Setting::LAST_ENUMERATOR ) + 1;
+
+    void subscribe( const unsigned long long id,
+                    const Setting setting,
+                    Callback callback )
+    {
+        m_subscriptions[static_cast<std::size_t>( setting )].push_back(
+            { id, std::move( callback ) } );
+    }
+
+    /*!
+       \return false if no subscription with \a id exists.
+     */
+    bool unsubscribe( const unsigned long long id )
+    {
+        for ( auto& subscriptions : m_subscriptions )
+        {
+            for ( auto it = subscriptions.begin(); it != subscriptions.end();
+                  ++it )
+            {
+                if ( it->id == id )
+                {
+                    subscriptions.erase( it );
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void publish( const Setting setting, const Value& value )
+    {
+        const auto& subscriptions
+            = m_subscriptions[static_cast<std::size_t>( setting )];
+        if ( subscriptions.empty() )
+        {
+            return;
+        }
+
+        ++m_published;
+
+        // A callback may subscribe or unsubscribe, don't iterate the
+        // original.
+        const auto callbacks = subscriptions;
+        for ( const auto& s : callbacks )
+        {
+            s.callback( value );
+        }
+    }
+
+    [[nodiscard]] unsigned long long published() const noexcept
+    {
+        return m_published;
+    }
+
+private:
+    struct Subscription
+    {
+        unsigned long long id;
+        Callback callback;
+    };
+
+    std::array<std::vector<Subscription>, size> m_subscriptions;
+    unsigned long long m_published = 0;
+};
+
+} // namespace settings
@@ -1,12 +1,23 @@
 #pragma once
 #include <assert.h>
+#include <QCoreApplication>
+#include <QFile>
 #include <array>
+#include <functional>
+#include <optional>
+#include <set>
+#include <string_view>
 #include <vector>
 #include <easylogging++.h>
 #include "../settings.h"
 #include "setting_value.h"
-#include "../../utils/setup.h"
 #include "specific_setting_value.h"
+#include "dirty_settings.h"
+#include "settings_persister.h"
+#include "setting_subscriptions.h"
+#include "ini_group_hashes.h"
+#include "settings_file_watcher.h"
+#include "../settings_snapshot.h"
 
 namespace settings
 {
@@ -42,52 +53,121 @@ template <int ArraySize, typename Value>
 
     return s;
 }
-template <typename Enum, int ArraySize, typename Value>
-void verifySettings( std::array<Value, ArraySize> v ) noexcept
+struct SettingDefinition
 {
-    for ( int settingIndex = 0; settingIndex < ( ArraySize - 1 );
-          ++settingIndex )
-    {
-        // Having the enum values be in the correct location makes getting a
-        // value O(1) instead of O(n) due to array lookup vs traversal
-        // Also ensures that there are no mising values
+    // Value of the enumerator, as looked up in the enum.
+    std::size_t enumValue;
+    SettingCategory category;
+    std::string_view qtKey;
+};
 
-        const auto currentSetting
-            = v[static_cast<std::size_t>( settingIndex )].setting();
+/*!
+   \brief Whether the enumerator of every definition is its index in the
+   definition list, and the enum has no enumerators besides the list.
 
-        const auto settingCorrectlyLocated
-            = currentSetting == static_cast<Enum>( settingIndex );
-        if ( !settingCorrectlyLocated )
+   The value arrays are built from the same list and indexed with the enum,
+   so getting a value is an array lookup instead of a search.
+ */
+template <typename Setting, std::size_t Size>
+constexpr bool enumValuesAreIndices(
+    const std::array<SettingDefinition, Size>& settings )
+{
+    if ( static_cast<std::size_t>( Setting::LAST_ENUMERATOR ) + 1 != Size )
+    {
+        return false;
+    }
+    for ( std::size_t i = 0; i < Size; ++i )
+    {
+        if ( settings[i].enumValue != i )
         {
-            const auto enumName = typeid( Enum ).name();
-
-            const auto enumSettingNumber = static_cast<int>( currentSetting );
-
-            LOG( ERROR ) << enumName << ": at index '" << settingIndex
-                         << "' is incorrect. Current value: '"
-                         << enumSettingNumber
-                         << "'. Exiting "
-                            "with error code "
-                         << ReturnErrorCode::SETTING_INCORRECT_INDEX << ".";
-            exit( ReturnErrorCode::SETTING_INCORRECT_INDEX );
+            return false;
         }
     }
+    return true;
 }
 
-class SettingsController
+template <std::size_t Size>
+constexpr bool
+    qtKeysAreUnique( const std::array<SettingDefinition, Size>& settings )
 {
-public:
-    SettingsController()
+    for ( std::size_t i = 0; i < Size; ++i )
     {
-        verifySettings<BoolSetting, boolSettingSize>( m_boolSettings );
-
-        verifySettings<DoubleSetting, doubleSettingSize>( m_doubleSettings );
-
-        verifySettings<StringSetting, stringSettingsSize>( m_stringSettings );
-
-        verifySettings<IntSetting, intSettingsSize>( m_intSettings );
+        for ( std::size_t j = i + 1; j < Size; ++j )
+        {
+            if ( settings[i].category == settings[j].category
+                 && settings[i].qtKey == settings[j].qtKey )
+            {
+                return false;
+            }
+        }
     }
+    return true;
+}
+
+#define SETTINGS_DEFINITION( Type, name, category, qtKey )                    \
+    SettingDefinition{ static_cast<std::size_t>( Type::name ),                \
+                       SettingCategory::category,                             \
+                       qtKey },
+#define BOOL_SETTING_DEFINITION( name, category, qtKey, defaultValue )        \
+    SETTINGS_DEFINITION( BoolSetting, name, category, qtKey )
+#define DOUBLE_SETTING_DEFINITION( name, category, qtKey, defaultValue )      \
+    SETTINGS_DEFINITION( DoubleSetting, name, category, qtKey )
+#define STRING_SETTING_DEFINITION( name, category, qtKey, defaultValue )      \
+    SETTINGS_DEFINITION( StringSetting, name, category, qtKey )
+#define INT_SETTING_DEFINITION( name, category, qtKey, defaultValue )         \
+    SETTINGS_DEFINITION( IntSetting, name, category, qtKey )
+
+static_assert( enumValuesAreIndices<BoolSetting>( std::array{
+                   BOOL_SETTINGS( BOOL_SETTING_DEFINITION ) } ),
+               "BoolSetting doesn't match the definitions." );
+static_assert( enumValuesAreIndices<DoubleSetting>( std::array{
+                   DOUBLE_SETTINGS( DOUBLE_SETTING_DEFINITION ) } ),
+               "DoubleSetting doesn't match the definitions." );
+static_assert( enumValuesAreIndices<StringSetting>( std::array{
+                   STRING_SETTINGS( STRING_SETTING_DEFINITION ) } ),
+               "StringSetting doesn't match the definitions." );
+static_assert( enumValuesAreIndices<IntSetting>( std::array{
+                   INT_SETTINGS( INT_SETTING_DEFINITION ) } ),
+               "IntSetting doesn't match the definitions." );
+
+// Settings of different types share the groups in the settings file.
+static_assert( qtKeysAreUnique( std::array{
+                   BOOL_SETTINGS( BOOL_SETTING_DEFINITION )
+                       DOUBLE_SETTINGS( DOUBLE_SETTING_DEFINITION )
+                           STRING_SETTINGS( STRING_SETTING_DEFINITION )
+                               INT_SETTINGS( INT_SETTING_DEFINITION ) } ),
+               "Two settings use the same Qt key." );
+
+#undef SETTINGS_DEFINITION
+#undef BOOL_SETTING_DEFINITION
+#undef DOUBLE_SETTING_DEFINITION
+#undef STRING_SETTING_DEFINITION
+#undef INT_SETTING_DEFINITION
+
+#define BOOL_SETTING_VALUE( name, category, qtKey, defaultValue )             \
+    BoolSettingValue{ BoolSetting::name,                                      \
+                      SettingCategory::category,                              \
+                      QtInfo{ qtKey },                                        \
+                      defaultValue },
+#define DOUBLE_SETTING_VALUE( name, category, qtKey, defaultValue )           \
+    DoubleSettingValue{ DoubleSetting::name,                                  \
+                        SettingCategory::category,                            \
+                        QtInfo{ qtKey },                                      \
+                        defaultValue },
+#define STRING_SETTING_VALUE( name, category, qtKey, defaultValue )           \
+    StringSettingValue{ StringSetting::name,                                  \
+                        SettingCategory::category,                            \
+                        QtInfo{ qtKey },                                      \
+                        defaultValue },
+#define INT_SETTING_VALUE( name, category, qtKey, defaultValue )              \
+    IntSettingValue{ IntSetting::name,                                        \
+                     SettingCategory::category,                               \
+                     QtInfo{ qtKey },                                         \
+                     defaultValue },
 
+class SettingsController
+{
+public:
     std::string getSettingsAndValues() const noexcept
     {
         std::string s;
@@ -107,27 +187,46 @@ class SettingsController
         return getQSettings().fileName().toStdString();
     }
 
+    /*!
+       \brief Queues the changed settings for writing and returns without
+       waiting for the disk.
+     */
     void saveChangedSettings()
     {
-        if ( m_changedSettings.empty() )
-        {
-            return;
-        }
-
-        for ( const auto setting : m_changedSettings )
-        {
-            setting->saveValue();
-        }
-
-        m_changedSettings.clear();
+        SettingsSnapshot snapshot;
+
+        m_dirtyBoolSettings.flush( [&]( const BoolSetting setting ) {
+            addToSnapshot( snapshot, m_boolSettings, setting );
+        } );
+        m_dirtyDoubleSettings.flush( [&]( const DoubleSetting setting ) {
+            addToSnapshot( snapshot, m_doubleSettings, setting );
+        } );
+        m_dirtyIntSettings.flush( [&]( const IntSetting setting ) {
+            addToSnapshot( snapshot, m_intSettings, setting );
+        } );
+        m_dirtyStringSettings.flush( [&]( const StringSetting setting ) {
+            addToSnapshot( snapshot, m_stringSettings, setting );
+        } );
+
+        m_persister.persist( std::move( snapshot ) );
     }
 
+    /*!
+       \brief Writes every setting and blocks until they are on disk.
+     */
     void saveAllSettings()
     {
-        for ( auto& setting : m_boolSettings )
-        {
-            setting.saveValue();
-        }
+        SettingsSnapshot snapshot;
+        snapshot.reserve( boolSettingSize + doubleSettingSize
+                          + stringSettingsSize + intSettingsSize );
+
+        addAllToSnapshot( snapshot, m_boolSettings, m_dirtyBoolSettings );
+        addAllToSnapshot( snapshot, m_doubleSettings, m_dirtyDoubleSettings );
+        addAllToSnapshot( snapshot, m_intSettings, m_dirtyIntSettings );
+        addAllToSnapshot( snapshot, m_stringSettings, m_dirtyStringSettings );
+
+        m_persister.persist( std::move( snapshot ) );
+        m_persister.flush();
     }
 
     template <typename ReturnType, typename Setting>
@@ -154,330 +253,447 @@ class SettingsController
     }
 
     template <typename Setting, typename Type>
-    void setSetting( const Setting setting, const Type value ) noexcept
+    void setSetting( const Setting setting, const Type value )
     {
-        const auto index = static_cast<std::size_t>( setting );
+        if ( !applyValue( setting, value ) )
+        {
+            return;
+        }
 
         if constexpr ( std::is_same<Setting, BoolSetting>::value )
         {
-            auto& s = m_boolSettings[index];
-            s.setValue( value );
-
-            m_changedSettings.push_back( &s );
+            m_dirtyBoolSettings.mark( setting );
         }
         else if constexpr ( std::is_same<Setting, DoubleSetting>::value )
         {
-            auto& s = m_doubleSettings[index];
-            s.setValue( value );
-
-            m_changedSettings.push_back( &s );
+            m_dirtyDoubleSettings.mark( setting );
         }
         else if constexpr ( std::is_same<Setting, IntSetting>::value )
         {
-            auto& s = m_intSettings[index];
-            s.setValue( value );
+            m_dirtyIntSettings.mark( setting );
+        }
+        else if constexpr ( std::is_same<Setting, StringSetting>::value )
+        {
+            m_dirtyStringSettings.mark( setting );
+        }
+    }
+
+    /*!
+       \brief Starts reloading settings that are edited in the settings file
+       while the application runs. Needs a QCoreApplication.
+     */
+    void watchSettingsFile()
+    {
+        if ( m_fileWatcher )
+        {
+            return;
+        }
+
+        const auto fileName = getQSettings().fileName();
+        QFile file( fileName );
+        if ( file.open( QIODevice::ReadOnly ) )
+        {
+            m_fileGroups.update( file.readAll() );
+        }
+
+        // Owned by the application so it is destroyed before Qt shuts down.
+        m_fileWatcher = new SettingsFileWatcher(
+            fileName,
+            [this] { return reloadChangedGroups(); },
+            QCoreApplication::instance() );
+    }
+
+    /*!
+       \brief Applies the values of the settings file groups that changed
+       since the file was last read. Subscribers are notified through the
+       same path as \c setSetting.
+
+       Changed values are not marked dirty, so they are not written back.
+       Settings with unsaved changes keep the in memory value.
+       \return false if our own writes are still pending, the file does not
+       show the current state yet.
+     */
+    bool reloadChangedGroups()
+    {
+        if ( !m_persister.isIdle() )
+        {
+            return false;
+        }
+
+        const auto fileName = getQSettings().fileName();
+        QFile file( fileName );
+        if ( !file.open( QIODevice::ReadOnly ) )
+        {
+            return true;
+        }
+
+        const auto changedGroups = m_fileGroups.update( file.readAll() );
+        if ( changedGroups.empty() )
+        {
+            return true;
+        }
+
+        QSettings s( fileName, QSettings::IniFormat );
+        const auto publishedBefore = publishedChanges();
+        reloadGroups( s, changedGroups, m_boolSettings, m_dirtyBoolSettings );
+        reloadGroups(
+            s, changedGroups, m_doubleSettings, m_dirtyDoubleSettings );
+        reloadGroups( s, changedGroups, m_intSettings, m_dirtyIntSettings );
+        reloadGroups(
+            s, changedGroups, m_stringSettings, m_dirtyStringSettings );
+
+        LOG( INFO ) << "Settings file changed, re-read "
+                    << changedGroups.size() << " group(s) and applied "
+                    << publishedChanges() - publishedBefore
+                    << " changed setting(s).";
+        return true;
+    }
+
+    std::vector<SnapshotValue> snapshotValues() const
+    {
+        std::vector<SnapshotValue> values;
+        values.reserve( boolSettingSize + doubleSettingSize
+                        + stringSettingsSize + intSettingsSize );
+
+        addSnapshotValues( values, m_boolSettings );
+        addSnapshotValues( values, m_doubleSettings );
+        addSnapshotValues( values, m_intSettings );
+        addSnapshotValues( values, m_stringSettings );
+
+        return values;
+    }
+
+    /*!
+       \brief Applies \a values as one change. Every value is checked before
+       the first one is applied, subscribers are notified as for
+       \c setSetting and the changed settings are queued in one write.
+
+       Values of settings that don't exist in this version are skipped.
+       \return Number of changed settings, or no value if a value has the
+       wrong type and nothing was applied.
+     */
+    std::optional<unsigned long long>
+        applySnapshotValues( const std::vector<SnapshotValue>& values,
+                             int& unknownSettings )
+    {
+        std::vector<std::function<void()>> changes;
+        changes.reserve( values.size() );
+
+        for ( const auto& v : values )
+        {
+            auto valid = true;
+            const auto known
+                = prepareSnapshotValue( m_boolSettings, v, changes, valid )
+                  || prepareSnapshotValue(
+                      m_doubleSettings, v, changes, valid )
+                  || prepareSnapshotValue( m_intSettings, v, changes, valid )
+                  || prepareSnapshotValue(
+                      m_stringSettings, v, changes, valid );
+            if ( !valid )
+            {
+                LOG( ERROR ) << "Snapshot value of setting '" << v.group << "/"
+                             << v.key << "' has the wrong type.";
+                return std::nullopt;
+            }
+            if ( !known )
+            {
+                ++unknownSettings;
+            }
+        }
+
+        const auto publishedBefore = publishedChanges();
+        for ( const auto& change : changes )
+        {
+            change();
+        }
+        saveChangedSettings();
+
+        return publishedChanges() - publishedBefore;
+    }
+
+    template <typename Setting, typename Callback>
+    SubscriptionId subscribe( const Setting setting, Callback callback )
+    {
+        const auto id = ++m_lastSubscriptionId;
 
-            m_changedSettings.push_back( &s );
+        if constexpr ( std::is_same<Setting, BoolSetting>::value )
+        {
+            m_boolSubscriptions.subscribe( id, setting, std::move( callback ) );
+        }
+        else if constexpr ( std::is_same<Setting, DoubleSetting>::value )
+        {
+            m_doubleSubscriptions.subscribe(
+                id, setting, std::move( callback ) );
+        }
+        else if constexpr ( std::is_same<Setting, IntSetting>::value )
+        {
+            m_intSubscriptions.subscribe( id, setting, std::move( callback ) );
         }
         else if constexpr ( std::is_same<Setting, StringSetting>::value )
         {
-            auto& s = m_stringSettings[index];
-            s.setValue( value );
+            m_stringSubscriptions.subscribe(
+                id, setting, std::move( callback ) );
+        }
 
-            m_changedSettings.push_back( &s );
+        return id;
+    }
+
+    void unsubscribe( const SubscriptionId id )
+    {
+        if ( m_boolSubscriptions.unsubscribe( id )
+             || m_doubleSubscriptions.unsubscribe( id )
+             || m_intSubscriptions.unsubscribe( id )
+             || m_stringSubscriptions.unsubscribe( id ) )
+        {
+            return;
         }
+        LOG( WARNING ) << "Tried to remove unknown setting subscription '"
+                       << id << "'.";
+    }
+
+    /*!
+       \brief Number of settings changed since they were last queued for
+       writing. Never more than the number of settings.
+     */
+    [[nodiscard]] std::size_t unsavedChanges() const noexcept
+    {
+        return m_dirtyBoolSettings.count() + m_dirtyDoubleSettings.count()
+               + m_dirtyIntSettings.count() + m_dirtyStringSettings.count();
+    }
+
+    /*!
+       \brief Waits for queued writes and returns how often the settings file
+       has been written.
+     */
+    [[nodiscard]] unsigned long long fileWrites()
+    {
+        m_persister.flush();
+        return m_persister.fileWrites();
+    }
+
+    [[nodiscard]] unsigned long long publishedChanges() const noexcept
+    {
+        return m_boolSubscriptions.published()
+               + m_doubleSubscriptions.published()
+               + m_intSubscriptions.published()
+               + m_stringSubscriptions.published();
     }
 
 private:
-    std::vector<SettingValue*> m_changedSettings{};
+    /*!
+       \brief Sets the value and notifies subscribers.
+       \return false if \a value is equal to the current value.
+     */
+    template <typename Setting, typename Type>
+    bool applyValue( const Setting setting, const Type value )
+    {
+        const auto index = static_cast<std::size_t>( setting );
+
+        if constexpr ( std::is_same<Setting, BoolSetting>::value )
+        {
+            if ( !m_boolSettings[index].setValue( value ) )
+            {
+                return false;
+            }
+            m_boolSubscriptions.publish( setting, value );
+        }
+        else if constexpr ( std::is_same<Setting, DoubleSetting>::value )
+        {
+            if ( !m_doubleSettings[index].setValue( value ) )
+            {
+                return false;
+            }
+            m_doubleSubscriptions.publish( setting, value );
+        }
+        else if constexpr ( std::is_same<Setting, IntSetting>::value )
+        {
+            if ( !m_intSettings[index].setValue( value ) )
+            {
+                return false;
+            }
+            m_intSubscriptions.publish( setting, value );
+        }
+        else if constexpr ( std::is_same<Setting, StringSetting>::value )
+        {
+            if ( !m_stringSettings[index].setValue( value ) )
+            {
+                return false;
+            }
+            m_stringSubscriptions.publish( setting, value );
+        }
+        return true;
+    }
+
+    template <typename Array, typename Setting>
+    void reloadGroups( QSettings& file,
+                       const std::set<std::string>& groups,
+                       const Array& settings,
+                       const DirtySettings<Setting>& dirty )
+    {
+        for ( const auto& s : settings )
+        {
+            const auto group = getQtCategoryName( s.category() );
+            if ( groups.count( group ) == 0 || dirty.isDirty( s.setting() ) )
+            {
+                continue;
+            }
+
+            file.beginGroup( QString::fromStdString( group ) );
+            const auto key = QString::fromStdString( s.qtInfo().settingName );
+            const auto v = file.value( key );
+            file.endGroup();
+
+            using Value = decltype( s.value() );
+            if ( isValidQVariant<Value>( v ) )
+            {
+                applyValue( s.setting(), fromQVariant<Value>( v ) );
+            }
+        }
+    }
+
+    /*!
+       \brief Settings describing this machine or the last run rather than
+       the user's choices, they are neither exported nor imported.
+     */
+    static bool isMachineLocal( const BoolSetting setting )
+    {
+        return setting == BoolSetting::APPLICATION_previousShutdownSafe;
+    }
+
+    static bool isMachineLocal( const IntSetting setting )
+    {
+        return setting == IntSetting::APPLICATION_debugState;
+    }
+
+    template <typename Setting>
+    static bool isMachineLocal( const Setting )
+    {
+        return false;
+    }
+
+    template <typename Array>
+    static void addSnapshotValues( std::vector<SnapshotValue>& values,
+                                   const Array& settings )
+    {
+        for ( const auto& s : settings )
+        {
+            if ( isMachineLocal( s.setting() ) )
+            {
+                continue;
+            }
+            values.push_back( { getQtCategoryName( s.category() ),
+                                s.qtInfo().settingName,
+                                s.qVariantValue() } );
+        }
+    }
+
+    /*!
+       \return false if \a v is not a setting of \a settings.
+     */
+    template <typename Array>
+    bool prepareSnapshotValue( const Array& settings,
+                               const SnapshotValue& v,
+                               std::vector<std::function<void()>>& changes,
+                               bool& valid )
+    {
+        for ( const auto& s : settings )
+        {
+            if ( s.qtInfo().settingName != v.key
+                 || getQtCategoryName( s.category() ) != v.group )
+            {
+                continue;
+            }
+            if ( isMachineLocal( s.setting() ) )
+            {
+                return true;
+            }
+
+            using Value = decltype( s.value() );
+            if ( !isValidQVariant<Value>( v.value ) )
+            {
+                valid = false;
+                return true;
+            }
+            changes.push_back(
+                [this,
+                 setting = s.setting(),
+                 value = fromQVariant<Value>( v.value )] {
+                    setSetting( setting, value );
+                } );
+            return true;
+        }
+        return false;
+    }
+
+    template <typename Array, typename Setting>
+    static void addToSnapshot( SettingsSnapshot& snapshot,
+                               const Array& settings,
+                               const Setting setting )
+    {
+        const auto& s = settings[static_cast<std::size_t>( setting )];
+        snapshot.push_back(
+            { QString::fromStdString( getQtCategoryName( s.category() ) ),
+              QString::fromStdString( s.qtInfo().settingName ),
+              s.qVariantValue() } );
+    }
+
+    template <typename Array, typename Setting>
+    static void addAllToSnapshot( SettingsSnapshot& snapshot,
+                                  const Array& settings,
+                                  DirtySettings<Setting>& dirty )
+    {
+        dirty.clear();
+        for ( const auto& s : settings )
+        {
+            addToSnapshot( snapshot, settings, s.setting() );
+        }
+    }
+
+    // Its destructor writes anything still queued when the application exits.
+    SettingsPersister m_persister{ getQSettings().fileName() };
+
+    SettingSubscriptions<BoolSetting, bool> m_boolSubscriptions{};
+    SettingSubscriptions<DoubleSetting, double> m_doubleSubscriptions{};
+    SettingSubscriptions<IntSetting, int> m_intSubscriptions{};
+    SettingSubscriptions<StringSetting, std::string> m_stringSubscriptions{};
+    SubscriptionId m_lastSubscriptionId = 0;
+
+    IniGroupHashes m_fileGroups{};
+    SettingsFileWatcher* m_fileWatcher = nullptr;
+
+    DirtySettings<BoolSetting> m_dirtyBoolSettings{};
+    DirtySettings<DoubleSetting> m_dirtyDoubleSettings{};
+    DirtySettings<IntSetting> m_dirtyIntSettings{};
+    DirtySettings<StringSetting> m_dirtyStringSettings{};
 
     constexpr static auto boolSettingSize
         = static_cast<int>( BoolSetting::LAST_ENUMERATOR ) + 1;
     std::array<BoolSettingValue, boolSettingSize> m_boolSettings{
-        BoolSettingValue{ BoolSetting::PLAYSPACE_lockXToggle,
-                          SettingCategory::Playspace,
-                          QtInfo{ "lockXToggle" },
-                          false },
-        BoolSettingValue{ BoolSetting::PLAYSPACE_lockYToggle,
-                          SettingCategory::Playspace,
-                          QtInfo{ "lockYToggle" },
-                          false },
-        BoolSettingValue{ BoolSetting::PLAYSPACE_lockZToggle,
-                          SettingCategory::Playspace,
-                          QtInfo{ "lockZToggle" },
-                          false },
-        BoolSettingValue{ BoolSetting::PLAYSPACE_momentumSave,
-                          SettingCategory::Playspace,
-                          QtInfo{ "momentumSave" },
-                          false },
-        BoolSettingValue{ BoolSetting::PLAYSPACE_turnBindLeft,
-                          SettingCategory::Playspace,
-                          QtInfo{ "turnBindLeft" },
-                          false },
-        BoolSettingValue{ BoolSetting::PLAYSPACE_turnBindRight,
-                          SettingCategory::Playspace,
-                          QtInfo{ "turnBindRight" },
-                          false },
-        BoolSettingValue{ BoolSetting::PLAYSPACE_turnBounds,
-                          SettingCategory::Playspace,
-                          QtInfo{ "turnBounds" },
-                          false },
-        BoolSettingValue{ BoolSetting::PLAYSPACE_moveShortcutLeft,
-                          SettingCategory::Playspace,
-                          QtInfo{ "moveShortcutLeft" },
-                          false },
-        BoolSettingValue{ BoolSetting::PLAYSPACE_moveShortcutRight,
-                          SettingCategory::Playspace,
-                          QtInfo{ "moveShortcutRight" },
-                          false },
-        BoolSettingValue{ BoolSetting::PLAYSPACE_dragBounds,
-                          SettingCategory::Playspace,
-                          QtInfo{ "dragBounds" },
-                          false },
-        BoolSettingValue{ BoolSetting::PLAYSPACE_allowExternalEdits,
-                          SettingCategory::Playspace,
-                          QtInfo{ "allowExternalEdits" },
-                          false },
-        BoolSettingValue{ BoolSetting::PLAYSPACE_oldStyleMotion,
-                          SettingCategory::Playspace,
-                          QtInfo{ "oldStyleMotion" },
-                          false },
-        BoolSettingValue{ BoolSetting::PLAYSPACE_universeCenteredRotation,
-                          SettingCategory::Playspace,
-                          QtInfo{ "universeCenteredRotation" },
-                          false },
-        BoolSettingValue{ BoolSetting::PLAYSPACE_enableSeatedMotion,
-                          SettingCategory::Playspace,
-                          QtInfo{ "enableSeatedMotion" },
-                          false },
-        BoolSettingValue{ BoolSetting::PLAYSPACE_adjustChaperone,
-                          SettingCategory::Playspace,
-                          QtInfo{ "adjustChaperone" },
-                          true },
-        BoolSettingValue{ BoolSetting::PLAYSPACE_showLogMatricesButton,
-                          SettingCategory::Playspace,
-                          QtInfo{ "showLogMatricesButton" },
-                          false },
-        BoolSettingValue{ BoolSetting::PLAYSPACE_simpleRecenter,
-                          SettingCategory::Playspace,
-                          QtInfo{ "simpleRecenter" },
-                          false },
-
-        BoolSettingValue{ BoolSetting::APPLICATION_disableVersionCheck,
-                          SettingCategory::Application,
-                          QtInfo{ "disableVersionCheck" },
-                          false },
-        BoolSettingValue{ BoolSetting::APPLICATION_previousShutdownSafe,
-                          SettingCategory::Application,
-                          QtInfo{ "previousShutdownSafe" },
-                          true },
-        BoolSettingValue{ BoolSetting::APPLICATION_vsyncDisabled,
-                          SettingCategory::Application,
-                          QtInfo{ "vsyncDisabled" },
-                          false },
-        BoolSettingValue{ BoolSetting::APPLICATION_crashRecoveryDisabled,
-                          SettingCategory::Application,
-                          QtInfo{ "crashRecoveryDisabled" },
-                          false },
-        BoolSettingValue{ BoolSetting::APPLICATION_enableDebug,
-                          SettingCategory::Application,
-                          QtInfo{ "enableDebug" },
-                          false },
-
-        BoolSettingValue{ BoolSetting::AUDIO_pttEnabled,
-                          SettingCategory::Audio,
-                          QtInfo{ "pttEnabled" },
-                          false },
-        BoolSettingValue{ BoolSetting::AUDIO_pttShowNotification,
-                          SettingCategory::Audio,
-                          QtInfo{ "pttShowNotification" },
-                          false },
-        BoolSettingValue{ BoolSetting::AUDIO_micProximitySensorCanMute,
-                          SettingCategory::Audio,
-                          QtInfo{ "micProximitySensorCanMute" },
-                          false },
-        BoolSettingValue{ BoolSetting::AUDIO_micReversePtt,
-                          SettingCategory::Audio,
-                          QtInfo{ "micReversePtt" },
-                          false },
-
-        BoolSettingValue{ BoolSetting::UTILITY_alarmEnabled,
-                          SettingCategory::Utility,
-                          QtInfo{ "alarmEnabled" },
-                          false },
-        BoolSettingValue{ BoolSetting::UTILITY_alarmIsModal,
-                          SettingCategory::Utility,
-                          QtInfo{ "alarmIsModal" },
-                          true },
-        BoolSettingValue{ BoolSetting::UTILITY_vrcDebug,
-                          SettingCategory::Utility,
-                          QtInfo{ "vrcDebug" },
-                          false },
-
-        BoolSettingValue{ BoolSetting::VIDEO_brightnessEnabled,
-                          SettingCategory::Video,
-                          QtInfo{ "brightnessEnabled" },
-                          false },
-        BoolSettingValue{ BoolSetting::VIDEO_isOverlayMethodActive,
-                          SettingCategory::Video,
-                          QtInfo{ "isOverlayMethodActive" },
-                          false },
-        BoolSettingValue{ BoolSetting::VIDEO_colorOverlayEnabled,
-                          SettingCategory::Video,
-                          QtInfo{ "colorOverlayEnabled" },
-                          false },
-
-        BoolSettingValue{
-            BoolSetting::CHAPERONE_chaperoneSwitchToBeginnerEnabled,
-            SettingCategory::Chaperone,
-            QtInfo{ "chaperoneSwitchToBeginnerEnabled" },
-            false },
-        BoolSettingValue{ BoolSetting::CHAPERONE_chaperoneHapticFeedbackEnabled,
-                          SettingCategory::Chaperone,
-                          QtInfo{ "chaperoneHapticFeedbackEnabled" },
-                          false },
-        BoolSettingValue{ BoolSetting::CHAPERONE_chaperoneAlarmSoundEnabled,
-                          SettingCategory::Chaperone,
-                          QtInfo{ "chaperoneAlarmSoundEnabled" },
-                          false },
-        BoolSettingValue{ BoolSetting::CHAPERONE_chaperoneAlarmSoundLooping,
-                          SettingCategory::Chaperone,
-                          QtInfo{ "chaperoneAlarmSoundLooping" },
-                          true },
-        BoolSettingValue{
-            BoolSetting::CHAPERONE_chaperoneAlarmSoundAdjustVolume,
-            SettingCategory::Chaperone,
-            QtInfo{ "chaperoneAlarmSoundAdjustVolume" },
-            false },
-        BoolSettingValue{ BoolSetting::CHAPERONE_chaperoneShowDashboardEnabled,
-                          SettingCategory::Chaperone,
-                          QtInfo{ "chaperoneShowDashboardEnabled" },
-                          false },
-        BoolSettingValue{ BoolSetting::CHAPERONE_disableChaperone,
-                          SettingCategory::Chaperone,
-                          QtInfo{ "disableChaperone" },
-                          false },
+        BOOL_SETTINGS( BOOL_SETTING_VALUE )
     };
 
     constexpr static auto doubleSettingSize
         = static_cast<int>( DoubleSetting::LAST_ENUMERATOR ) + 1;
     std::array<DoubleSettingValue, doubleSettingSize> m_doubleSettings{
-        DoubleSettingValue{ DoubleSetting::PLAYSPACE_heightToggleOffset,
-                            SettingCategory::Playspace,
-                            QtInfo{ "heightToggleOffset" },
-                            -1.0 },
-        DoubleSettingValue{ DoubleSetting::PLAYSPACE_gravityStrength,
-                            SettingCategory::Playspace,
-                            QtInfo{ "gravityStrength" },
-                            9.8 },
-        DoubleSettingValue{ DoubleSetting::PLAYSPACE_flingStrength,
-                            SettingCategory::Playspace,
-                            QtInfo{ "flingStrength" },
-                            1.0 },
-
-        DoubleSettingValue{ DoubleSetting::VIDEO_brightnessOpacityValue,
-                            SettingCategory::Video,
-                            QtInfo{ "brightnessOpacityValue" },
-                            0.0 },
-        DoubleSettingValue{ DoubleSetting::VIDEO_colorOverlayOpacity,
-                            SettingCategory::Video,
-                            QtInfo{ "colorOverlayOpacity" },
-                            0.0 },
-        DoubleSettingValue{ DoubleSetting::VIDEO_colorRed,
-                            SettingCategory::Video,
-                            QtInfo{ "colorRedNew" },
-                            1.0 },
-        DoubleSettingValue{ DoubleSetting::VIDEO_colorGreen,
-                            SettingCategory::Video,
-                            QtInfo{ "colorGreenNew" },
-                            1.0 },
-        DoubleSettingValue{ DoubleSetting::VIDEO_colorBlue,
-                            SettingCategory::Video,
-                            QtInfo{ "colorBlueNew" },
-                            1.0 },
-
-        DoubleSettingValue{ DoubleSetting::CHAPERONE_switchToBeginnerDistance,
-                            SettingCategory::Video,
-                            QtInfo{ "chaperoneSwitchToBeginnerDistance" },
-                            0.5 },
-        DoubleSettingValue{ DoubleSetting::CHAPERONE_hapticFeedbackDistance,
-                            SettingCategory::Video,
-                            QtInfo{ "chaperoneHapticFeedbackDistance" },
-                            0.5 },
-        DoubleSettingValue{ DoubleSetting::CHAPERONE_alarmSoundDistance,
-                            SettingCategory::Video,
-                            QtInfo{ "chaperoneAlarmSoundDistance" },
-                            0.5 },
-        DoubleSettingValue{ DoubleSetting::CHAPERONE_showDashboardDistance,
-                            SettingCategory::Video,
-                            QtInfo{ "chaperoneShowDashboardDistance" },
-                            0.5 },
-        DoubleSettingValue{ DoubleSetting::CHAPERONE_fadeDistanceRemembered,
-                            SettingCategory::Chaperone,
-                            QtInfo{ "fadeDistanceRemembered" },
-                            0.5 },
+        DOUBLE_SETTINGS( DOUBLE_SETTING_VALUE )
     };
 
     constexpr static auto stringSettingsSize
         = static_cast<int>( StringSetting::LAST_ENUMERATOR ) + 1;
-    constexpr static auto discordDefaultMuteKeybinding = "^>m";
     std::array<StringSettingValue, stringSettingsSize> m_stringSettings{
-        StringSettingValue{ StringSetting::KEYBOARDSHORTCUT_keyboardOne,
-                            SettingCategory::KeyboardShortcut,
-                            QtInfo{ "keyboardOne" },
-                            discordDefaultMuteKeybinding },
-        StringSettingValue{ StringSetting::KEYBOARDSHORTCUT_keyboardTwo,
-                            SettingCategory::KeyboardShortcut,
-                            QtInfo{ "keyboardTwo" },
-                            discordDefaultMuteKeybinding },
-        StringSettingValue{ StringSetting::KEYBOARDSHORTCUT_keyboardThree,
-                            SettingCategory::KeyboardShortcut,
-                            QtInfo{ "keyboardThree" },
-                            discordDefaultMuteKeybinding },
+        STRING_SETTINGS( STRING_SETTING_VALUE )
     };
 
     constexpr static auto intSettingsSize
         = static_cast<int>( IntSetting::LAST_ENUMERATOR ) + 1;
     std::array<IntSettingValue, intSettingsSize> m_intSettings{
-        IntSettingValue{ IntSetting::PLAYSPACE_snapTurnAngle,
-                         SettingCategory::Playspace,
-                         QtInfo{ "snapTurnAngle" },
-                         4500 },
-        IntSettingValue{ IntSetting::PLAYSPACE_smoothTurnRate,
-                         SettingCategory::Playspace,
-                         QtInfo{ "smoothTurnRate" },
-                         100 },
-        IntSettingValue{ IntSetting::PLAYSPACE_dragComfortFactor,
-                         SettingCategory::Playspace,
-                         QtInfo{ "dragComfortFactor" },
-                         0 },
-        IntSettingValue{ IntSetting::PLAYSPACE_turnComfortFactor,
-                         SettingCategory::Playspace,
-                         QtInfo{ "turnComfortFactor" },
-                         0 },
-        IntSettingValue{ IntSetting::PLAYSPACE_frictionPercent,
-                         SettingCategory::Playspace,
-                         QtInfo{ "frictionPercent" },
-                         0 },
-
-        IntSettingValue{ IntSetting::APPLICATION_debugState,
-                         SettingCategory::Application,
-                         QtInfo{ "debugState" },
-                         0 },
-        IntSettingValue{ IntSetting::APPLICATION_customTickRateMs,
-                         SettingCategory::Application,
-                         QtInfo{ "customTickRateMs" },
-                         20 },
-
-        IntSettingValue{ IntSetting::UTILITY_alarmHour,
-                         SettingCategory::Utility,
-                         QtInfo{ "alarmHour" },
-                         0 },
-        IntSettingValue{ IntSetting::UTILITY_alarmMinute,
-                         SettingCategory::Utility,
-                         QtInfo{ "alarmMinute" },
-                         0 },
-
+        INT_SETTINGS( INT_SETTING_VALUE )
     };
 };
+
+#undef BOOL_SETTING_VALUE
+#undef DOUBLE_SETTING_VALUE
+#undef STRING_SETTING_VALUE
+#undef INT_SETTING_VALUE
+
 } // namespace settings
@@ -0,0 +1,74 @@
+#pragma once
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <functional>
+
+namespace settings
+{
+/*!
+   \brief Calls a reload function after the settings file was changed on
+   disk.
+
+   Bursts of change notifications are merged into a single reload
+   \c k_debounceMs after the last one. If the reload function returns false
+   it is tried again after the same delay.
+ */
+class SettingsFileWatcher : public QObject
+{
+public:
+    using ReloadFunction = std::function<bool()>;
+
+    static constexpr int k_debounceMs = 250;
+
+    SettingsFileWatcher( const QString fileName,
+                         ReloadFunction reload,
+                         QObject* parent = nullptr )
+        : QObject( parent ), m_fileName( fileName ),
+          m_reload( std::move( reload ) )
+    {
+        m_debounceTimer.setSingleShot( true );
+        m_debounceTimer.setInterval( k_debounceMs );
+
+        connect( &m_watcher,
+                 &QFileSystemWatcher::fileChanged,
+                 &m_debounceTimer,
+                 qOverload<>( &QTimer::start ) );
+        // QSettings replaces the file with a renamed temporary file, which
+        // removes it from the watcher. The directory notices the new file.
+        connect( &m_watcher,
+                 &QFileSystemWatcher::directoryChanged,
+                 &m_debounceTimer,
+                 qOverload<>( &QTimer::start ) );
+        connect( &m_debounceTimer, &QTimer::timeout, this, [this] {
+            watchFile();
+            if ( !m_reload() )
+            {
+                m_debounceTimer.start();
+            }
+        } );
+
+        m_watcher.addPath( QFileInfo( m_fileName ).absolutePath() );
+        watchFile();
+    }
+
+private:
+    void watchFile()
+    {
+        if ( !m_watcher.files().contains( m_fileName )
+             && QFileInfo::exists( m_fileName ) )
+        {
+            m_watcher.addPath( m_fileName );
+        }
+    }
+
+    const QString m_fileName;
+    ReloadFunction m_reload;
+
+    QFileSystemWatcher m_watcher{ this };
+    QTimer m_debounceTimer{ this };
+};
+
+} // namespace settings
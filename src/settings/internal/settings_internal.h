@@ -2,7 +2,7 @@
 #include <QSettings>
 #include <string>
 #include <type_traits>
-#include "../../overlaycontroller.h"
+#include "../../application_strings.h"
 
 namespace settings
 {
@@ -99,4 +99,28 @@ template <typename Value>[[nodiscard]] bool isValidQVariant( const QVariant v )
     return false;
 }
 
+/*!
+   \brief Converts a value read from QSettings. Check it with
+   \c isValidQVariant first.
+ */
+template <typename Value>[[nodiscard]] Value fromQVariant( const QVariant v )
+{
+    if constexpr ( std::is_same<Value, bool>::value )
+    {
+        return v.toBool();
+    }
+    else if constexpr ( std::is_same<Value, double>::value )
+    {
+        return v.toDouble();
+    }
+    else if constexpr ( std::is_same<Value, std::string>::value )
+    {
+        return v.toString().toStdString();
+    }
+    else if constexpr ( std::is_same<Value, int>::value )
+    {
+        return v.toInt();
+    }
+}
+
 } // namespace settings
@@ -1,45 +1,54 @@
 #pragma once
-#include <list>
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <easylogging++.h>
 
 namespace settings
 {
+/*!
+   \brief Values of a settings object, stored contiguously per type.
+
+   Values are read back in the order they were added through a read cursor
+   per type. Reading advances the cursor instead of erasing from the front,
+   but moves the value out, so read values are left empty and an object
+   can only be read once.
+ */
 class SettingsObjectData
 {
 public:
+    // String literals are stored as std::string.
+    template <typename Value>
+    using StoredValue = std::conditional_t<
+        std::is_same<const char*, Value>::value, std::string, Value>;
+
     template <typename Value> void addValue( const Value value )
     {
-        auto& list = getListObject<Value>();
+        auto& values = getValues<Value>();
 
-        list.push_back( value );
+        values.emplace_back( value );
     }
 
+    /*!
+       \brief Moves the next unread value of type \c Value out of the object.
+     */
     template <typename Value>
-    auto getNextValueOrDefault( const Value defaultValue )
+    StoredValue<Value> getNextValueOrDefault( const Value defaultValue )
     {
-        auto& list = getListObject<Value>();
-
         if ( hasValuesOfType<Value>() )
         {
-            auto returnedValue = list.front();
-            list.pop_front();
-            return returnedValue;
-        }
-        if constexpr ( std::is_same<const char*, Value>::value )
-        {
-            return std::string( defaultValue );
-        }
-        else
-        {
-            return defaultValue;
+            auto& values = getValues<Value>();
+            auto& cursor = getCursor<Value>();
+            return StoredValue<Value>( std::move( values[cursor++] ) );
         }
+        return StoredValue<Value>( defaultValue );
     }
 
     template <typename Value> bool hasValuesOfType()
     {
-        auto& list = getListObject<Value>();
-
-        return !list.empty();
+        return getCursor<Value>() < getValues<Value>().size();
     }
 
     template <typename Value> void consumeDeprecatedValue()
@@ -52,8 +61,70 @@ class SettingsObjectData
         addValue( value );
     }
 
+    template <typename Value> void reserve( const std::size_t count )
+    {
+        getValues<Value>().reserve( count );
+    }
+
+    /*!
+       \brief Moves all unread values of type \c Value out of the object.
+     */
+    template <typename Value> std::vector<StoredValue<Value>> takeValues()
+    {
+        auto& values = getValues<Value>();
+        auto& cursor = getCursor<Value>();
+
+        values.erase( values.begin(),
+                      values.begin() + static_cast<std::ptrdiff_t>( cursor ) );
+        cursor = 0;
+
+        return std::move( values );
+    }
+
+    /*!
+       \brief Replaces all values of type \c Value with \a values.
+     */
+    template <typename Value>
+    void setValues( std::vector<StoredValue<Value>>&& values ) noexcept
+    {
+        getValues<Value>() = std::move( values );
+        getCursor<Value>() = 0;
+    }
+
+    /*!
+       \brief Compares the values that haven't been read yet.
+
+       Values that were read are moved out, so they can't be compared. To
+       compare everything an object holds, compare freshly created
+       \c saveSettings results.
+     */
+    bool operator==( const SettingsObjectData& other ) const
+    {
+        return unreadEqual<bool>( m_boolValues, other, other.m_boolValues )
+               && unreadEqual<int>( m_intValues, other, other.m_intValues )
+               && unreadEqual<double>(
+                   m_doubleValues, other, other.m_doubleValues )
+               && unreadEqual<std::string>(
+                   m_stringValues, other, other.m_stringValues );
+    }
+
 private:
-    template <typename Value> auto& getListObject()
+    template <typename Value, typename Values>
+    bool unreadEqual( const Values& values,
+                      const SettingsObjectData& other,
+                      const Values& otherValues ) const
+    {
+        constexpr auto index = typeIndex<Value>();
+        const auto unread = []( const Values& v, const std::size_t cursor ) {
+            return v.begin() + static_cast<std::ptrdiff_t>( cursor );
+        };
+        return std::equal( unread( values, m_cursors[index] ),
+                           values.end(),
+                           unread( otherValues, other.m_cursors[index] ),
+                           otherValues.end() );
+    }
+
+    template <typename Value> constexpr static std::size_t typeIndex()
     {
         using std::is_same;
         const auto isBool = is_same<bool, Value>::value;
@@ -71,25 +142,54 @@ class SettingsObjectData
 
         if constexpr ( isBool )
         {
-            return m_boolValues;
+            return 0;
         }
         else if constexpr ( isInt )
         {
-            return m_intValues;
+            return 1;
         }
         else if constexpr ( isDouble )
+        {
+            return 2;
+        }
+        else
+        {
+            return 3;
+        }
+    }
+
+    template <typename Value> auto& getValues()
+    {
+        constexpr auto index = typeIndex<Value>();
+
+        if constexpr ( index == 0 )
+        {
+            return m_boolValues;
+        }
+        else if constexpr ( index == 1 )
+        {
+            return m_intValues;
+        }
+        else if constexpr ( index == 2 )
         {
             return m_doubleValues;
         }
-        else if constexpr ( isString )
+        else
         {
             return m_stringValues;
         }
     }
 
-    std::list<bool> m_boolValues;
-    std::list<int> m_intValues;
-    std::list<double> m_doubleValues;
-    std::list<std::string> m_stringValues;
+    template <typename Value> std::size_t& getCursor()
+    {
+        return m_cursors[typeIndex<Value>()];
+    }
+
+    std::vector<bool> m_boolValues;
+    std::vector<int> m_intValues;
+    std::vector<double> m_doubleValues;
+    std::vector<std::string> m_stringValues;
+
+    std::size_t m_cursors[4] = {};
 };
 } // namespace settings
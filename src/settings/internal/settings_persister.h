@@ -0,0 +1,162 @@
+#pragma once
+#include <QSettings>
+#include <QString>
+#include <QVariant>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <easylogging++.h>
+
+namespace settings
+{
+struct PendingSetting
+{
+    QString group;
+    QString key;
+    QVariant value;
+};
+
+// Values are copied when the snapshot is taken, the GUI thread can keep
+// changing settings while it is written.
+using SettingsSnapshot = std::vector<PendingSetting>;
+
+/*!
+   \brief Writes settings snapshots to the settings file on a worker thread.
+
+   Each snapshot is written with its own QSettings instance and synced.
+   QSettings writes ini files through a temporary file that is renamed over
+   the original, so the file on disk is never partially written.
+ */
+class SettingsPersister
+{
+public:
+    explicit SettingsPersister( const QString fileName )
+        : m_fileName( fileName )
+    {
+    }
+
+    ~SettingsPersister()
+    {
+        flush();
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_running = false;
+        }
+        m_queueChanged.notify_all();
+        if ( m_worker.joinable() )
+        {
+            m_worker.join();
+        }
+    }
+
+    SettingsPersister( const SettingsPersister& ) = delete;
+    SettingsPersister& operator=( const SettingsPersister& ) = delete;
+
+    /*!
+       \brief Queues \a snapshot for writing and returns immediately.
+     */
+    void persist( SettingsSnapshot snapshot )
+    {
+        if ( snapshot.empty() )
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            if ( !m_worker.joinable() )
+            {
+                // Started on first use so that nothing runs during static
+                // initialization.
+                m_worker = std::thread( &SettingsPersister::run, this );
+            }
+            m_queue.push_back( std::move( snapshot ) );
+        }
+        m_queueChanged.notify_all();
+    }
+
+    /*!
+       \return true if nothing is queued or being written.
+     */
+    [[nodiscard]] bool isIdle()
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        return m_queue.empty() && !m_writing;
+    }
+
+    /*!
+       \brief Blocks until every queued snapshot has been written.
+     */
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_queueChanged.wait(
+            lock, [this] { return m_queue.empty() && !m_writing; } );
+    }
+
+    /*!
+       \brief Number of times the settings file has been written, one per
+       snapshot.
+     */
+    [[nodiscard]] unsigned long long fileWrites()
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        return m_fileWrites;
+    }
+
+private:
+    void run()
+    {
+        QSettings s( m_fileName, QSettings::IniFormat );
+
+        std::unique_lock<std::mutex> lock( m_mutex );
+        while ( true )
+        {
+            m_queueChanged.wait(
+                lock, [this] { return !m_queue.empty() || !m_running; } );
+            if ( m_queue.empty() )
+            {
+                return;
+            }
+
+            auto snapshot = std::move( m_queue.front() );
+            m_queue.pop_front();
+            m_writing = true;
+            lock.unlock();
+
+            for ( const auto& setting : snapshot )
+            {
+                s.beginGroup( setting.group );
+                s.setValue( setting.key, setting.value );
+                s.endGroup();
+            }
+            s.sync();
+
+            if ( s.status() != QSettings::NoError )
+            {
+                LOG( ERROR ) << "Could not write settings file '"
+                             << m_fileName.toStdString() << "'.";
+            }
+
+            lock.lock();
+            ++m_fileWrites;
+            m_writing = false;
+            m_queueChanged.notify_all();
+        }
+    }
+
+    const QString m_fileName;
+
+    std::mutex m_mutex;
+    std::condition_variable m_queueChanged;
+    std::deque<SettingsSnapshot> m_queue;
+    bool m_writing = false;
+    bool m_running = true;
+    unsigned long long m_fileWrites = 0;
+
+    std::thread m_worker;
+};
+
+} // namespace settings
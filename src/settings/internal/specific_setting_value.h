@@ -28,25 +28,7 @@ class SpecificSettingValue : public SettingValue
 
         if ( isValidQVariant<Value>( v ) )
         {
-            if constexpr ( std::is_same<Value, bool>::value )
-            {
-                m_value = v.toBool();
-            }
-
-            else if constexpr ( std::is_same<Value, double>::value )
-            {
-                m_value = v.toDouble();
-            }
-
-            else if constexpr ( std::is_same<Value, std::string>::value )
-            {
-                m_value = v.toString().toStdString();
-            }
-
-            else if constexpr ( std::is_same<Value, int>::value )
-            {
-                m_value = v.toInt();
-            }
+            m_value = fromQVariant<Value>( v );
         }
 
         else
@@ -56,9 +38,19 @@ class SpecificSettingValue : public SettingValue
         }
     }
 
-    void setValue( const Value value ) noexcept
+    /*!
+       \brief Sets the value.
+       \return false if \a value is equal to the current value.
+     */
+    [[nodiscard]] bool setValue( const Value value ) noexcept
     {
+        if ( m_value == value )
+        {
+            return false;
+        }
+
         m_value = value;
+        return true;
     }
 
     [[nodiscard]] Value value() const noexcept
@@ -81,24 +73,30 @@ class SpecificSettingValue : public SettingValue
         return SettingValue::qtInfo();
     }
 
-    void saveValue() override
+    /*!
+       \brief Returns the value in the form it is stored in QSettings.
+     */
+    [[nodiscard]] QVariant qVariantValue() const
     {
         if constexpr ( !std::is_same<Value, std::string>::value )
         {
-            saveQtSetting( SettingValue::category(),
-                           SettingValue::qtInfo().settingName,
-                           m_value );
+            return m_value;
         }
         else
         {
             // Special case for std::string because it can't be auto
             // converted to QVariant
-            saveQtSetting( SettingValue::category(),
-                           SettingValue::qtInfo().settingName,
-                           m_value.c_str() );
+            return QString::fromStdString( m_value );
         }
     }
 
+    void saveValue() override
+    {
+        saveQtSetting( SettingValue::category(),
+                       SettingValue::qtInfo().settingName,
+                       qVariantValue() );
+    }
+
 private:
     const Setting m_setting;
     Value m_value;
@@ -0,0 +1,34 @@
+#include "profile_collection.h"
+#include <algorithm>
+
+namespace
+{
+std::vector<settings::ProfileCollection*>& registeredCollections()
+{
+    static std::vector<settings::ProfileCollection*> collections;
+    return collections;
+}
+
+} // namespace
+
+namespace settings
+{
+void registerProfileCollection( ProfileCollection& collection )
+{
+    registeredCollections().push_back( &collection );
+}
+
+void unregisterProfileCollection( ProfileCollection& collection )
+{
+    auto& collections = registeredCollections();
+    collections.erase(
+        std::remove( collections.begin(), collections.end(), &collection ),
+        collections.end() );
+}
+
+const std::vector<ProfileCollection*>& profileCollections()
+{
+    return registeredCollections();
+}
+
+} // namespace settings
@@ -0,0 +1,34 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "internal/settings_object_data.h"
+
+namespace settings
+{
+/*!
+   \brief A saved list of profiles that is part of settings snapshots.
+
+   \c ProfileStore registers itself for as long as it exists.
+ */
+class ProfileCollection
+{
+public:
+    virtual ~ProfileCollection() {}
+
+    virtual std::string profileSettingsName() const = 0;
+
+    virtual std::vector<SettingsObjectData> exportProfiles() = 0;
+
+    /*!
+       \brief Replaces all profiles with \a profiles and saves them.
+       \return Number of profiles that were added, changed or removed.
+     */
+    virtual int importProfiles( std::vector<SettingsObjectData> profiles ) = 0;
+};
+
+void registerProfileCollection( ProfileCollection& collection );
+void unregisterProfileCollection( ProfileCollection& collection );
+
+[[nodiscard]] const std::vector<ProfileCollection*>& profileCollections();
+
+} // namespace settings
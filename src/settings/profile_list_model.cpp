@@ -0,0 +1,85 @@
+#include "profile_list_model.h"
+
+namespace
+{
+int profileRow( const std::size_t index )
+{
+    return static_cast<int>( index ) + 1;
+}
+
+} // namespace
+
+namespace settings
+{
+ProfileListModel::ProfileListModel( const ProfileNameList& profiles )
+    : m_profiles( profiles )
+{
+}
+
+int ProfileListModel::rowCount( const QModelIndex& parent ) const
+{
+    if ( parent.isValid() )
+    {
+        return 0;
+    }
+    return profileRow( m_profiles.size() );
+}
+
+QVariant ProfileListModel::data( const QModelIndex& index,
+                                 const int role ) const
+{
+    if ( role != Qt::DisplayRole || !index.isValid() || index.row() < 0
+         || index.row() >= rowCount() )
+    {
+        return QVariant();
+    }
+    if ( index.row() == 0 )
+    {
+        return QString();
+    }
+    return QString::fromStdString(
+        m_profiles.name( static_cast<std::size_t>( index.row() - 1 ) ) );
+}
+
+QHash<int, QByteArray> ProfileListModel::roleNames() const
+{
+    return { { Qt::DisplayRole, "display" } };
+}
+
+void ProfileListModel::beginResetProfiles()
+{
+    beginResetModel();
+}
+
+void ProfileListModel::endResetProfiles()
+{
+    endResetModel();
+}
+
+void ProfileListModel::beginInsertProfile( const std::size_t index )
+{
+    beginInsertRows( QModelIndex(), profileRow( index ), profileRow( index ) );
+}
+
+void ProfileListModel::endInsertProfile()
+{
+    endInsertRows();
+}
+
+void ProfileListModel::beginRemoveProfile( const std::size_t index )
+{
+    beginRemoveRows( QModelIndex(), profileRow( index ), profileRow( index ) );
+}
+
+void ProfileListModel::endRemoveProfile()
+{
+    endRemoveRows();
+}
+
+void ProfileListModel::profileChanged( const std::size_t index )
+{
+    const auto i = createIndex( profileRow( index ), 0 );
+    emit dataChanged( i, i, { Qt::DisplayRole } );
+}
+
+} // namespace settings
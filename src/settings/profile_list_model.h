@@ -0,0 +1,48 @@
+#pragma once
+#include <QAbstractListModel>
+#include <string>
+
+namespace settings
+{
+class ProfileNameList
+{
+public:
+    virtual ~ProfileNameList() {}
+
+    virtual std::size_t size() const noexcept = 0;
+    virtual const std::string& name( std::size_t index ) const = 0;
+};
+
+/*!
+   \brief Profile names for QML combo boxes.
+
+   Row 0 is an empty entry for "no profile selected", profile \c i is in row
+   \c{i + 1}. The model has a single role so delegates can use
+   \c modelData.
+ */
+class ProfileListModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    explicit ProfileListModel( const ProfileNameList& profiles );
+
+    int rowCount( const QModelIndex& parent = QModelIndex() ) const override;
+    QVariant data( const QModelIndex& index,
+                   int role = Qt::DisplayRole ) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    // Called by the owning store around changes to the profiles.
+    void beginResetProfiles();
+    void endResetProfiles();
+    void beginInsertProfile( std::size_t index );
+    void endInsertProfile();
+    void beginRemoveProfile( std::size_t index );
+    void endRemoveProfile();
+    void profileChanged( std::size_t index );
+
+private:
+    const ProfileNameList& m_profiles;
+};
+
+} // namespace settings
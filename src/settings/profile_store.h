@@ -0,0 +1,538 @@
+#pragma once
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include "settings_object.h"
+#include "profile_list_model.h"
+#include "profile_collection.h"
+
+namespace settings
+{
+/*!
+   \brief Names and default flags of the profiles in a \c ProfileStore,
+   saved next to the profiles so they can be listed without loading every
+   profile.
+ */
+struct ProfileNameIndex : ISettingsObject
+{
+    std::string profileSettingsName;
+    std::vector<std::string> names;
+    std::vector<bool> defaults;
+    // Indices written before the default flags were added have none.
+    bool hasDefaults = false;
+
+    SettingsObjectData saveSettings() const override
+    {
+        SettingsObjectData o;
+        o.reserve<std::string>( names.size() );
+        o.reserve<bool>( defaults.size() );
+        o.addValue( static_cast<int>( names.size() ) );
+        for ( const auto& name : names )
+        {
+            o.addValue( name );
+        }
+        o.addValue( static_cast<int>( defaults.size() ) );
+        for ( const auto isDefault : defaults )
+        {
+            o.addValue( static_cast<bool>( isDefault ) );
+        }
+        return o;
+    }
+
+    void loadSettings( SettingsObjectData& obj ) override
+    {
+        names.resize(
+            static_cast<std::size_t>( obj.getNextValueOrDefault( 0 ) ) );
+        for ( auto& name : names )
+        {
+            name = obj.getNextValueOrDefault( "" );
+        }
+        const auto defaultCount = obj.getNextValueOrDefault( -1 );
+        hasDefaults = defaultCount == static_cast<int>( names.size() );
+        defaults.assign( names.size(), false );
+        for ( std::size_t i = 0; hasDefaults && i < defaults.size(); ++i )
+        {
+            defaults[i] = obj.getNextValueOrDefault( false );
+        }
+    }
+
+    std::string settingsName() const override
+    {
+        return profileSettingsName + "-names";
+    }
+};
+
+/*!
+   \brief Owns the saved profiles of one type.
+
+   Profiles keep the numbered slots used by \c saveAllObjects. Only their
+   names are read on \c load, a profile itself is read from disk the first
+   time it is accessed. \c save only writes profiles that were added or
+   edited, or moved to a different slot by a removal.
+
+   The name index is only checked against the number of slots. If a
+   profile read later has a different name than the index, the index is
+   out of date and every name is read again.
+
+   \a Profile must derive from \c ISettingsObject and have a
+   \c std::string \c profileName member. If it has a \c bool
+   \c defaultProfile member, the flag is kept in the index too.
+ */
+template <class Profile>
+class ProfileStore : public ProfileNameList, public ProfileCollection
+{
+public:
+    ProfileStore() : m_model( *this )
+    {
+        static_assert( std::is_base_of<ISettingsObject, Profile>::value,
+                       "Profiles must inherit from ISettingsObject." );
+        registerProfileCollection( *this );
+    }
+
+    ~ProfileStore() override
+    {
+        unregisterProfileCollection( *this );
+    }
+
+    ProfileStore( const ProfileStore& ) = delete;
+    ProfileStore& operator=( const ProfileStore& ) = delete;
+
+    /*!
+       \brief Reads the profile names. Falls back to reading every profile
+       if the name index is missing or out of date, and writes the index.
+     */
+    void load()
+    {
+        m_model.beginResetProfiles();
+
+        m_entries.clear();
+        m_indices.clear();
+
+        Profile prototype;
+        auto index = nameIndex();
+        loadObject( index );
+        const auto count = getAmountOfSavedObjects( prototype );
+
+        if ( index.names.size() == static_cast<std::size_t>( count )
+             && ( index.hasDefaults || !k_hasDefaultFlag ) )
+        {
+            for ( std::size_t i = 0; i < index.names.size(); ++i )
+            {
+                m_entries.push_back( { index.names[i],
+                                       static_cast<int>( i ) + 1,
+                                       std::nullopt,
+                                       index.defaults[i],
+                                       false } );
+            }
+            m_namesChanged = false;
+        }
+        else
+        {
+            for ( int slot = 1; slot <= count; ++slot )
+            {
+                Profile profile;
+                loadNumberedObject( profile, slot );
+                auto name = profile.profileName;
+                const auto isDefault = defaultFlag( profile );
+                m_entries.push_back( { std::move( name ),
+                                       slot,
+                                       std::move( profile ),
+                                       isDefault,
+                                       false } );
+            }
+            m_namesChanged = true;
+        }
+        m_savedSlots = count;
+        m_loaded = true;
+        rebuildIndices();
+
+        m_model.endResetProfiles();
+
+        if ( m_namesChanged )
+        {
+            saveNameIndex();
+        }
+    }
+
+    /*!
+       \brief Writes changed profiles and removes slots that are no longer
+       used.
+     */
+    void save()
+    {
+        // Bodies must be read before any slot they live in is overwritten.
+        for ( std::size_t i = 0; i < m_entries.size(); ++i )
+        {
+            if ( m_entries[i].changed )
+            {
+                body( i );
+            }
+        }
+
+        for ( std::size_t i = 0; i < m_entries.size(); ++i )
+        {
+            auto& e = m_entries[i];
+            const auto slot = static_cast<int>( i ) + 1;
+            if ( e.changed )
+            {
+                saveNumberedObject( *e.profile, slot );
+                e.changed = false;
+                if ( defaultFlag( *e.profile ) != e.isDefault )
+                {
+                    e.isDefault = !e.isDefault;
+                    m_namesChanged = true;
+                }
+            }
+            e.slot = slot;
+        }
+
+        const auto usedSlots = static_cast<int>( m_entries.size() );
+        for ( int slot = usedSlots + 1; slot <= m_savedSlots; ++slot )
+        {
+            removeNumberedObject( Profile{}, slot );
+        }
+        m_savedSlots = usedSlots;
+
+        if ( m_namesChanged )
+        {
+            saveNameIndex();
+        }
+    }
+
+    std::size_t size() const noexcept override
+    {
+        return m_entries.size();
+    }
+
+    const std::string& name( const std::size_t index ) const override
+    {
+        return m_entries.at( index ).name;
+    }
+
+    /*!
+       \brief Whether the profile at \a index is flagged as default,
+       without reading it from disk.
+     */
+    bool isDefault( const std::size_t index ) const
+    {
+        const auto& e = m_entries.at( index );
+        return e.profile ? defaultFlag( *e.profile ) : e.isDefault;
+    }
+
+    std::optional<std::size_t> indexOf( const std::string& name ) const
+    {
+        const auto it = m_indices.find( name );
+        if ( it == m_indices.end() )
+        {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    /*!
+       \brief Returns the profile at \a index, reading it from disk if
+       necessary.
+     */
+    const Profile& at( const std::size_t index )
+    {
+        return body( index );
+    }
+
+    /*!
+       \brief Returns the profile at \a index for changes that don't alter
+       what \c saveSettings writes, like decoding data that is loaded
+       lazily. It is not written on the next \c save, use \c edit for
+       anything else.
+     */
+    Profile& cached( const std::size_t index )
+    {
+        return body( index );
+    }
+
+    /*!
+       \brief Returns the profile at \a index for modification. It is
+       written on the next \c save. Do not change its name here, use
+       \c rename.
+     */
+    Profile& edit( const std::size_t index )
+    {
+        auto& profile = body( index );
+        m_entries[index].changed = true;
+        return profile;
+    }
+
+    /*!
+       \brief Adds \a profile, or replaces the profile with the same name.
+       \return Index of the profile.
+     */
+    std::size_t put( Profile profile )
+    {
+        if ( const auto existing = indexOf( profile.profileName ) )
+        {
+            auto& e = m_entries[*existing];
+            e.profile = std::move( profile );
+            e.changed = true;
+            return *existing;
+        }
+
+        const auto index = m_entries.size();
+        m_model.beginInsertProfile( index );
+        const auto isDefault = defaultFlag( profile );
+        m_entries.push_back( { profile.profileName,
+                               0,
+                               std::move( profile ),
+                               isDefault,
+                               true } );
+        m_indices.emplace( m_entries.back().name, index );
+        m_namesChanged = true;
+        m_model.endInsertProfile();
+
+        return index;
+    }
+
+    void remove( const std::size_t index )
+    {
+        if ( index >= m_entries.size() )
+        {
+            return;
+        }
+
+        m_model.beginRemoveProfile( index );
+        m_entries.erase( m_entries.begin()
+                         + static_cast<std::ptrdiff_t>( index ) );
+        // Every following profile moves down one slot.
+        for ( auto i = index; i < m_entries.size(); ++i )
+        {
+            m_entries[i].changed = true;
+        }
+        m_namesChanged = true;
+        rebuildIndices();
+        m_model.endRemoveProfile();
+    }
+
+    void rename( const std::size_t index, const std::string& name )
+    {
+        auto& profile = edit( index );
+        m_indices.erase( m_entries[index].name );
+        profile.profileName = name;
+        m_entries[index].name = name;
+        m_indices[name] = index;
+        m_namesChanged = true;
+        m_model.profileChanged( index );
+    }
+
+    std::string profileSettingsName() const override
+    {
+        return Profile{}.settingsName();
+    }
+
+    std::vector<SettingsObjectData> exportProfiles() override
+    {
+        if ( !m_loaded )
+        {
+            load();
+        }
+
+        std::vector<SettingsObjectData> profiles;
+        profiles.reserve( m_entries.size() );
+        for ( std::size_t i = 0; i < m_entries.size(); ++i )
+        {
+            profiles.push_back( body( i ).saveSettings() );
+        }
+        return profiles;
+    }
+
+    int importProfiles( std::vector<SettingsObjectData> profiles ) override
+    {
+        if ( !m_loaded )
+        {
+            load();
+        }
+
+        const auto kept = std::min( profiles.size(), m_entries.size() );
+        auto changes = static_cast<int>(
+            std::max( profiles.size(), m_entries.size() ) - kept );
+
+        m_model.beginResetProfiles();
+
+        m_entries.resize( kept );
+        for ( std::size_t i = 0; i < profiles.size(); ++i )
+        {
+            Profile profile;
+            profile.loadSettings( profiles[i] );
+
+            if ( i < kept )
+            {
+                // Compared in saved form so defaults filled in by
+                // loadSettings don't count as a change.
+                if ( body( i ).saveSettings() == profile.saveSettings() )
+                {
+                    continue;
+                }
+                ++changes;
+                auto& e = m_entries[i];
+                e.name = profile.profileName;
+                e.profile = std::move( profile );
+                e.changed = true;
+            }
+            else
+            {
+                auto name = profile.profileName;
+                const auto isDefault = defaultFlag( profile );
+                m_entries.push_back( { std::move( name ),
+                                       0,
+                                       std::move( profile ),
+                                       isDefault,
+                                       true } );
+            }
+        }
+        if ( changes > 0 )
+        {
+            m_namesChanged = true;
+        }
+        rebuildIndices();
+
+        m_model.endResetProfiles();
+
+        save();
+        return changes;
+    }
+
+    /*!
+       \brief Number of profiles that have been read from disk.
+     */
+    std::size_t loadedCount() const noexcept
+    {
+        std::size_t count = 0;
+        for ( const auto& e : m_entries )
+        {
+            count += e.profile.has_value() ? 1 : 0;
+        }
+        return count;
+    }
+
+    ProfileListModel& model() noexcept
+    {
+        return m_model;
+    }
+
+private:
+    struct Entry
+    {
+        std::string name;
+        // Slot the profile is stored in on disk, 0 if not saved yet.
+        int slot;
+        std::optional<Profile> profile;
+        // As in the index, the profile's own flag counts once it is read.
+        bool isDefault;
+        bool changed;
+    };
+
+    template <class T, class = void>
+    struct HasDefaultFlag : std::false_type
+    {
+    };
+
+    template <class T>
+    struct HasDefaultFlag<T, std::void_t<decltype( T::defaultProfile )>>
+        : std::true_type
+    {
+    };
+
+    static constexpr bool k_hasDefaultFlag = HasDefaultFlag<Profile>::value;
+
+    static bool defaultFlag( const Profile& profile )
+    {
+        if constexpr ( k_hasDefaultFlag )
+        {
+            return profile.defaultProfile;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    static ProfileNameIndex nameIndex()
+    {
+        ProfileNameIndex index;
+        index.profileSettingsName = Profile{}.settingsName();
+        return index;
+    }
+
+    Profile& body( const std::size_t index )
+    {
+        auto& e = m_entries.at( index );
+        if ( !e.profile )
+        {
+            e.profile.emplace();
+            loadNumberedObject( *e.profile, e.slot );
+            // Another version of the application may have saved the
+            // profiles without updating the index.
+            if ( e.profile->profileName != e.name )
+            {
+                reloadNames();
+            }
+        }
+        return *e.profile;
+    }
+
+    // Reads every profile that wasn't read yet and takes the names from
+    // the profiles. Entries keep their place, references stay valid.
+    void reloadNames()
+    {
+        for ( std::size_t i = 0; i < m_entries.size(); ++i )
+        {
+            auto& e = m_entries[i];
+            if ( !e.profile )
+            {
+                e.profile.emplace();
+                loadNumberedObject( *e.profile, e.slot );
+            }
+            e.isDefault = defaultFlag( *e.profile );
+            if ( e.profile->profileName != e.name )
+            {
+                e.name = e.profile->profileName;
+                m_model.profileChanged( i );
+            }
+        }
+        rebuildIndices();
+        saveNameIndex();
+    }
+
+    void rebuildIndices()
+    {
+        m_indices.clear();
+        for ( std::size_t i = 0; i < m_entries.size(); ++i )
+        {
+            m_indices.emplace( m_entries[i].name, i );
+        }
+    }
+
+    void saveNameIndex()
+    {
+        auto index = nameIndex();
+        index.names.reserve( m_entries.size() );
+        index.defaults.reserve( m_entries.size() );
+        for ( std::size_t i = 0; i < m_entries.size(); ++i )
+        {
+            index.names.push_back( m_entries[i].name );
+            index.defaults.push_back( isDefault( i ) );
+        }
+        saveObject( index );
+        m_namesChanged = false;
+    }
+
+    std::vector<Entry> m_entries;
+    std::unordered_map<std::string, std::size_t> m_indices;
+    int m_savedSlots = 0;
+    bool m_namesChanged = false;
+    bool m_loaded = false;
+
+    ProfileListModel m_model;
+};
+
+} // namespace settings
@@ -0,0 +1,127 @@
+#pragma once
+
+// Every setting is declared once in the lists below. The enums in
+// settings.h and the setting values in settings_controller.h are generated
+// from them, so the enum value of a setting is always its index.
+//
+// Entries are SETTING( enumName, SettingCategory, qtKey, defaultValue ).
+// Changing a category or Qt key moves the setting in the settings file.
+
+#define BOOL_SETTINGS( SETTING )                                              \
+    SETTING( PLAYSPACE_lockXToggle, Playspace, "lockXToggle", false )         \
+    SETTING( PLAYSPACE_lockYToggle, Playspace, "lockYToggle", false )         \
+    SETTING( PLAYSPACE_lockZToggle, Playspace, "lockZToggle", false )         \
+    SETTING( PLAYSPACE_momentumSave, Playspace, "momentumSave", false )       \
+    SETTING( PLAYSPACE_turnBindLeft, Playspace, "turnBindLeft", false )       \
+    SETTING( PLAYSPACE_turnBindRight, Playspace, "turnBindRight", false )     \
+    SETTING( PLAYSPACE_turnBounds, Playspace, "turnBounds", false )           \
+    SETTING( PLAYSPACE_moveShortcutLeft,                                      \
+             Playspace, "moveShortcutLeft", false )                           \
+    SETTING( PLAYSPACE_moveShortcutRight,                                     \
+             Playspace, "moveShortcutRight", false )                          \
+    SETTING( PLAYSPACE_dragBounds, Playspace, "dragBounds", false )           \
+    SETTING( PLAYSPACE_allowExternalEdits,                                    \
+             Playspace, "allowExternalEdits", false )                         \
+    SETTING( PLAYSPACE_oldStyleMotion, Playspace, "oldStyleMotion", false )   \
+    SETTING( PLAYSPACE_universeCenteredRotation,                              \
+             Playspace, "universeCenteredRotation", false )                   \
+    SETTING( PLAYSPACE_enableSeatedMotion,                                    \
+             Playspace, "enableSeatedMotion", false )                         \
+    SETTING( PLAYSPACE_adjustChaperone, Playspace, "adjustChaperone", true )  \
+    SETTING( PLAYSPACE_showLogMatricesButton,                                 \
+             Playspace, "showLogMatricesButton", false )                      \
+    SETTING( PLAYSPACE_simpleRecenter, Playspace, "simpleRecenter", false )   \
+                                                                              \
+    SETTING( APPLICATION_disableVersionCheck,                                 \
+             Application, "disableVersionCheck", false )                      \
+    SETTING( APPLICATION_previousShutdownSafe,                                \
+             Application, "previousShutdownSafe", true )                      \
+    SETTING( APPLICATION_vsyncDisabled, Application, "vsyncDisabled", false ) \
+    SETTING( APPLICATION_crashRecoveryDisabled,                               \
+             Application, "crashRecoveryDisabled", false )                    \
+    SETTING( APPLICATION_enableDebug, Application, "enableDebug", false )     \
+                                                                              \
+    SETTING( AUDIO_pttEnabled, Audio, "pttEnabled", false )                   \
+    SETTING( AUDIO_pttShowNotification, Audio, "pttShowNotification", false ) \
+    SETTING( AUDIO_micProximitySensorCanMute,                                 \
+             Audio, "micProximitySensorCanMute", false )                      \
+    SETTING( AUDIO_micReversePtt, Audio, "micReversePtt", false )             \
+                                                                              \
+    SETTING( UTILITY_alarmEnabled, Utility, "alarmEnabled", false )           \
+    SETTING( UTILITY_alarmIsModal, Utility, "alarmIsModal", true )            \
+    SETTING( UTILITY_vrcDebug, Utility, "vrcDebug", false )                   \
+                                                                              \
+    SETTING( VIDEO_brightnessEnabled, Video, "brightnessEnabled", false )     \
+    SETTING( VIDEO_isOverlayMethodActive,                                     \
+             Video, "isOverlayMethodActive", false )                          \
+    SETTING( VIDEO_colorOverlayEnabled, Video, "colorOverlayEnabled", false ) \
+                                                                              \
+    SETTING( CHAPERONE_chaperoneSwitchToBeginnerEnabled,                      \
+             Chaperone, "chaperoneSwitchToBeginnerEnabled", false )           \
+    SETTING( CHAPERONE_chaperoneHapticFeedbackEnabled,                        \
+             Chaperone, "chaperoneHapticFeedbackEnabled", false )             \
+    SETTING( CHAPERONE_chaperoneAlarmSoundEnabled,                            \
+             Chaperone, "chaperoneAlarmSoundEnabled", false )                 \
+    SETTING( CHAPERONE_chaperoneAlarmSoundLooping,                            \
+             Chaperone, "chaperoneAlarmSoundLooping", true )                  \
+    SETTING( CHAPERONE_chaperoneAlarmSoundAdjustVolume,                       \
+             Chaperone, "chaperoneAlarmSoundAdjustVolume", false )            \
+    SETTING( CHAPERONE_chaperoneShowDashboardEnabled,                         \
+             Chaperone, "chaperoneShowDashboardEnabled", false )              \
+    SETTING( CHAPERONE_disableChaperone,                                      \
+             Chaperone, "disableChaperone", false )
+
+#define DOUBLE_SETTINGS( SETTING )                                            \
+    SETTING( PLAYSPACE_heightToggleOffset,                                    \
+             Playspace, "heightToggleOffset", -1.0 )                          \
+    SETTING( PLAYSPACE_gravityStrength, Playspace, "gravityStrength", 9.8 )   \
+    SETTING( PLAYSPACE_flingStrength, Playspace, "flingStrength", 1.0 )       \
+                                                                              \
+    SETTING( VIDEO_brightnessOpacityValue,                                    \
+             Video, "brightnessOpacityValue", 0.0 )                           \
+    SETTING( VIDEO_colorOverlayOpacity, Video, "colorOverlayOpacity", 0.0 )   \
+    SETTING( VIDEO_colorRed, Video, "colorRedNew", 1.0 )                      \
+    SETTING( VIDEO_colorGreen, Video, "colorGreenNew", 1.0 )                  \
+    SETTING( VIDEO_colorBlue, Video, "colorBlueNew", 1.0 )                    \
+                                                                              \
+    SETTING( CHAPERONE_switchToBeginnerDistance,                              \
+             Video, "chaperoneSwitchToBeginnerDistance", 0.5 )                \
+    SETTING( CHAPERONE_hapticFeedbackDistance,                                \
+             Video, "chaperoneHapticFeedbackDistance", 0.5 )                  \
+    SETTING( CHAPERONE_alarmSoundDistance,                                    \
+             Video, "chaperoneAlarmSoundDistance", 0.5 )                      \
+    SETTING( CHAPERONE_showDashboardDistance,                                 \
+             Video, "chaperoneShowDashboardDistance", 0.5 )                   \
+    SETTING( CHAPERONE_fadeDistanceRemembered,                                \
+             Chaperone, "fadeDistanceRemembered", 0.5 )
+
+// "^>m" is the default Discord mute keybinding.
+#define STRING_SETTINGS( SETTING )                                            \
+    SETTING( KEYBOARDSHORTCUT_keyboardOne,                                    \
+             KeyboardShortcut, "keyboardOne", "^>m" )                         \
+    SETTING( KEYBOARDSHORTCUT_keyboardTwo,                                    \
+             KeyboardShortcut, "keyboardTwo", "^>m" )                         \
+    SETTING( KEYBOARDSHORTCUT_keyboardThree,                                  \
+             KeyboardShortcut, "keyboardThree", "^>m" )                       \
+                                                                              \
+    SETTING( UTILITY_mediaApplication, Utility, "mediaApplication", "" )
+
+#define INT_SETTINGS( SETTING )                                               \
+    SETTING( PLAYSPACE_snapTurnAngle, Playspace, "snapTurnAngle", 4500 )      \
+    SETTING( PLAYSPACE_smoothTurnRate, Playspace, "smoothTurnRate", 100 )     \
+    SETTING( PLAYSPACE_dragComfortFactor, Playspace, "dragComfortFactor", 0 ) \
+    SETTING( PLAYSPACE_turnComfortFactor, Playspace, "turnComfortFactor", 0 ) \
+    SETTING( PLAYSPACE_frictionPercent, Playspace, "frictionPercent", 0 )     \
+                                                                              \
+    SETTING( CHAPERONE_reloadDebounceTicks,                                   \
+             Chaperone, "reloadDebounceTicks", 20 )                           \
+                                                                              \
+    SETTING( APPLICATION_debugState, Application, "debugState", 0 )           \
+    SETTING( APPLICATION_customTickRateMs,                                    \
+             Application, "customTickRateMs", 20 )                            \
+                                                                              \
+    SETTING( UTILITY_alarmHour, Utility, "alarmHour", 0 )                     \
+    SETTING( UTILITY_alarmMinute, Utility, "alarmMinute", 0 )
+
+#define SETTINGS_ENUMERATOR( name, category, qtKey, defaultValue ) name,
+#define SETTINGS_COUNT( name, category, qtKey, defaultValue ) +1
@@ -2,6 +2,8 @@
 #include <easylogging++.h>
 #include "../overlaycontroller.h"
 #include "internal/settings_controller.h"
+#include "profile_collection.h"
+#include "settings_snapshot.h"
 
 namespace settings
 {
@@ -14,7 +16,9 @@ void saveChangedSettings()
 
 void saveAllSettings()
 {
-    LOG( INFO ) << "Saving all settings.";
+    LOG( INFO ) << "Saving all settings. Published "
+                << settingController.publishedChanges()
+                << " setting changes to subscribers.";
     settingController.saveAllSettings();
     LOG( INFO ) << "All settings saved.";
 }
@@ -59,6 +63,78 @@ void setSetting( const StringSetting setting, const std::string value )
     settingController.setSetting( setting, value );
 }
 
+SubscriptionId subscribe( const BoolSetting setting,
+                          std::function<void( bool )> callback )
+{
+    return settingController.subscribe( setting, std::move( callback ) );
+}
+
+SubscriptionId subscribe( const DoubleSetting setting,
+                          std::function<void( double )> callback )
+{
+    return settingController.subscribe( setting, std::move( callback ) );
+}
+
+SubscriptionId subscribe( const IntSetting setting,
+                          std::function<void( int )> callback )
+{
+    return settingController.subscribe( setting, std::move( callback ) );
+}
+
+SubscriptionId subscribe( const StringSetting setting,
+                          std::function<void( const std::string& )> callback )
+{
+    return settingController.subscribe( setting, std::move( callback ) );
+}
+
+void unsubscribe( const SubscriptionId id )
+{
+    settingController.unsubscribe( id );
+}
+
+void watchSettingsFile()
+{
+    settingController.watchSettingsFile();
+}
+
+Snapshot createSnapshot()
+{
+    Snapshot snapshot;
+    snapshot.settings = settingController.snapshotValues();
+    for ( auto* collection : profileCollections() )
+    {
+        snapshot.profiles.push_back( { collection->profileSettingsName(),
+                                       collection->exportProfiles() } );
+    }
+    return snapshot;
+}
+
+std::optional<SnapshotChanges> applySnapshot( const Snapshot& snapshot )
+{
+    SnapshotChanges changes;
+
+    const auto changedSettings = settingController.applySnapshotValues(
+        snapshot.settings, changes.unknownSettings );
+    if ( !changedSettings )
+    {
+        return std::nullopt;
+    }
+    changes.settings = *changedSettings;
+
+    for ( const auto& p : snapshot.profiles )
+    {
+        for ( auto* collection : profileCollections() )
+        {
+            if ( collection->profileSettingsName() == p.settingsName )
+            {
+                changes.profiles += collection->importProfiles( p.profiles );
+            }
+        }
+    }
+
+    return changes;
+}
+
 std::string initializeAndGetSettingsPath()
 {
     // The static object is initialized the first time the function is called.
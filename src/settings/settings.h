@@ -1,103 +1,37 @@
 #pragma once
+#include <functional>
+#include <optional>
 #include <string>
+#include "setting_definitions.h"
 
 namespace settings
 {
 enum class BoolSetting
 {
-    PLAYSPACE_lockXToggle,
-    PLAYSPACE_lockYToggle,
-    PLAYSPACE_lockZToggle,
-    PLAYSPACE_momentumSave,
-    PLAYSPACE_turnBindLeft,
-    PLAYSPACE_turnBindRight,
-    PLAYSPACE_turnBounds,
-    PLAYSPACE_moveShortcutLeft,
-    PLAYSPACE_moveShortcutRight,
-    PLAYSPACE_dragBounds,
-    PLAYSPACE_allowExternalEdits,
-    PLAYSPACE_oldStyleMotion,
-    PLAYSPACE_universeCenteredRotation,
-    PLAYSPACE_enableSeatedMotion,
-    PLAYSPACE_adjustChaperone,
-    PLAYSPACE_showLogMatricesButton,
-    PLAYSPACE_simpleRecenter,
-
-    APPLICATION_disableVersionCheck,
-    APPLICATION_previousShutdownSafe,
-    APPLICATION_vsyncDisabled,
-    APPLICATION_crashRecoveryDisabled,
-    APPLICATION_enableDebug,
-
-    AUDIO_pttEnabled,
-    AUDIO_pttShowNotification,
-    AUDIO_micProximitySensorCanMute,
-    AUDIO_micReversePtt,
-
-    UTILITY_alarmEnabled,
-    UTILITY_alarmIsModal,
-    UTILITY_vrcDebug,
-
-    VIDEO_brightnessEnabled,
-    VIDEO_isOverlayMethodActive,
-    VIDEO_colorOverlayEnabled,
-
-    CHAPERONE_chaperoneSwitchToBeginnerEnabled,
-    CHAPERONE_chaperoneHapticFeedbackEnabled,
-    CHAPERONE_chaperoneAlarmSoundEnabled,
-    CHAPERONE_chaperoneAlarmSoundLooping,
-    CHAPERONE_chaperoneAlarmSoundAdjustVolume,
-    CHAPERONE_chaperoneShowDashboardEnabled,
-    CHAPERONE_disableChaperone,
-    // LAST_ENUMERATOR must always be set to the last value
-    LAST_ENUMERATOR = CHAPERONE_disableChaperone,
+    BOOL_SETTINGS( SETTINGS_ENUMERATOR )
+    // Always the last setting in the list
+    LAST_ENUMERATOR = ( 0 BOOL_SETTINGS( SETTINGS_COUNT ) ) - 1,
 };
 
 enum class DoubleSetting
 {
-    PLAYSPACE_heightToggleOffset,
-    PLAYSPACE_gravityStrength,
-    PLAYSPACE_flingStrength,
-
-    VIDEO_brightnessOpacityValue,
-    VIDEO_colorOverlayOpacity,
-    VIDEO_colorRed,
-    VIDEO_colorGreen,
-    VIDEO_colorBlue,
-
-    CHAPERONE_switchToBeginnerDistance,
-    CHAPERONE_hapticFeedbackDistance,
-    CHAPERONE_alarmSoundDistance,
-    CHAPERONE_showDashboardDistance,
-    CHAPERONE_fadeDistanceRemembered,
-    // LAST_ENUMERATOR must always be set to the last value
-    LAST_ENUMERATOR = CHAPERONE_fadeDistanceRemembered,
+    DOUBLE_SETTINGS( SETTINGS_ENUMERATOR )
+    // Always the last setting in the list
+    LAST_ENUMERATOR = ( 0 DOUBLE_SETTINGS( SETTINGS_COUNT ) ) - 1,
 };
 
 enum class StringSetting
 {
-    KEYBOARDSHORTCUT_keyboardOne,
-    KEYBOARDSHORTCUT_keyboardTwo,
-    KEYBOARDSHORTCUT_keyboardThree,
-    // LAST_ENUMERATOR must always be set to the last value
-    LAST_ENUMERATOR = KEYBOARDSHORTCUT_keyboardThree,
+    STRING_SETTINGS( SETTINGS_ENUMERATOR )
+    // Always the last setting in the list
+    LAST_ENUMERATOR = ( 0 STRING_SETTINGS( SETTINGS_COUNT ) ) - 1,
 };
 
 enum class IntSetting
 {
-    PLAYSPACE_snapTurnAngle,
-    PLAYSPACE_smoothTurnRate,
-    PLAYSPACE_dragComfortFactor,
-    PLAYSPACE_turnComfortFactor,
-    PLAYSPACE_frictionPercent,
-
-    APPLICATION_debugState,
-    APPLICATION_customTickRateMs,
-
-    UTILITY_alarmHour,
-    UTILITY_alarmMinute,
-    // LAST_ENUMERATOR must always be set to the last value
-    LAST_ENUMERATOR = UTILITY_alarmMinute,
+    INT_SETTINGS( SETTINGS_ENUMERATOR )
+    // Always the last setting in the list
+    LAST_ENUMERATOR = ( 0 INT_SETTINGS( SETTINGS_COUNT ) ) - 1,
 };
 
 std::string initializeAndGetSettingsPath();
@@ -108,6 +42,49 @@ void saveChangedSettings();
 
 void saveAllSettings();
 
+/*!
+   \brief Applies edits made to the settings file by other programs while
+   the application is running.
+ */
+void watchSettingsFile();
+
+struct Snapshot;
+struct SnapshotChanges;
+
+/*!
+   \brief Captures all settings and the profiles of all profile stores.
+   Runtime settings are added by the caller.
+ */
+Snapshot createSnapshot();
+
+/*!
+   \brief Applies the settings and profiles of \a snapshot. Runtime settings
+   are applied by the caller.
+   \return No value if a setting in the snapshot has the wrong type, nothing
+   is applied in that case.
+ */
+std::optional<SnapshotChanges> applySnapshot( const Snapshot& snapshot );
+
+using SubscriptionId = unsigned long long;
+
+/*!
+   \brief Calls \a callback with the new value every time \a setting is
+   changed through \c setSetting.
+
+   Setting a setting to its current value does not call the callback.
+   \return Id for \c unsubscribe.
+ */
+SubscriptionId subscribe( const BoolSetting setting,
+                          std::function<void( bool )> callback );
+SubscriptionId subscribe( const DoubleSetting setting,
+                          std::function<void( double )> callback );
+SubscriptionId subscribe( const IntSetting setting,
+                          std::function<void( int )> callback );
+SubscriptionId subscribe( const StringSetting setting,
+                          std::function<void( const std::string& )> callback );
+
+void unsubscribe( const SubscriptionId id );
+
 [[nodiscard]] bool getSetting( const BoolSetting setting );
 void setSetting( const BoolSetting setting, const bool value );
 
@@ -9,57 +9,37 @@ namespace settings
 namespace
 {
 template <typename Value>
-std::list<Value> createListFromObject( settings::SettingsObjectData& obj )
-{
-    std::list<Value> list;
-    while ( obj.hasValuesOfType<Value>() )
-    {
-        list.push_back( obj.getNextValueOrDefault( Value{} ) );
-    }
-    return list;
-}
-
-template <typename Value>
-void addListToObject( std::list<Value>& list,
-                      settings::SettingsObjectData& obj )
-{
-    while ( !list.empty() )
-    {
-        obj.addValue( list.front() );
-        list.pop_front();
-    }
-}
-
-template <typename Value>
-void saveListToDisk( std::list<Value> values,
-                     const std::string structName,
-                     const std::string typeName )
+void saveValuesToDisk( const std::vector<Value>& values,
+                       const std::string structName,
+                       const std::string typeName )
 {
     auto& s = settings::getQSettings();
 
     s.beginGroup( structName.c_str() );
+    // A shorter array would leave the entries past its end behind.
+    s.remove( typeName.c_str() );
     s.beginWriteArray( typeName.c_str() );
 
-    for ( int i = 0; !values.empty(); ++i )
+    for ( std::size_t i = 0; i < values.size(); ++i )
     {
-        s.setArrayIndex( i );
+        s.setArrayIndex( static_cast<int>( i ) );
         if constexpr ( std::is_same<std::string, Value>::value )
         {
-            s.setValue( typeName.c_str(), values.front().c_str() );
+            s.setValue( typeName.c_str(), values[i].c_str() );
         }
         else
         {
-            s.setValue( typeName.c_str(), values.front() );
+            s.setValue( typeName.c_str(), static_cast<Value>( values[i] ) );
         }
-        values.pop_front();
     }
 
     s.endArray();
     s.endGroup();
 }
+
 template <typename Value>
-std::list<Value> loadListFromDisk( const std::string structName,
-                                   const std::string typeName )
+std::vector<Value> loadValuesFromDisk( const std::string structName,
+                                       const std::string typeName )
 {
     using std::is_same;
     const auto isBool = is_same<bool, Value>::value;
@@ -79,7 +59,8 @@ std::list<Value> loadListFromDisk( const std::string structName,
     s.beginGroup( structName.c_str() );
     auto size = s.beginReadArray( typeName.c_str() );
 
-    std::list<Value> list;
+    std::vector<Value> values;
+    values.reserve( static_cast<std::size_t>( size ) );
     for ( int i = 0; i < size; ++i )
     {
         s.setArrayIndex( i );
@@ -87,60 +68,47 @@ std::list<Value> loadListFromDisk( const std::string structName,
 
         if constexpr ( isBool )
         {
-            list.push_back( v.toBool() );
+            values.push_back( v.toBool() );
         }
         else if constexpr ( isInt )
         {
-            list.push_back( v.toInt() );
+            values.push_back( v.toInt() );
         }
         else if constexpr ( isDouble )
         {
-            list.push_back( v.toDouble() );
+            values.push_back( v.toDouble() );
         }
         else if constexpr ( isString )
         {
-            list.push_back( v.toString().toStdString() );
+            values.push_back( v.toString().toStdString() );
         }
     }
 
     s.endArray();
     s.endGroup();
 
-    return list;
+    return values;
 }
 
 settings::SettingsObjectData loadSettingsObject( std::string objName )
 {
     settings::SettingsObjectData s;
 
-    auto boolValues = loadListFromDisk<bool>( objName, "bools" );
-    addListToObject( boolValues, s );
-
-    auto intValues = loadListFromDisk<int>( objName, "ints" );
-    addListToObject( intValues, s );
-
-    auto doubleValues = loadListFromDisk<double>( objName, "doubles" );
-    addListToObject( doubleValues, s );
-
-    auto stringValues = loadListFromDisk<std::string>( objName, "strings" );
-    addListToObject( stringValues, s );
+    s.setValues<bool>( loadValuesFromDisk<bool>( objName, "bools" ) );
+    s.setValues<int>( loadValuesFromDisk<int>( objName, "ints" ) );
+    s.setValues<double>( loadValuesFromDisk<double>( objName, "doubles" ) );
+    s.setValues<std::string>(
+        loadValuesFromDisk<std::string>( objName, "strings" ) );
 
     return s;
 }
 
 void saveSettingsObject( settings::SettingsObjectData& s, std::string objName )
 {
-    auto boolValues = createListFromObject<bool>( s );
-    saveListToDisk( boolValues, objName, "bools" );
-
-    auto intValues = createListFromObject<int>( s );
-    saveListToDisk( intValues, objName, "ints" );
-
-    auto doubleValues = createListFromObject<double>( s );
-    saveListToDisk( doubleValues, objName, "doubles" );
-
-    auto stringValues = createListFromObject<std::string>( s );
-    saveListToDisk( stringValues, objName, "strings" );
+    saveValuesToDisk( s.takeValues<bool>(), objName, "bools" );
+    saveValuesToDisk( s.takeValues<int>(), objName, "ints" );
+    saveValuesToDisk( s.takeValues<double>(), objName, "doubles" );
+    saveValuesToDisk( s.takeValues<std::string>(), objName, "strings" );
 }
 
 std::string appendSlotNumberToSettingsName( const std::string name,
@@ -180,6 +148,12 @@ void loadNumberedObject( ISettingsObject& obj, const int slot )
     obj.loadSettings( s );
 }
 
+void removeNumberedObject( const ISettingsObject& obj, const int slot )
+{
+    getQSettings().remove( QString::fromStdString(
+        appendSlotNumberToSettingsName( obj.settingsName(), slot ) ) );
+}
+
 int getAmountOfSavedObjects( ISettingsObject& obj )
 {
     auto& s = getQSettings();
@@ -153,6 +153,13 @@ template <class T> void loadAllObjects( std::vector<T>& vec )
  */
 void loadNumberedObject( ISettingsObject& obj, const int slot );
 
+/*!
+   \brief Removes the object saved in \a slot from permanent storage.
+   \param obj Object type to remove.
+   \param slot Specific object to remove.
+ */
+void removeNumberedObject( const ISettingsObject& obj, const int slot );
+
 /*!
    \brief Gets amount of consecutive \a obj objects starting from 1.
    \param obj Object to check.
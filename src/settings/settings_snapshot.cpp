@@ -0,0 +1,228 @@
+#include "settings_snapshot.h"
+#include <QDataStream>
+#include <easylogging++.h>
+
+namespace
+{
+constexpr char k_snapshotMagic[4] = { 'O', 'V', 'S', 'S' };
+constexpr int k_magicSize = 4;
+constexpr int k_checksumSize = 2;
+
+void prepareStream( QDataStream& stream )
+{
+    stream.setVersion( QDataStream::Qt_5_12 );
+    stream.setByteOrder( QDataStream::LittleEndian );
+}
+
+template <typename Value, typename StreamValue = Value>
+void writeValues( QDataStream& stream, const std::vector<Value>& values )
+{
+    stream << static_cast<quint32>( values.size() );
+    for ( const auto& v : values )
+    {
+        if constexpr ( std::is_same<std::string, Value>::value )
+        {
+            stream << QString::fromStdString( v );
+        }
+        else
+        {
+            stream << static_cast<StreamValue>( v );
+        }
+    }
+}
+
+template <typename Value, typename StreamValue = Value>
+std::vector<Value> readValues( QDataStream& stream )
+{
+    quint32 count = 0;
+    stream >> count;
+
+    // The count is not trusted for reserving, a corrupt stream stops early.
+    std::vector<Value> values;
+    for ( quint32 i = 0; i < count && stream.status() == QDataStream::Ok;
+          ++i )
+    {
+        if constexpr ( std::is_same<std::string, Value>::value )
+        {
+            QString v;
+            stream >> v;
+            values.push_back( v.toStdString() );
+        }
+        else
+        {
+            StreamValue v{};
+            stream >> v;
+            values.push_back( static_cast<Value>( v ) );
+        }
+    }
+    return values;
+}
+
+void writeObjectData( QDataStream& stream, settings::SettingsObjectData data )
+{
+    writeValues( stream, data.takeValues<bool>() );
+    writeValues<int, qint32>( stream, data.takeValues<int>() );
+    writeValues( stream, data.takeValues<double>() );
+    writeValues( stream, data.takeValues<std::string>() );
+}
+
+settings::SettingsObjectData readObjectData( QDataStream& stream )
+{
+    settings::SettingsObjectData data;
+    data.setValues<bool>( readValues<bool>( stream ) );
+    data.setValues<int>( readValues<int, qint32>( stream ) );
+    data.setValues<double>( readValues<double>( stream ) );
+    data.setValues<std::string>( readValues<std::string>( stream ) );
+    return data;
+}
+
+void writeSnapshotValues( QDataStream& stream,
+                          const std::vector<settings::SnapshotValue>& values )
+{
+    stream << static_cast<quint32>( values.size() );
+    for ( const auto& v : values )
+    {
+        stream << QString::fromStdString( v.group )
+               << QString::fromStdString( v.key ) << v.value;
+    }
+}
+
+std::vector<settings::SnapshotValue> readSnapshotValues( QDataStream& stream )
+{
+    quint32 count = 0;
+    stream >> count;
+
+    std::vector<settings::SnapshotValue> values;
+    for ( quint32 i = 0; i < count && stream.status() == QDataStream::Ok;
+          ++i )
+    {
+        QString group;
+        QString key;
+        QVariant value;
+        stream >> group >> key >> value;
+        values.push_back(
+            { group.toStdString(), key.toStdString(), std::move( value ) } );
+    }
+    return values;
+}
+
+} // namespace
+
+namespace settings
+{
+QByteArray encodeSnapshot( const Snapshot& snapshot )
+{
+    QByteArray payload;
+    {
+        QDataStream stream( &payload, QIODevice::WriteOnly );
+        prepareStream( stream );
+
+        writeSnapshotValues( stream, snapshot.settings );
+        writeSnapshotValues( stream, snapshot.runtimeSettings );
+
+        stream << static_cast<quint32>( snapshot.profiles.size() );
+        for ( const auto& p : snapshot.profiles )
+        {
+            stream << QString::fromStdString( p.settingsName );
+            stream << static_cast<quint32>( p.profiles.size() );
+            for ( const auto& profile : p.profiles )
+            {
+                writeObjectData( stream, profile );
+            }
+        }
+    }
+
+    const auto compressed = qCompress( payload );
+
+    QByteArray data;
+    data.reserve( k_magicSize + 1 + compressed.size() + k_checksumSize );
+
+    QDataStream stream( &data, QIODevice::WriteOnly );
+    prepareStream( stream );
+
+    stream.writeRawData( k_snapshotMagic, k_magicSize );
+    stream << static_cast<quint8>( k_snapshotVersion );
+    stream.writeRawData( compressed.constData(), compressed.size() );
+    stream << qChecksum( data.constData(), static_cast<uint>( data.size() ) );
+
+    return data;
+}
+
+std::optional<Snapshot> decodeSnapshot( const QByteArray& data )
+{
+    if ( data.size() < k_magicSize + 1 + k_checksumSize
+         || !data.startsWith( QByteArray( k_snapshotMagic, k_magicSize ) ) )
+    {
+        LOG( ERROR ) << "Settings snapshot is malformed.";
+        return std::nullopt;
+    }
+
+    const auto payloadStart = k_magicSize + 1;
+    const auto payloadEnd = data.size() - k_checksumSize;
+
+    QDataStream header( data );
+    prepareStream( header );
+    header.skipRawData( k_magicSize );
+
+    quint8 version = 0;
+    header >> version;
+    if ( version != k_snapshotVersion )
+    {
+        LOG( ERROR ) << "Unknown settings snapshot version "
+                     << static_cast<int>( version ) << ".";
+        return std::nullopt;
+    }
+
+    header.skipRawData( payloadEnd - payloadStart );
+    quint16 storedChecksum = 0;
+    header >> storedChecksum;
+
+    if ( header.status() != QDataStream::Ok
+         || storedChecksum
+                != qChecksum( data.constData(),
+                              static_cast<uint>( payloadEnd ) ) )
+    {
+        LOG( ERROR ) << "Settings snapshot failed checksum validation.";
+        return std::nullopt;
+    }
+
+    const auto payload = qUncompress(
+        data.mid( payloadStart, payloadEnd - payloadStart ) );
+
+    QDataStream stream( payload );
+    prepareStream( stream );
+
+    Snapshot snapshot;
+    snapshot.settings = readSnapshotValues( stream );
+    snapshot.runtimeSettings = readSnapshotValues( stream );
+
+    quint32 profileTypes = 0;
+    stream >> profileTypes;
+    for ( quint32 i = 0;
+          i < profileTypes && stream.status() == QDataStream::Ok;
+          ++i )
+    {
+        QString settingsName;
+        quint32 count = 0;
+        stream >> settingsName >> count;
+
+        SnapshotProfiles profiles{ settingsName.toStdString(), {} };
+        for ( quint32 j = 0; j < count && stream.status() == QDataStream::Ok;
+              ++j )
+        {
+            profiles.profiles.push_back( readObjectData( stream ) );
+        }
+        snapshot.profiles.push_back( std::move( profiles ) );
+    }
+
+    if ( payload.isEmpty() || stream.status() != QDataStream::Ok
+         || !stream.atEnd() )
+    {
+        LOG( ERROR ) << "Settings snapshot payload is malformed.";
+        return std::nullopt;
+    }
+
+    return snapshot;
+}
+
+} // namespace settings
@@ -0,0 +1,69 @@
+#pragma once
+#include <QByteArray>
+#include <QVariant>
+#include <optional>
+#include <string>
+#include <vector>
+#include "internal/settings_object_data.h"
+
+namespace settings
+{
+// Bump when the layout changes. Older versions are still decoded as long as
+// a decoding path exists for them in decodeSnapshot.
+constexpr unsigned char k_snapshotVersion = 1;
+
+struct SnapshotValue
+{
+    std::string group;
+    std::string key;
+    QVariant value;
+};
+
+struct SnapshotProfiles
+{
+    std::string settingsName;
+    std::vector<SettingsObjectData> profiles;
+};
+
+/*!
+   \brief Settings, profiles and runtime settings of one installation.
+
+   Settings are identified by their group and key in the settings file so
+   that snapshots survive reordering of the setting enums.
+ */
+struct Snapshot
+{
+    std::vector<SnapshotValue> settings;
+    // The group of a runtime setting is its vr::VRSettings() section.
+    std::vector<SnapshotValue> runtimeSettings;
+    std::vector<SnapshotProfiles> profiles;
+};
+
+/*!
+   \brief Number of values an applied snapshot changed.
+ */
+struct SnapshotChanges
+{
+    unsigned long long settings = 0;
+    // Settings in the snapshot this version does not know about.
+    int unknownSettings = 0;
+    int profiles = 0;
+    int runtimeSettings = 0;
+};
+
+/*!
+   \brief Encodes \a snapshot as a versioned, checksummed binary blob.
+
+   Layout: 4 byte magic "OVSS", 1 byte version, the qCompress'ed
+   QDataStream payload, 2 byte CRC-16 over everything before it.
+ */
+QByteArray encodeSnapshot( const Snapshot& snapshot );
+
+/*!
+   \brief Decodes a blob created by \c encodeSnapshot.
+   \return The snapshot, or \c std::nullopt if the blob is truncated, has an
+   unknown version or fails the checksum.
+ */
+std::optional<Snapshot> decodeSnapshot( const QByteArray& data );
+
+} // namespace settings
@@ -58,6 +58,14 @@ void AudioTabController::initStage1()
     reloadAudioSettings();
 
     eventLoopTick();
+
+    // Devices are enumerated after the UI was created.
+    emit playbackDeviceListChanged();
+    emit recordingDeviceListChanged();
+    emit mirrorVolumeChanged( m_mirrorVolume );
+    emit mirrorMutedChanged( m_mirrorMuted );
+    emit micVolumeChanged( m_micVolume );
+    emit micMutedChanged( m_micMuted );
 }
 
 std::optional<std::string> verifyIconFilePath( std::string filename )
@@ -72,8 +80,21 @@ std::optional<std::string> verifyIconFilePath( std::string filename )
     return notifIconPath;
 }
 
-void AudioTabController::initStage2()
+void AudioTabController::initStage2( OverlayController* parent )
 {
+    parent->vrSettingsCache().watchString(
+        vr::k_pch_audio_Section,
+        vr::k_pch_audio_PlaybackMirrorDevice_String,
+        [this]( const std::string& mirrorDeviceId ) {
+            std::lock_guard<std::recursive_mutex> lock( eventLoopMutex );
+            if ( lastMirrorDevId != mirrorDeviceId )
+            {
+                audioManager->setMirrorDevice( mirrorDeviceId );
+                findMirrorDeviceIndex( audioManager->getMirrorDevId() );
+                lastMirrorDevId = mirrorDeviceId;
+            }
+        } );
+
     const auto pushToTalkOverlayKey
         = std::string( application_strings::applicationKey )
           + ".pptnotification";
@@ -186,35 +207,13 @@ bool AudioTabController::audioProfileDefault() const
 
 void AudioTabController::eventLoopTick()
 {
-    if ( !eventLoopMutex.try_lock() )
+    if ( !audioManager || !eventLoopMutex.try_lock() )
     {
         return;
     }
 
     if ( settingsUpdateCounter >= m_audioSettingsUpdateCounter )
     {
-        vr::EVRSettingsError vrSettingsError;
-        char mirrorDeviceId[1024];
-        vr::VRSettings()->GetString(
-            vr::k_pch_audio_Section,
-            vr::k_pch_audio_PlaybackMirrorDevice_String,
-            mirrorDeviceId,
-            1024,
-            &vrSettingsError );
-        if ( vrSettingsError != vr::VRSettingsError_None )
-        {
-            LOG( WARNING ) << "Could not read \""
-                           << vr::k_pch_audio_PlaybackMirrorDevice_String
-                           << "\" setting: "
-                           << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                                  vrSettingsError );
-        }
-        if ( lastMirrorDevId.compare( mirrorDeviceId ) != 0 )
-        {
-            audioManager->setMirrorDevice( mirrorDeviceId );
-            findMirrorDeviceIndex( audioManager->getMirrorDevId() );
-            lastMirrorDevId = mirrorDeviceId;
-        }
         if ( m_mirrorDeviceIndex >= 0 )
         {
             setMirrorVolume( audioManager->getMirrorVolume() );
@@ -286,7 +285,7 @@ void AudioTabController::setMirrorVolume( float value, bool notify )
     if ( value != m_mirrorVolume )
     {
         m_mirrorVolume = value;
-        if ( audioManager->isMirrorValid() )
+        if ( audioManager && audioManager->isMirrorValid() )
         {
             audioManager->setMirrorVolume( value );
         }
@@ -303,7 +302,7 @@ void AudioTabController::setMirrorMuted( bool value, bool notify )
     if ( value != m_mirrorMuted )
     {
         m_mirrorMuted = value;
-        if ( audioManager->isMirrorValid() )
+        if ( audioManager && audioManager->isMirrorValid() )
         {
             audioManager->setMirrorMuted( value );
         }
@@ -320,7 +319,7 @@ void AudioTabController::setMicVolume( float value, bool notify )
     if ( value != m_micVolume )
     {
         m_micVolume = value;
-        if ( audioManager->isMicValid() )
+        if ( audioManager && audioManager->isMicValid() )
         {
             audioManager->setMicVolume( value );
         }
@@ -338,7 +337,7 @@ void AudioTabController::setMicMuted( bool value, bool notify )
     if ( value != m_micMuted )
     {
         m_micMuted = value;
-        if ( audioManager->isMicValid() )
+        if ( audioManager && audioManager->isMicValid() )
         {
             audioManager->setMicMuted( value );
         }
@@ -720,12 +719,12 @@ void AudioTabController::findMicDeviceIndex( std::string id, bool notify )
 
 void AudioTabController::reloadAudioProfiles()
 {
-    settings::loadAllObjects( audioProfiles );
+    audioProfiles.load();
 }
 
 void AudioTabController::saveAudioProfiles()
 {
-    settings::saveAllObjects( audioProfiles );
+    audioProfiles.save();
 }
 
 /*
@@ -745,37 +744,24 @@ audioProfiles[]
 
 void AudioTabController::addAudioProfile( QString name )
 {
-    AudioProfile* profile = nullptr;
-    for ( auto& p : audioProfiles )
-    {
-        if ( p.profileName.compare( name.toStdString() ) == 0 )
-        {
-            profile = &p;
-            break;
-        }
-    }
-    if ( !profile )
-    {
-        auto i = audioProfiles.size();
-        audioProfiles.emplace_back();
-        profile = &audioProfiles[i];
-    }
-    profile->profileName = name.toStdString();
-    profile->playbackName
+    AudioProfile profile;
+    profile.profileName = name.toStdString();
+    profile.playbackName
         = getPlaybackDeviceName( m_playbackDeviceIndex ).toStdString();
-    profile->mirrorName
+    profile.mirrorName
         = getPlaybackDeviceName( m_mirrorDeviceIndex ).toStdString();
-    profile->micName
+    profile.micName
         = getRecordingDeviceName( m_recordingDeviceIndex ).toStdString();
-    profile->micMute = m_micMuted;
-    profile->mirrorMute = m_mirrorMuted;
-    profile->mirrorVol = m_mirrorVolume;
-    profile->micVol = m_micVolume;
-    profile->defaultProfile = m_isDefaultAudioProfile;
+    profile.micMute = m_micMuted;
+    profile.mirrorMute = m_mirrorMuted;
+    profile.mirrorVol = m_mirrorVolume;
+    profile.micVol = m_micVolume;
+    profile.defaultProfile = m_isDefaultAudioProfile;
 
-    profile->playbackID = getPlaybackDeviceID( m_playbackDeviceIndex );
-    profile->mirrorID = getMirrorDeviceID( m_mirrorDeviceIndex );
-    profile->recordingID = getRecordingDeviceID( m_recordingDeviceIndex );
+    profile.playbackID = getPlaybackDeviceID( m_playbackDeviceIndex );
+    profile.mirrorID = getMirrorDeviceID( m_mirrorDeviceIndex );
+    profile.recordingID = getRecordingDeviceID( m_recordingDeviceIndex );
+    audioProfiles.put( std::move( profile ) );
 
     if ( m_isDefaultAudioProfile )
     {
@@ -810,7 +796,7 @@ void AudioTabController::applyAudioProfile( unsigned index )
     std::lock_guard<std::recursive_mutex> lock( eventLoopMutex );
     if ( index < audioProfiles.size() )
     {
-        auto& profile = audioProfiles[index];
+        const auto& profile = audioProfiles.at( index );
         int mInd = getMirrorIndex( profile.mirrorID );
         int pInd = getPlaybackIndex( profile.playbackID );
 
@@ -860,11 +846,10 @@ void AudioTabController::deleteAudioProfile( unsigned index )
 {
     if ( index < audioProfiles.size() )
     {
-        auto pos = audioProfiles.begin() + index;
         // Remove PlayBack and Mic from Steam API Mirror Is handled @ shutdown
         // This is necessary because Mirror Device does not appear to be handled
         // via native windows api.
-        if ( audioProfiles.at( index ).defaultProfile )
+        if ( audioProfiles.isDefault( index ) )
         {
             vr::EVRSettingsError vrSettingsError;
             vr::VRSettings()->RemoveKeyInSection(
@@ -895,7 +880,7 @@ void AudioTabController::deleteAudioProfile( unsigned index )
                            vrSettingsError );
             }
         }
-        audioProfiles.erase( pos );
+        audioProfiles.remove( index );
         saveAudioProfiles();
         emit audioProfilesUpdated();
     }
@@ -998,6 +983,11 @@ void AudioTabController::initOverride()
 }
 //********************
 
+QAbstractItemModel* AudioTabController::audioProfilesModel()
+{
+    return &audioProfiles.model();
+}
+
 unsigned AudioTabController::getAudioProfileCount()
 {
     return static_cast<unsigned int>( audioProfiles.size() );
@@ -1007,7 +997,7 @@ QString AudioTabController::getAudioProfileName( unsigned index )
 {
     if ( index < audioProfiles.size() )
     {
-        return QString::fromStdString( audioProfiles[index].profileName );
+        return QString::fromStdString( audioProfiles.name( index ) );
     }
     return "";
 }
@@ -1173,13 +1163,12 @@ description: checks all profiles and removes any OTHERS that are set as default.
 */
 void AudioTabController::removeOtherDefaultProfiles( QString name )
 {
-    AudioProfile* profile = nullptr;
-    for ( auto& p : audioProfiles )
+    for ( std::size_t i = 0; i < audioProfiles.size(); i++ )
     {
-        if ( p.profileName.compare( name.toStdString() ) != 0 )
+        if ( audioProfiles.name( i ).compare( name.toStdString() ) != 0
+             && audioProfiles.isDefault( i ) )
         {
-            profile = &p;
-            profile->defaultProfile = false;
+            audioProfiles.edit( i ).defaultProfile = false;
         }
     }
 }
@@ -1196,10 +1185,10 @@ flag);
 
 void AudioTabController::applyDefaultProfile()
 {
+    // The flags are in the name index, only the default profile is read.
     for ( unsigned i = 0; i < audioProfiles.size(); i++ )
     {
-        auto& profile = audioProfiles[i];
-        if ( profile.defaultProfile )
+        if ( audioProfiles.isDefault( i ) )
         {
             applyAudioProfile( i );
             m_defaultProfileIndex = static_cast<int>( i );
@@ -1218,6 +1207,10 @@ int AudioTabController::getDefaultAudioProfileIndex()
 
 void AudioTabController::shutdown()
 {
+    if ( !audioManager )
+    {
+        return;
+    }
     setMicMuted( false, true );
     std::string mID;
     bool hasDefaultProfile = false;
@@ -1232,10 +1225,9 @@ void AudioTabController::shutdown()
     // natively.
     for ( unsigned i = 0; i < audioProfiles.size(); i++ )
     {
-        auto& profile = audioProfiles[i];
-        if ( profile.defaultProfile )
+        if ( audioProfiles.isDefault( i ) )
         {
-            mID = profile.mirrorID;
+            mID = audioProfiles.at( i ).mirrorID;
             hasDefaultProfile = true;
             break;
         }
@@ -7,6 +7,7 @@
 #include <memory>
 #include "../utils/FrameRateUtils.h"
 #include "../settings/settings_object.h"
+#include "../settings/profile_store.h"
 
 class QQuickWindow;
 // application namespace
@@ -99,6 +100,8 @@ class AudioTabController : public QObject
                     NOTIFY micReversePttChanged )
     Q_PROPERTY( bool audioProfileDefault READ audioProfileDefault WRITE
                     setAudioProfileDefault NOTIFY audioProfileDefaultChanged )
+    Q_PROPERTY( QAbstractItemModel* audioProfilesModel READ audioProfilesModel
+                    CONSTANT )
     Q_PROPERTY( bool playbackOverride READ playbackOverride WRITE
                     setPlaybackOverride NOTIFY playbackOverrideChanged )
     Q_PROPERTY( bool recordingOverride READ recordingOverride WRITE
@@ -176,11 +179,11 @@ class AudioTabController : public QObject
 
     void initOverride();
 
-    std::vector<AudioProfile> audioProfiles;
+    settings::ProfileStore<AudioProfile> audioProfiles;
 
 public:
     void initStage1();
-    void initStage2();
+    void initStage2( OverlayController* parent );
 
     void reloadAudioSettings();
 
@@ -213,6 +216,7 @@ class AudioTabController : public QObject
     Q_INVOKABLE int getRecordingDeviceCount();
     Q_INVOKABLE QString getRecordingDeviceName( int index );
 
+    QAbstractItemModel* audioProfilesModel();
     Q_INVOKABLE unsigned getAudioProfileCount();
     Q_INVOKABLE QString getAudioProfileName( unsigned index );
     Q_INVOKABLE int getDefaultAudioProfileIndex();
@@ -3,45 +3,73 @@
 #include "../overlaycontroller.h"
 #include "../settings/settings.h"
 #include <cmath>
+#include <algorithm>
+#include <type_traits>
 
 // application namespace
 namespace advsettings
 {
-void ChaperoneTabController::initStage1()
+namespace
 {
-    if ( disableChaperone() )
-    {
-        setFadeDistance( 0.0f, true );
-    }
+// Visibilities below 0.3 are raised to it, as in setBoundsVisibility.
+int32_t boundsVisibilityToGammaA( float visibility )
+{
+    return static_cast<int32_t>( 255 * std::max( visibility, 0.3f ) );
+}
+
+} // namespace
 
+void ChaperoneTabController::initStage1()
+{
     reloadChaperoneProfiles();
-    m_chaperoneSettingsUpdateCounter
-        = utils::adjustUpdateRate( k_chaperoneSettingsUpdateCounter );
-    eventLoopTick( nullptr );
 }
 
 void ChaperoneTabController::initStage2( OverlayController* var_parent )
 {
     this->parent = var_parent;
+
+    subscribeToSettings();
+
+    auto& cache = parent->vrSettingsCache();
+    cache.watchInt32( vr::k_pch_CollisionBounds_Section,
+                      vr::k_pch_CollisionBounds_ColorGammaA_Int32,
+                      [this]( int value ) {
+                          setBoundsVisibility( static_cast<float>( value )
+                                               / 255.0f );
+                      } );
+    cache.watchBool( vr::k_pch_CollisionBounds_Section,
+                     vr::k_pch_CollisionBounds_CenterMarkerOn_Bool,
+                     [this]( bool value ) { setCenterMarker( value ); } );
+    cache.watchBool( vr::k_pch_CollisionBounds_Section,
+                     vr::k_pch_CollisionBounds_PlaySpaceOn_Bool,
+                     [this]( bool value ) { setPlaySpaceMarker( value ); } );
+    cache.watchFloat( vr::k_pch_CollisionBounds_Section,
+                      vr::k_pch_CollisionBounds_FadeDistance_Float,
+                      [this]( float value ) { setFadeDistance( value ); } );
+
+    if ( disableChaperone() )
+    {
+        setFadeDistance( 0.0f, true );
+    }
 }
 
 ChaperoneTabController::~ChaperoneTabController()
 {
-    m_chaperoneHapticFeedbackActive = false;
-    if ( m_chaperoneHapticFeedbackThread.joinable() )
+    for ( const auto id : m_settingSubscriptions )
     {
-        m_chaperoneHapticFeedbackThread.join();
+        settings::unsubscribe( id );
     }
+    m_hapticScheduler.stop();
 }
 
 void ChaperoneTabController::reloadChaperoneProfiles()
 {
-    settings::loadAllObjects( chaperoneProfiles );
+    chaperoneProfiles.load();
 }
 
 void ChaperoneTabController::saveChaperoneProfiles()
 {
-    settings::saveAllObjects( chaperoneProfiles );
+    chaperoneProfiles.save();
 }
 
 void ChaperoneTabController::handleChaperoneWarnings( float distance )
@@ -106,20 +134,7 @@ void ChaperoneTabController::handleChaperoneWarnings( float distance )
         else if ( ( distance > activationDistance || !m_isHMDActive )
                   && m_chaperoneSwitchToBeginnerActive )
         {
-            vr::EVRSettingsError vrSettingsError;
-            vr::VRSettings()->SetInt32( vr::k_pch_CollisionBounds_Section,
-                                        vr::k_pch_CollisionBounds_Style_Int32,
-                                        m_chaperoneSwitchToBeginnerLastStyle,
-                                        &vrSettingsError );
-            if ( vrSettingsError != vr::VRSettingsError_None )
-            {
-                LOG( WARNING )
-                    << "Could not set \""
-                    << vr::k_pch_CollisionBounds_Style_Int32 << "\" setting: "
-                    << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                           vrSettingsError );
-            }
-            else
+            if ( restoreChaperoneStyle() )
             {
                 m_chaperoneSwitchToBeginnerActive = false;
             }
@@ -134,61 +149,44 @@ void ChaperoneTabController::handleChaperoneWarnings( float distance )
 
         if ( distance <= activationDistance && proxSensorOverrideState )
         {
-            if ( !m_chaperoneHapticFeedbackActive )
+            // Stronger and more frequent pulses the closer the user gets.
+            // As it stands both controllers will vibrate regardless of
+            // which is closer to the boundary.
+            const float intensity
+                = activationDistance > 0.0f
+                      ? 1.0f - distance / activationDistance
+                      : 1.0f;
+            const auto leftIndex
+                = vr::VRSystem()->GetTrackedDeviceIndexForControllerRole(
+                    vr::TrackedControllerRole_LeftHand );
+            const auto rightIndex
+                = vr::VRSystem()->GetTrackedDeviceIndexForControllerRole(
+                    vr::TrackedControllerRole_RightHand );
+            if ( leftIndex != vr::k_unTrackedDeviceIndexInvalid )
             {
-                if ( m_chaperoneHapticFeedbackThread.joinable() )
-                {
-                    m_chaperoneHapticFeedbackActive = false;
-                    m_chaperoneHapticFeedbackThread.join();
-                }
-                m_chaperoneHapticFeedbackActive = true;
-                m_chaperoneHapticFeedbackThread = std::thread(
-                    [&]( ChaperoneTabController* _this ) {
-                        auto leftIndex
-                            = vr::VRSystem()
-                                  ->GetTrackedDeviceIndexForControllerRole(
-                                      vr::TrackedControllerRole_LeftHand );
-                        auto rightIndex
-                            = vr::VRSystem()
-                                  ->GetTrackedDeviceIndexForControllerRole(
-                                      vr::TrackedControllerRole_RightHand );
-                        while ( _this->m_chaperoneHapticFeedbackActive )
-                        {
-                            // AS it stands both controllers will vibrate
-                            // regardless of which is closer to boundary
-                            // haptic Frequency is 0-320Hz
-                            if ( leftIndex
-                                 != vr::k_unTrackedDeviceIndexInvalid )
-                            {
-                                vr::VRInput()->TriggerHapticVibrationAction(
-                                    m_leftActionHandle,
-                                    0.0f,
-                                    0.2f,
-                                    120.0f,
-                                    0.5f,
-                                    m_leftInputHandle );
-                            }
-                            if ( rightIndex
-                                 != vr::k_unTrackedDeviceIndexInvalid )
-                            {
-                                vr::VRInput()->TriggerHapticVibrationAction(
-                                    m_rightActionHandle,
-                                    0.0f,
-                                    0.2f,
-                                    120.0f,
-                                    0.5f,
-                                    m_rightInputHandle );
-                            }
-                            std::this_thread::sleep_for(
-                                std::chrono::milliseconds( 5 ) );
-                        }
-                    },
-                    this );
+                m_hapticScheduler.setProximity( utils::HapticDevice::Left,
+                                                intensity );
+            }
+            else
+            {
+                m_hapticScheduler.clearProximity( utils::HapticDevice::Left );
+            }
+            if ( rightIndex != vr::k_unTrackedDeviceIndexInvalid )
+            {
+                m_hapticScheduler.setProximity( utils::HapticDevice::Right,
+                                                intensity );
+            }
+            else
+            {
+                m_hapticScheduler.clearProximity( utils::HapticDevice::Right );
             }
+            m_chaperoneHapticFeedbackActive = true;
         }
         else if ( ( distance > activationDistance || !proxSensorOverrideState )
                   && m_chaperoneHapticFeedbackActive )
         {
+            m_hapticScheduler.clearProximity( utils::HapticDevice::Left );
+            m_hapticScheduler.clearProximity( utils::HapticDevice::Right );
             m_chaperoneHapticFeedbackActive = false;
         }
     }
@@ -332,82 +330,16 @@ void ChaperoneTabController::eventLoopTick(
         }
         else
         {
-            // attempts to reload chaperone data once per ~5 seconds.
-            m_updateTicksChaperoneReload++;
-            if ( m_updateTicksChaperoneReload >= 500 )
-            {
-                m_updateTicksChaperoneReload = 0;
-                LOG( WARNING ) << "Attempting to reload chaperone data";
-                parent->chaperoneUtils().loadChaperoneData();
-            }
+            parent->chaperoneUtils().retryLoadChaperoneData();
         }
     }
-
-    if ( settingsUpdateCounter >= m_chaperoneSettingsUpdateCounter )
-    {
-        if ( parent->isDashboardVisible() )
-        {
-            updateChaperoneSettings();
-        }
-        settingsUpdateCounter = 0;
-    }
-    else
-    {
-        settingsUpdateCounter++;
-    }
 }
 
-void ChaperoneTabController::updateChaperoneSettings()
+void ChaperoneTabController::chaperoneDataReloaded()
 {
-    vr::EVRSettingsError vrSettingsError;
-    float vis = static_cast<float>(
-        vr::VRSettings()->GetInt32( vr::k_pch_CollisionBounds_Section,
-                                    vr::k_pch_CollisionBounds_ColorGammaA_Int32,
-                                    &vrSettingsError ) );
-    if ( vrSettingsError != vr::VRSettingsError_None )
-    {
-        LOG( WARNING ) << "Could not read \""
-                       << vr::k_pch_CollisionBounds_ColorGammaA_Int32
-                       << "\" setting: "
-                       << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                              vrSettingsError );
-    }
-    setBoundsVisibility( vis / 255.0f );
-    if ( vrSettingsError != vr::VRSettingsError_None )
-    {
-        LOG( WARNING ) << "Could not read \""
-                       << vr::k_pch_CollisionBounds_FadeDistance_Float
-                       << "\" setting: "
-                       << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                              vrSettingsError );
-    }
-
-    auto cm = vr::VRSettings()->GetBool(
-        vr::k_pch_CollisionBounds_Section,
-        vr::k_pch_CollisionBounds_CenterMarkerOn_Bool,
-        &vrSettingsError );
-    if ( vrSettingsError != vr::VRSettingsError_None )
-    {
-        LOG( WARNING ) << "Could not read \""
-                       << vr::k_pch_CollisionBounds_CenterMarkerOn_Bool
-                       << "\" setting: "
-                       << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                              vrSettingsError );
-    }
-    setCenterMarker( cm );
-    auto ps
-        = vr::VRSettings()->GetBool( vr::k_pch_CollisionBounds_Section,
-                                     vr::k_pch_CollisionBounds_PlaySpaceOn_Bool,
-                                     &vrSettingsError );
-    if ( vrSettingsError != vr::VRSettingsError_None )
-    {
-        LOG( WARNING ) << "Could not read \""
-                       << vr::k_pch_CollisionBounds_PlaySpaceOn_Bool
-                       << "\" setting: "
-                       << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                              vrSettingsError );
-    }
-    setPlaySpaceMarker( ps );
+    // Room setup and other tools also change the bounds settings, pick them
+    // up on the next tick instead of waiting for the next poll.
+    parent->vrSettingsCache().requestPoll();
 }
 
 float ChaperoneTabController::boundsVisibility() const
@@ -427,10 +359,10 @@ void ChaperoneTabController::setBoundsVisibility( float value, bool notify )
         {
             m_visibility = value;
         }
-        vr::VRSettings()->SetInt32(
+        parent->vrSettingsCache().set(
             vr::k_pch_CollisionBounds_Section,
             vr::k_pch_CollisionBounds_ColorGammaA_Int32,
-            static_cast<int32_t>( 255 * m_visibility ) );
+            boundsVisibilityToGammaA( m_visibility ) );
 
         if ( notify )
         {
@@ -449,7 +381,7 @@ void ChaperoneTabController::setFadeDistance( float value, bool notify )
     if ( fabs( static_cast<double>( m_fadeDistance - value ) ) > 0.005 )
     {
         m_fadeDistance = value;
-        vr::VRSettings()->SetFloat(
+        parent->vrSettingsCache().set(
             vr::k_pch_CollisionBounds_Section,
             vr::k_pch_CollisionBounds_FadeDistance_Float,
             m_fadeDistance );
@@ -500,7 +432,7 @@ void ChaperoneTabController::setCenterMarker( bool value, bool notify )
     if ( m_centerMarker != value )
     {
         m_centerMarker = value;
-        vr::VRSettings()->SetBool(
+        parent->vrSettingsCache().set(
             vr::k_pch_CollisionBounds_Section,
             vr::k_pch_CollisionBounds_CenterMarkerOn_Bool,
             m_centerMarker );
@@ -521,9 +453,10 @@ void ChaperoneTabController::setPlaySpaceMarker( bool value, bool notify )
     if ( m_playSpaceMarker != value )
     {
         m_playSpaceMarker = value;
-        vr::VRSettings()->SetBool( vr::k_pch_CollisionBounds_Section,
-                                   vr::k_pch_CollisionBounds_PlaySpaceOn_Bool,
-                                   m_playSpaceMarker );
+        parent->vrSettingsCache().set(
+            vr::k_pch_CollisionBounds_Section,
+            vr::k_pch_CollisionBounds_PlaySpaceOn_Bool,
+            m_playSpaceMarker );
         if ( notify )
         {
             emit playSpaceMarkerChanged( m_playSpaceMarker );
@@ -602,6 +535,11 @@ float ChaperoneTabController::chaperoneShowDashboardDistance() const
         settings::DoubleSetting::CHAPERONE_showDashboardDistance ) );
 }
 
+QAbstractItemModel* ChaperoneTabController::chaperoneProfilesModel()
+{
+    return &chaperoneProfiles.model();
+}
+
 Q_INVOKABLE unsigned ChaperoneTabController::getChaperoneProfileCount()
 {
     return static_cast<unsigned int>( chaperoneProfiles.size() );
@@ -616,7 +554,7 @@ Q_INVOKABLE QString
     }
     else
     {
-        return QString::fromStdString( chaperoneProfiles[index].profileName );
+        return QString::fromStdString( chaperoneProfiles.name( index ) );
     }
 }
 
@@ -633,42 +571,36 @@ void ChaperoneTabController::setForceBounds( bool value, bool notify )
     }
 }
 
-void ChaperoneTabController::setChaperoneSwitchToBeginnerEnabled( bool value,
-                                                                  bool notify )
+bool ChaperoneTabController::restoreChaperoneStyle()
 {
-    if ( isChaperoneSwitchToBeginnerEnabled() != value )
+    vr::EVRSettingsError vrSettingsError;
+    vr::VRSettings()->SetInt32( vr::k_pch_CollisionBounds_Section,
+                                vr::k_pch_CollisionBounds_Style_Int32,
+                                m_chaperoneSwitchToBeginnerLastStyle,
+                                &vrSettingsError );
+    if ( vrSettingsError != vr::VRSettingsError_None )
     {
-        if ( !value && m_chaperoneSwitchToBeginnerActive )
-        {
-            vr::EVRSettingsError vrSettingsError;
-            vr::VRSettings()->SetInt32( vr::k_pch_CollisionBounds_Section,
-                                        vr::k_pch_CollisionBounds_Style_Int32,
-                                        m_chaperoneSwitchToBeginnerLastStyle,
-                                        &vrSettingsError );
-            if ( vrSettingsError != vr::VRSettingsError_None )
-            {
-                LOG( WARNING )
-                    << "Could not set \""
-                    << vr::k_pch_CollisionBounds_Style_Int32 << "\" setting: "
-                    << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                           vrSettingsError );
-            }
-        }
+        LOG( WARNING ) << "Could not set \""
+                       << vr::k_pch_CollisionBounds_Style_Int32
+                       << "\" setting: "
+                       << vr::VRSettings()->GetSettingsErrorNameFromEnum(
+                              vrSettingsError );
+        return false;
+    }
+    return true;
+}
 
-        m_chaperoneSwitchToBeginnerActive = false;
+// The effects of these settings are applied by the subscriptions from
+// initStage2, so they also follow the settings file and imports.
 
-        settings::setSetting(
-            settings::BoolSetting::CHAPERONE_chaperoneSwitchToBeginnerEnabled,
-            value );
-        if ( notify )
-        {
-            emit chaperoneSwitchToBeginnerEnabledChanged( value );
-        }
-    }
+void ChaperoneTabController::setChaperoneSwitchToBeginnerEnabled( bool value )
+{
+    settings::setSetting(
+        settings::BoolSetting::CHAPERONE_chaperoneSwitchToBeginnerEnabled,
+        value );
 }
 
-void ChaperoneTabController::setChaperoneSwitchToBeginnerDistance( float value,
-                                                                   bool notify )
+void ChaperoneTabController::setChaperoneSwitchToBeginnerDistance( float value )
 {
     if ( fabs( static_cast<double>( chaperoneSwitchToBeginnerDistance()
                                     - value ) )
@@ -677,38 +609,17 @@ void ChaperoneTabController::setChaperoneSwitchToBeginnerDistance( float value,
         settings::setSetting(
             settings::DoubleSetting::CHAPERONE_switchToBeginnerDistance,
             static_cast<double>( value ) );
-
-        if ( notify )
-        {
-            emit chaperoneSwitchToBeginnerDistanceChanged( value );
-        }
     }
 }
 
-void ChaperoneTabController::setChaperoneHapticFeedbackEnabled( bool value,
-                                                                bool notify )
+void ChaperoneTabController::setChaperoneHapticFeedbackEnabled( bool value )
 {
-    if ( isChaperoneHapticFeedbackEnabled() != value )
-    {
-        m_chaperoneHapticFeedbackActive = false;
-        if ( m_chaperoneHapticFeedbackThread.joinable() )
-        {
-            m_chaperoneHapticFeedbackThread.join();
-        }
-
-        settings::setSetting(
-            settings::BoolSetting::CHAPERONE_chaperoneHapticFeedbackEnabled,
-            value );
-
-        if ( notify )
-        {
-            emit chaperoneHapticFeedbackEnabledChanged( value );
-        }
-    }
+    settings::setSetting(
+        settings::BoolSetting::CHAPERONE_chaperoneHapticFeedbackEnabled,
+        value );
 }
 
-void ChaperoneTabController::setChaperoneHapticFeedbackDistance( float value,
-                                                                 bool notify )
+void ChaperoneTabController::setChaperoneHapticFeedbackDistance( float value )
 {
     if ( fabs(
              static_cast<double>( chaperoneHapticFeedbackDistance() - value ) )
@@ -717,82 +628,29 @@ void ChaperoneTabController::setChaperoneHapticFeedbackDistance( float value,
         settings::setSetting(
             settings::DoubleSetting::CHAPERONE_hapticFeedbackDistance,
             static_cast<double>( value ) );
-
-        if ( notify )
-        {
-            emit chaperoneHapticFeedbackDistanceChanged( value );
-        }
     }
 }
 
-void ChaperoneTabController::setChaperoneAlarmSoundEnabled( bool value,
-                                                            bool notify )
+void ChaperoneTabController::setChaperoneAlarmSoundEnabled( bool value )
 {
-    if ( isChaperoneAlarmSoundEnabled() != value )
-    {
-        if ( !value && m_chaperoneAlarmSoundActive )
-        {
-            parent->cancelAlarm01Sound();
-        }
-        m_chaperoneAlarmSoundActive = false;
-
-        settings::setSetting(
-            settings::BoolSetting::CHAPERONE_chaperoneAlarmSoundEnabled,
-            value );
-
-        if ( notify )
-        {
-            emit chaperoneAlarmSoundEnabledChanged( value );
-        }
-    }
+    settings::setSetting(
+        settings::BoolSetting::CHAPERONE_chaperoneAlarmSoundEnabled, value );
 }
 
-void ChaperoneTabController::setChaperoneAlarmSoundLooping( bool value,
-                                                            bool notify )
+void ChaperoneTabController::setChaperoneAlarmSoundLooping( bool value )
 {
-    if ( isChaperoneAlarmSoundLooping() != value )
-    {
-        if ( isChaperoneAlarmSoundEnabled() && m_chaperoneAlarmSoundActive )
-        {
-            if ( isChaperoneAlarmSoundLooping() )
-            {
-                parent->playAlarm01Sound( isChaperoneAlarmSoundLooping() );
-            }
-            else
-            {
-                parent->cancelAlarm01Sound();
-            }
-        }
-
-        settings::setSetting(
-            settings::BoolSetting::CHAPERONE_chaperoneAlarmSoundLooping,
-            value );
-
-        if ( notify )
-        {
-            emit chaperoneAlarmSoundLoopingChanged( value );
-        }
-    }
+    settings::setSetting(
+        settings::BoolSetting::CHAPERONE_chaperoneAlarmSoundLooping, value );
 }
 
-void ChaperoneTabController::setChaperoneAlarmSoundAdjustVolume( bool value,
-                                                                 bool notify )
+void ChaperoneTabController::setChaperoneAlarmSoundAdjustVolume( bool value )
 {
-    if ( isChaperoneAlarmSoundAdjustVolume() != value )
-    {
-        settings::setSetting(
-            settings::BoolSetting::CHAPERONE_chaperoneAlarmSoundAdjustVolume,
-            value );
-
-        if ( notify )
-        {
-            emit chaperoneAlarmSoundAdjustVolumeChanged( value );
-        }
-    }
+    settings::setSetting(
+        settings::BoolSetting::CHAPERONE_chaperoneAlarmSoundAdjustVolume,
+        value );
 }
 
-void ChaperoneTabController::setChaperoneAlarmSoundDistance( float value,
-                                                             bool notify )
+void ChaperoneTabController::setChaperoneAlarmSoundDistance( float value )
 {
     if ( fabs( static_cast<double>( chaperoneAlarmSoundDistance() - value ) )
          > 0.005 )
@@ -800,34 +658,16 @@ void ChaperoneTabController::setChaperoneAlarmSoundDistance( float value,
         settings::setSetting(
             settings::DoubleSetting::CHAPERONE_alarmSoundDistance,
             static_cast<double>( value ) );
-
-        if ( notify )
-        {
-            emit chaperoneAlarmSoundDistanceChanged( value );
-        }
     }
 }
 
-void ChaperoneTabController::setChaperoneShowDashboardEnabled( bool value,
-                                                               bool notify )
+void ChaperoneTabController::setChaperoneShowDashboardEnabled( bool value )
 {
-    if ( isChaperoneShowDashboardEnabled() != value )
-    {
-        m_chaperoneShowDashboardActive = false;
-
-        settings::setSetting(
-            settings::BoolSetting::CHAPERONE_chaperoneShowDashboardEnabled,
-            value );
-
-        if ( notify )
-        {
-            emit chaperoneShowDashboardEnabledChanged( value );
-        }
-    }
+    settings::setSetting(
+        settings::BoolSetting::CHAPERONE_chaperoneShowDashboardEnabled, value );
 }
 
-void ChaperoneTabController::setChaperoneShowDashboardDistance( float value,
-                                                                bool notify )
+void ChaperoneTabController::setChaperoneShowDashboardDistance( float value )
 {
     if ( fabs( static_cast<double>( chaperoneShowDashboardDistance() - value ) )
          > 0.005 )
@@ -835,42 +675,121 @@ void ChaperoneTabController::setChaperoneShowDashboardDistance( float value,
         settings::setSetting(
             settings::DoubleSetting::CHAPERONE_showDashboardDistance,
             static_cast<double>( value ) );
-
-        if ( notify )
-        {
-            emit chaperoneShowDashboardDistanceChanged( value );
-        }
     }
 }
 
-void ChaperoneTabController::setDisableChaperone( bool value, bool notify )
+void ChaperoneTabController::setDisableChaperone( bool value )
 {
-    if ( disableChaperone() != value )
-    {
-        if ( value )
-        {
-            settings::setSetting(
-                settings::DoubleSetting::CHAPERONE_fadeDistanceRemembered,
-                static_cast<double>( value ) );
-
-            setFadeDistance( 0.0f, true );
-        }
-        else
-        {
-            setFadeDistance( static_cast<float>( settings::getSetting(
-                                 settings::DoubleSetting::
-                                     CHAPERONE_fadeDistanceRemembered ) ),
-                             true );
-        }
+    settings::setSetting( settings::BoolSetting::CHAPERONE_disableChaperone,
+                          value );
+}
 
-        settings::setSetting( settings::BoolSetting::CHAPERONE_disableChaperone,
-                              value );
+void ChaperoneTabController::subscribeToSettings()
+{
+    using settings::BoolSetting;
+    using settings::DoubleSetting;
+
+    m_settingSubscriptions = {
+        settings::subscribe(
+            BoolSetting::CHAPERONE_chaperoneSwitchToBeginnerEnabled,
+            [this]( bool value ) {
+                if ( !value && m_chaperoneSwitchToBeginnerActive )
+                {
+                    restoreChaperoneStyle();
+                }
+                m_chaperoneSwitchToBeginnerActive = false;
+                emit chaperoneSwitchToBeginnerEnabledChanged( value );
+            } ),
+        settings::subscribe(
+            DoubleSetting::CHAPERONE_switchToBeginnerDistance,
+            [this]( double value ) {
+                emit chaperoneSwitchToBeginnerDistanceChanged(
+                    static_cast<float>( value ) );
+            } ),
+        settings::subscribe(
+            BoolSetting::CHAPERONE_chaperoneHapticFeedbackEnabled,
+            [this]( bool value ) {
+                m_hapticScheduler.clearProximity( utils::HapticDevice::Left );
+                m_hapticScheduler.clearProximity( utils::HapticDevice::Right );
+                m_chaperoneHapticFeedbackActive = false;
+                emit chaperoneHapticFeedbackEnabledChanged( value );
+            } ),
+        settings::subscribe(
+            DoubleSetting::CHAPERONE_hapticFeedbackDistance,
+            [this]( double value ) {
+                emit chaperoneHapticFeedbackDistanceChanged(
+                    static_cast<float>( value ) );
+            } ),
+        settings::subscribe(
+            BoolSetting::CHAPERONE_chaperoneAlarmSoundEnabled,
+            [this]( bool value ) {
+                if ( !value && m_chaperoneAlarmSoundActive )
+                {
+                    parent->cancelAlarm01Sound();
+                }
+                m_chaperoneAlarmSoundActive = false;
+                emit chaperoneAlarmSoundEnabledChanged( value );
+            } ),
+        settings::subscribe(
+            BoolSetting::CHAPERONE_chaperoneAlarmSoundLooping,
+            [this]( bool value ) {
+                // A playing alarm follows the new mode.
+                if ( isChaperoneAlarmSoundEnabled()
+                     && m_chaperoneAlarmSoundActive )
+                {
+                    if ( value )
+                    {
+                        parent->playAlarm01Sound( value );
+                    }
+                    else
+                    {
+                        parent->cancelAlarm01Sound();
+                    }
+                }
+                emit chaperoneAlarmSoundLoopingChanged( value );
+            } ),
+        settings::subscribe(
+            BoolSetting::CHAPERONE_chaperoneAlarmSoundAdjustVolume,
+            [this]( bool value ) {
+                emit chaperoneAlarmSoundAdjustVolumeChanged( value );
+            } ),
+        settings::subscribe( DoubleSetting::CHAPERONE_alarmSoundDistance,
+                             [this]( double value ) {
+                                 emit chaperoneAlarmSoundDistanceChanged(
+                                     static_cast<float>( value ) );
+                             } ),
+        settings::subscribe(
+            BoolSetting::CHAPERONE_chaperoneShowDashboardEnabled,
+            [this]( bool value ) {
+                m_chaperoneShowDashboardActive = false;
+                emit chaperoneShowDashboardEnabledChanged( value );
+            } ),
+        settings::subscribe(
+            DoubleSetting::CHAPERONE_showDashboardDistance,
+            [this]( double value ) {
+                emit chaperoneShowDashboardDistanceChanged(
+                    static_cast<float>( value ) );
+            } ),
+        settings::subscribe(
+            BoolSetting::CHAPERONE_disableChaperone, [this]( bool value ) {
+                if ( value )
+                {
+                    settings::setSetting(
+                        DoubleSetting::CHAPERONE_fadeDistanceRemembered,
+                        static_cast<double>( value ) );
 
-        if ( notify )
-        {
-            emit disableChaperoneChanged( value );
-        }
-    }
+                    setFadeDistance( 0.0f, true );
+                }
+                else
+                {
+                    setFadeDistance(
+                        static_cast<float>( settings::getSetting(
+                            DoubleSetting::CHAPERONE_fadeDistanceRemembered ) ),
+                        true );
+                }
+                emit disableChaperoneChanged( value );
+            } ),
+    };
 }
 
 void ChaperoneTabController::flipOrientation( double degrees )
@@ -906,23 +825,9 @@ void ChaperoneTabController::addChaperoneProfile(
     bool includesProximityWarningSettings )
 {
     vr::EVRSettingsError vrSettingsError;
-    ChaperoneProfile* profile = nullptr;
-    for ( auto& p : chaperoneProfiles )
-    {
-        if ( p.profileName.compare( name.toStdString() ) == 0 )
-        {
-            profile = &p;
-            break;
-        }
-    }
-    if ( !profile )
-    {
-        auto i = chaperoneProfiles.size();
-        chaperoneProfiles.emplace_back();
-        profile = &chaperoneProfiles[i];
-    }
-    profile->profileName = name.toStdString();
-    profile->includesChaperoneGeometry = includeGeometry;
+    ChaperoneProfile profile;
+    profile.profileName = name.toStdString();
+    profile.includesChaperoneGeometry = includeGeometry;
     if ( includeGeometry )
     {
         vr::VRChaperoneSetup()->HideWorkingSetPreview();
@@ -930,43 +835,42 @@ void ChaperoneTabController::addChaperoneProfile(
         uint32_t quadCount = 0;
         vr::VRChaperoneSetup()->GetLiveCollisionBoundsInfo( nullptr,
                                                             &quadCount );
-        profile->chaperoneGeometryQuadCount = quadCount;
-        for ( int i = 0; i < static_cast<int>( quadCount ); ++i )
-        {
-            profile->chaperoneGeometryQuads.emplace_back();
-        }
+        profile.chaperoneGeometryQuadCount = quadCount;
+        profile.chaperoneGeometryQuads.resize( quadCount );
 
         vr::VRChaperoneSetup()->GetLiveCollisionBoundsInfo(
-            profile->chaperoneGeometryQuads.data(), &quadCount );
+            profile.chaperoneGeometryQuads.data(), &quadCount );
         vr::VRChaperoneSetup()->GetWorkingStandingZeroPoseToRawTrackingPose(
-            &profile->standingCenter );
+            &profile.standingCenter );
         vr::VRChaperoneSetup()->GetWorkingPlayAreaSize(
-            &profile->playSpaceAreaX, &profile->playSpaceAreaZ );
+            &profile.playSpaceAreaX, &profile.playSpaceAreaZ );
+        profile.chaperoneGeometryBlob.clear();
+        profile.chaperoneGeometryLoaded = true;
     }
-    profile->includesVisibility = includeVisbility;
+    profile.includesVisibility = includeVisbility;
     if ( includeVisbility )
     {
-        profile->visibility = m_visibility;
+        profile.visibility = m_visibility;
     }
-    profile->includesFadeDistance = includeFadeDistance;
+    profile.includesFadeDistance = includeFadeDistance;
     if ( includeFadeDistance )
     {
-        profile->fadeDistance = m_fadeDistance;
+        profile.fadeDistance = m_fadeDistance;
     }
-    profile->includesCenterMarker = includeCenterMarker;
+    profile.includesCenterMarker = includeCenterMarker;
     if ( includeCenterMarker )
     {
-        profile->centerMarker = m_centerMarker;
+        profile.centerMarker = m_centerMarker;
     }
-    profile->includesPlaySpaceMarker = includePlaySpaceMarker;
+    profile.includesPlaySpaceMarker = includePlaySpaceMarker;
     if ( includePlaySpaceMarker )
     {
-        profile->playSpaceMarker = m_playSpaceMarker;
+        profile.playSpaceMarker = m_playSpaceMarker;
     }
-    profile->includesFloorBoundsMarker = includeFloorBounds;
+    profile.includesFloorBoundsMarker = includeFloorBounds;
     if ( includeFloorBounds )
     {
-        profile->floorBoundsMarker = vr::VRSettings()->GetBool(
+        profile.floorBoundsMarker = vr::VRSettings()->GetBool(
             vr::k_pch_CollisionBounds_Section,
             vr::k_pch_CollisionBounds_GroundPerimeterOn_Bool,
             &vrSettingsError );
@@ -979,10 +883,10 @@ void ChaperoneTabController::addChaperoneProfile(
                                   vrSettingsError );
         }
     }
-    profile->includesBoundsColor = includeBoundsColor;
+    profile.includesBoundsColor = includeBoundsColor;
     if ( includeBoundsColor )
     {
-        profile->boundsColor[0] = vr::VRSettings()->GetInt32(
+        profile.boundsColor[0] = vr::VRSettings()->GetInt32(
             vr::k_pch_CollisionBounds_Section,
             vr::k_pch_CollisionBounds_ColorGammaR_Int32,
             &vrSettingsError );
@@ -994,7 +898,7 @@ void ChaperoneTabController::addChaperoneProfile(
                            << vr::VRSettings()->GetSettingsErrorNameFromEnum(
                                   vrSettingsError );
         }
-        profile->boundsColor[1] = vr::VRSettings()->GetInt32(
+        profile.boundsColor[1] = vr::VRSettings()->GetInt32(
             vr::k_pch_CollisionBounds_Section,
             vr::k_pch_CollisionBounds_ColorGammaG_Int32,
             &vrSettingsError );
@@ -1006,7 +910,7 @@ void ChaperoneTabController::addChaperoneProfile(
                            << vr::VRSettings()->GetSettingsErrorNameFromEnum(
                                   vrSettingsError );
         }
-        profile->boundsColor[2] = vr::VRSettings()->GetInt32(
+        profile.boundsColor[2] = vr::VRSettings()->GetInt32(
             vr::k_pch_CollisionBounds_Section,
             vr::k_pch_CollisionBounds_ColorGammaB_Int32,
             &vrSettingsError );
@@ -1019,10 +923,10 @@ void ChaperoneTabController::addChaperoneProfile(
                                   vrSettingsError );
         }
     }
-    profile->includesChaperoneStyle = includeChaperoneStyle;
+    profile.includesChaperoneStyle = includeChaperoneStyle;
     if ( includeChaperoneStyle )
     {
-        profile->chaperoneStyle
+        profile.chaperoneStyle
             = vr::VRSettings()->GetInt32( vr::k_pch_CollisionBounds_Section,
                                           vr::k_pch_CollisionBounds_Style_Int32,
                                           &vrSettingsError );
@@ -1035,43 +939,175 @@ void ChaperoneTabController::addChaperoneProfile(
                                   vrSettingsError );
         }
     }
-    profile->includesForceBounds = includeForceBounds;
+    profile.includesForceBounds = includeForceBounds;
     if ( includeForceBounds )
     {
-        profile->forceBounds = m_forceBounds;
+        profile.forceBounds = m_forceBounds;
     }
-    profile->includesProximityWarningSettings
+    profile.includesProximityWarningSettings
         = includesProximityWarningSettings;
     if ( includesProximityWarningSettings )
     {
-        profile->enableChaperoneSwitchToBeginner
+        profile.enableChaperoneSwitchToBeginner
             = isChaperoneSwitchToBeginnerEnabled();
-        profile->chaperoneSwitchToBeginnerDistance
+        profile.chaperoneSwitchToBeginnerDistance
             = chaperoneSwitchToBeginnerDistance();
-        profile->enableChaperoneHapticFeedback
+        profile.enableChaperoneHapticFeedback
             = isChaperoneHapticFeedbackEnabled();
-        profile->chaperoneHapticFeedbackDistance
+        profile.chaperoneHapticFeedbackDistance
             = chaperoneHapticFeedbackDistance();
-        profile->enableChaperoneAlarmSound = isChaperoneAlarmSoundEnabled();
-        profile->chaperoneAlarmSoundLooping = isChaperoneAlarmSoundLooping();
-        profile->chaperoneAlarmSoundAdjustVolume
+        profile.enableChaperoneAlarmSound = isChaperoneAlarmSoundEnabled();
+        profile.chaperoneAlarmSoundLooping = isChaperoneAlarmSoundLooping();
+        profile.chaperoneAlarmSoundAdjustVolume
             = isChaperoneAlarmSoundAdjustVolume();
-        profile->chaperoneAlarmSoundDistance = chaperoneAlarmSoundDistance();
-        profile->enableChaperoneShowDashboard
+        profile.chaperoneAlarmSoundDistance = chaperoneAlarmSoundDistance();
+        profile.enableChaperoneShowDashboard
             = isChaperoneShowDashboardEnabled();
-        profile->chaperoneShowDashboardDistance
+        profile.chaperoneShowDashboardDistance
             = chaperoneShowDashboardDistance();
     }
+    chaperoneProfiles.put( std::move( profile ) );
     saveChaperoneProfiles();
     emit chaperoneProfilesUpdated();
 }
 
+bool ChaperoneTabController::isLiveChaperoneGeometry(
+    const ChaperoneProfile& profile )
+{
+    constexpr float k_geometryEpsilon = 0.0001f;
+    const auto nearlyEqual = []( float a, float b ) {
+        return std::fabs( a - b ) <= k_geometryEpsilon;
+    };
+
+    // Any move center offset is part of the live geometry, so the profile
+    // can only match when no offsets are applied.
+    const auto& moveCenter = parent->m_moveCenterTabController;
+    if ( moveCenter.offsetX() != 0.0f || moveCenter.offsetY() != 0.0f
+         || moveCenter.offsetZ() != 0.0f || moveCenter.rotation() != 0 )
+    {
+        return false;
+    }
+
+    uint32_t liveQuadCount = 0;
+    vr::VRChaperoneSetup()->GetLiveCollisionBoundsInfo( nullptr,
+                                                        &liveQuadCount );
+    if ( liveQuadCount != profile.chaperoneGeometryQuadCount )
+    {
+        return false;
+    }
+
+    std::vector<vr::HmdQuad_t> liveQuads( liveQuadCount );
+    if ( !vr::VRChaperoneSetup()->GetLiveCollisionBoundsInfo(
+             liveQuads.data(), &liveQuadCount )
+         || liveQuadCount != profile.chaperoneGeometryQuadCount )
+    {
+        return false;
+    }
+
+    for ( size_t q = 0; q < liveQuads.size(); ++q )
+    {
+        for ( int c = 0; c < 4; ++c )
+        {
+            for ( int v = 0; v < 3; ++v )
+            {
+                if ( !nearlyEqual(
+                         liveQuads[q].vCorners[c].v[v],
+                         profile.chaperoneGeometryQuads[q].vCorners[c].v[v] ) )
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    // There is no live getter for the standing zero pose, but its inverse
+    // is live. Reverting the working copy to read it would throw away
+    // edits that aren't committed yet.
+    const auto rawToStanding
+        = vr::VRSystem()->GetRawZeroPoseToStandingAbsoluteTrackingPose();
+    const auto& standingToRaw = profile.standingCenter;
+    for ( int i = 0; i < 3; ++i )
+    {
+        for ( int j = 0; j < 4; ++j )
+        {
+            // Row i of rawToStanding * standingToRaw, which is the identity
+            // when the profile's standing pose is live.
+            auto product = j == 3 ? rawToStanding.m[i][3] : 0.0f;
+            for ( int k = 0; k < 3; ++k )
+            {
+                product += rawToStanding.m[i][k] * standingToRaw.m[k][j];
+            }
+            if ( !nearlyEqual( product, i == j ? 1.0f : 0.0f ) )
+            {
+                return false;
+            }
+        }
+    }
+
+    float livePlayAreaX = 0.0f;
+    float livePlayAreaZ = 0.0f;
+    if ( !vr::VRChaperone()->GetPlayAreaSize( &livePlayAreaX,
+                                              &livePlayAreaZ ) )
+    {
+        return false;
+    }
+    return nearlyEqual( livePlayAreaX, profile.playSpaceAreaX )
+           && nearlyEqual( livePlayAreaZ, profile.playSpaceAreaZ );
+}
+
+template <typename Value>
+bool ChaperoneTabController::liveCollisionBoundsEquals( const char* key,
+                                                        Value value )
+{
+    const auto section = vr::k_pch_CollisionBounds_Section;
+    vr::EVRSettingsError vrSettingsError;
+    Value current;
+    if constexpr ( std::is_same_v<Value, bool> )
+    {
+        current = vr::VRSettings()->GetBool( section, key, &vrSettingsError );
+    }
+    else
+    {
+        current = vr::VRSettings()->GetInt32( section, key, &vrSettingsError );
+    }
+    if ( vrSettingsError != vr::VRSettingsError_None )
+    {
+        LOG( WARNING ) << "Could not read \"" << key << "\" setting: "
+                       << vr::VRSettings()->GetSettingsErrorNameFromEnum(
+                              vrSettingsError );
+        return false;
+    }
+    return current == value;
+}
+
 void ChaperoneTabController::applyChaperoneProfile( unsigned index )
 {
     if ( index < chaperoneProfiles.size() )
     {
-        auto& profile = chaperoneProfiles[index];
-        if ( profile.includesChaperoneGeometry )
+        // Not const, the geometry is decoded on first use.
+        auto& profile = chaperoneProfiles.cached( index );
+
+        // Only values that differ from the live state are written, so
+        // switching between similar profiles doesn't spam the runtime.
+        unsigned writes = 0;
+        unsigned skippedWrites = 0;
+        const auto diff = [&writes, &skippedWrites]( bool changed ) {
+            ++( changed ? writes : skippedWrites );
+            return changed;
+        };
+        const auto floatChanged = []( float current, float value ) {
+            return std::fabs( static_cast<double>( current - value ) ) > 0.005;
+        };
+
+        if ( profile.includesChaperoneGeometry
+             && !profile.loadChaperoneGeometry() )
+        {
+            LOG( ERROR ) << "Could not load geometry of chaperone profile \""
+                         << profile.profileName
+                         << "\". Skipping geometry.";
+        }
+        else if ( profile.includesChaperoneGeometry
+                  && diff( !isLiveChaperoneGeometry( profile ) ) )
         {
             parent->m_moveCenterTabController.reset();
             vr::VRChaperoneSetup()->HideWorkingSetPreview();
@@ -1087,23 +1123,41 @@ void ChaperoneTabController::applyChaperoneProfile( unsigned index )
                 vr::EChaperoneConfigFile_Live );
             parent->m_moveCenterTabController.zeroOffsets();
         }
-        if ( profile.includesVisibility )
+        // The cached members lag behind changes made by other tools until
+        // the next poll, so the runtime values are compared. The poll brings
+        // the watched members up to date, so their setters write exactly
+        // when the runtime differs.
+        parent->vrSettingsCache().poll();
+        if ( profile.includesVisibility
+             && diff( !liveCollisionBoundsEquals<int32_t>(
+                 vr::k_pch_CollisionBounds_ColorGammaA_Int32,
+                 boundsVisibilityToGammaA( profile.visibility ) ) ) )
         {
             setBoundsVisibility( profile.visibility );
         }
-        if ( profile.includesFadeDistance )
+        if ( profile.includesFadeDistance
+             && diff( floatChanged( fadeDistance(), profile.fadeDistance ) ) )
         {
             setFadeDistance( profile.fadeDistance );
         }
-        if ( profile.includesCenterMarker )
+        if ( profile.includesCenterMarker
+             && diff( !liveCollisionBoundsEquals(
+                 vr::k_pch_CollisionBounds_CenterMarkerOn_Bool,
+                 profile.centerMarker ) ) )
         {
             setCenterMarker( profile.centerMarker );
         }
-        if ( profile.includesPlaySpaceMarker )
+        if ( profile.includesPlaySpaceMarker
+             && diff( !liveCollisionBoundsEquals(
+                 vr::k_pch_CollisionBounds_PlaySpaceOn_Bool,
+                 profile.playSpaceMarker ) ) )
         {
             setPlaySpaceMarker( profile.playSpaceMarker );
         }
-        if ( profile.includesFloorBoundsMarker )
+        if ( profile.includesFloorBoundsMarker
+             && diff( !liveCollisionBoundsEquals(
+                 vr::k_pch_CollisionBounds_GroundPerimeterOn_Bool,
+                 profile.floorBoundsMarker ) ) )
         {
             vr::VRSettings()->SetBool(
                 vr::k_pch_CollisionBounds_Section,
@@ -1112,50 +1166,106 @@ void ChaperoneTabController::applyChaperoneProfile( unsigned index )
         }
         if ( profile.includesBoundsColor )
         {
-            vr::VRSettings()->SetInt32(
-                vr::k_pch_CollisionBounds_Section,
-                vr::k_pch_CollisionBounds_ColorGammaR_Int32,
-                profile.boundsColor[0] );
-            vr::VRSettings()->SetInt32(
-                vr::k_pch_CollisionBounds_Section,
-                vr::k_pch_CollisionBounds_ColorGammaG_Int32,
-                profile.boundsColor[1] );
-            vr::VRSettings()->SetInt32(
-                vr::k_pch_CollisionBounds_Section,
-                vr::k_pch_CollisionBounds_ColorGammaB_Int32,
-                profile.boundsColor[2] );
+            const char* colorKeys[3]
+                = { vr::k_pch_CollisionBounds_ColorGammaR_Int32,
+                    vr::k_pch_CollisionBounds_ColorGammaG_Int32,
+                    vr::k_pch_CollisionBounds_ColorGammaB_Int32 };
+            for ( int i = 0; i < 3; ++i )
+            {
+                if ( diff( !liveCollisionBoundsEquals<int32_t>(
+                         colorKeys[i], profile.boundsColor[i] ) ) )
+                {
+                    vr::VRSettings()->SetInt32(
+                        vr::k_pch_CollisionBounds_Section,
+                        colorKeys[i],
+                        profile.boundsColor[i] );
+                }
+            }
         }
-        if ( profile.includesChaperoneStyle )
+        if ( profile.includesChaperoneStyle
+             && diff( !liveCollisionBoundsEquals<int32_t>(
+                 vr::k_pch_CollisionBounds_Style_Int32,
+                 profile.chaperoneStyle ) ) )
         {
             vr::VRSettings()->SetInt32( vr::k_pch_CollisionBounds_Section,
                                         vr::k_pch_CollisionBounds_Style_Int32,
                                         profile.chaperoneStyle );
         }
-        if ( profile.includesForceBounds )
+        if ( profile.includesForceBounds
+             && diff( forceBounds() != profile.forceBounds ) )
         {
             setForceBounds( profile.forceBounds );
         }
         if ( profile.includesProximityWarningSettings )
         {
-            setChaperoneSwitchToBeginnerDistance(
-                profile.chaperoneSwitchToBeginnerDistance );
-            setChaperoneSwitchToBeginnerEnabled(
-                profile.enableChaperoneSwitchToBeginner );
-            setChaperoneHapticFeedbackDistance(
-                profile.chaperoneHapticFeedbackDistance );
-            setChaperoneHapticFeedbackEnabled(
-                profile.enableChaperoneHapticFeedback );
-            setChaperoneAlarmSoundLooping( profile.chaperoneAlarmSoundLooping );
-            setChaperoneAlarmSoundAdjustVolume(
-                profile.chaperoneAlarmSoundAdjustVolume );
-            setChaperoneAlarmSoundDistance(
-                profile.chaperoneAlarmSoundDistance );
-            setChaperoneAlarmSoundEnabled( profile.enableChaperoneAlarmSound );
-            setChaperoneShowDashboardDistance(
-                profile.chaperoneShowDashboardDistance );
-            setChaperoneShowDashboardEnabled(
-                profile.enableChaperoneShowDashboard );
+            if ( diff( floatChanged(
+                     chaperoneSwitchToBeginnerDistance(),
+                     profile.chaperoneSwitchToBeginnerDistance ) ) )
+            {
+                setChaperoneSwitchToBeginnerDistance(
+                    profile.chaperoneSwitchToBeginnerDistance );
+            }
+            if ( diff( isChaperoneSwitchToBeginnerEnabled()
+                       != profile.enableChaperoneSwitchToBeginner ) )
+            {
+                setChaperoneSwitchToBeginnerEnabled(
+                    profile.enableChaperoneSwitchToBeginner );
+            }
+            if ( diff( floatChanged(
+                     chaperoneHapticFeedbackDistance(),
+                     profile.chaperoneHapticFeedbackDistance ) ) )
+            {
+                setChaperoneHapticFeedbackDistance(
+                    profile.chaperoneHapticFeedbackDistance );
+            }
+            if ( diff( isChaperoneHapticFeedbackEnabled()
+                       != profile.enableChaperoneHapticFeedback ) )
+            {
+                setChaperoneHapticFeedbackEnabled(
+                    profile.enableChaperoneHapticFeedback );
+            }
+            if ( diff( isChaperoneAlarmSoundLooping()
+                       != profile.chaperoneAlarmSoundLooping ) )
+            {
+                setChaperoneAlarmSoundLooping(
+                    profile.chaperoneAlarmSoundLooping );
+            }
+            if ( diff( isChaperoneAlarmSoundAdjustVolume()
+                       != profile.chaperoneAlarmSoundAdjustVolume ) )
+            {
+                setChaperoneAlarmSoundAdjustVolume(
+                    profile.chaperoneAlarmSoundAdjustVolume );
+            }
+            if ( diff( floatChanged( chaperoneAlarmSoundDistance(),
+                                     profile.chaperoneAlarmSoundDistance ) ) )
+            {
+                setChaperoneAlarmSoundDistance(
+                    profile.chaperoneAlarmSoundDistance );
+            }
+            if ( diff( isChaperoneAlarmSoundEnabled()
+                       != profile.enableChaperoneAlarmSound ) )
+            {
+                setChaperoneAlarmSoundEnabled(
+                    profile.enableChaperoneAlarmSound );
+            }
+            if ( diff( floatChanged(
+                     chaperoneShowDashboardDistance(),
+                     profile.chaperoneShowDashboardDistance ) ) )
+            {
+                setChaperoneShowDashboardDistance(
+                    profile.chaperoneShowDashboardDistance );
+            }
+            if ( diff( isChaperoneShowDashboardEnabled()
+                       != profile.enableChaperoneShowDashboard ) )
+            {
+                setChaperoneShowDashboardEnabled(
+                    profile.enableChaperoneShowDashboard );
+            }
         }
+
+        LOG( INFO ) << "Applied chaperone profile \"" << profile.profileName
+                    << "\": " << writes << " writes, " << skippedWrites
+                    << " skipped as unchanged.";
     }
 }
 
@@ -1163,8 +1273,7 @@ void ChaperoneTabController::deleteChaperoneProfile( unsigned index )
 {
     if ( index < chaperoneProfiles.size() )
     {
-        auto pos = chaperoneProfiles.begin() + index;
-        chaperoneProfiles.erase( pos );
+        chaperoneProfiles.remove( index );
         saveChaperoneProfiles();
         emit chaperoneProfilesUpdated();
     }
@@ -1173,25 +1282,18 @@ void ChaperoneTabController::deleteChaperoneProfile( unsigned index )
 std::pair<bool, unsigned>
     ChaperoneTabController::getChaperoneProfileIndexFromName( std::string name )
 {
-    std::pair<bool, unsigned> result = { false, 0 };
-    unsigned profileIndex = 0;
-    for ( auto& p : chaperoneProfiles )
+    const auto index = chaperoneProfiles.indexOf( name );
+    if ( !index )
     {
-        if ( name == p.profileName )
-        {
-            result.first = true;
-            result.second = profileIndex;
-            break;
-        }
-        profileIndex++;
+        return { false, 0 };
     }
-    return result;
+    return { true, static_cast<unsigned>( *index ) };
 }
 
 void ChaperoneTabController::createNewAutosaveProfile()
 {
     // update settings to live chaperone
-    updateChaperoneSettings();
+    parent->vrSettingsCache().poll();
 
     // lookup the index for old autosave and delete it
     std::pair<bool, unsigned> previousAutosaveIndexLookup
@@ -1211,8 +1313,8 @@ void ChaperoneTabController::createNewAutosaveProfile()
         = getChaperoneProfileIndexFromName( "«Autosaved Profile»" );
     if ( currentAutosaveIndexLookup.first )
     {
-        chaperoneProfiles[currentAutosaveIndexLookup.second].profileName
-            = "«Autosaved Profile (previous)»";
+        chaperoneProfiles.rename( currentAutosaveIndexLookup.second,
+                                  "«Autosaved Profile (previous)»" );
         saveChaperoneProfiles();
         emit chaperoneProfilesUpdated();
     }
@@ -1312,28 +1414,29 @@ void ChaperoneTabController::reset()
 
     setForceBounds( false );
 
-    settingsUpdateCounter = 999; // Easiest way to get default values
+    // Easiest way to get default values
+    parent->vrSettingsCache().requestPoll();
 }
 
 void ChaperoneTabController::setRightHapticActionHandle(
     vr::VRActionHandle_t handle )
 {
-    m_rightActionHandle = handle;
+    m_hapticScheduler.setActionHandle( utils::HapticDevice::Right, handle );
 }
 void ChaperoneTabController::setLeftHapticActionHandle(
     vr::VRActionHandle_t handle )
 {
-    m_leftActionHandle = handle;
+    m_hapticScheduler.setActionHandle( utils::HapticDevice::Left, handle );
 }
 void ChaperoneTabController::setRightInputHandle(
     vr::VRInputValueHandle_t handle )
 {
-    m_rightInputHandle = handle;
+    m_hapticScheduler.setInputHandle( utils::HapticDevice::Right, handle );
 }
 void ChaperoneTabController::setLeftInputHandle(
     vr::VRInputValueHandle_t handle )
 {
-    m_leftInputHandle = handle;
+    m_hapticScheduler.setInputHandle( utils::HapticDevice::Left, handle );
 }
 
 void ChaperoneTabController::addLeftHapticClick( bool leftHapticClickPressed )
@@ -1342,8 +1445,8 @@ void ChaperoneTabController::addLeftHapticClick( bool leftHapticClickPressed )
     if ( leftHapticClickPressed && !m_leftHapticClickActivated )
     {
         // play activation haptic sequence
-        vr::VRInput()->TriggerHapticVibrationAction(
-            m_leftActionHandle, 0.0f, 0.08f, 300.0f, 0.7f, m_leftInputHandle );
+        m_hapticScheduler.queuePulse( utils::HapticDevice::Left,
+                                      { 0.08f, 300.0f, 0.7f } );
         m_leftHapticClickActivated = true;
         return;
     }
@@ -1352,8 +1455,8 @@ void ChaperoneTabController::addLeftHapticClick( bool leftHapticClickPressed )
     if ( !leftHapticClickPressed && m_leftHapticClickActivated )
     {
         // play deactivation haptic sequence
-        vr::VRInput()->TriggerHapticVibrationAction(
-            m_leftActionHandle, 0.0f, 0.08f, 120.0f, 0.7f, m_leftInputHandle );
+        m_hapticScheduler.queuePulse( utils::HapticDevice::Left,
+                                      { 0.08f, 120.0f, 0.7f } );
 
         m_leftHapticClickActivated = false;
         return;
@@ -1366,12 +1469,8 @@ void ChaperoneTabController::addRightHapticClick( bool rightHapticClickPressed )
     if ( rightHapticClickPressed && !m_rightHapticClickActivated )
     {
         // play activation haptic sequence
-        vr::VRInput()->TriggerHapticVibrationAction( m_rightActionHandle,
-                                                     0.0f,
-                                                     0.08f,
-                                                     300.0f,
-                                                     0.7f,
-                                                     m_rightInputHandle );
+        m_hapticScheduler.queuePulse( utils::HapticDevice::Right,
+                                      { 0.08f, 300.0f, 0.7f } );
         m_rightHapticClickActivated = true;
         return;
     }
@@ -1380,12 +1479,8 @@ void ChaperoneTabController::addRightHapticClick( bool rightHapticClickPressed )
     if ( !rightHapticClickPressed && m_rightHapticClickActivated )
     {
         // play deactivation haptic sequence
-        vr::VRInput()->TriggerHapticVibrationAction( m_rightActionHandle,
-                                                     0.0f,
-                                                     0.08f,
-                                                     120.0f,
-                                                     0.7f,
-                                                     m_rightInputHandle );
+        m_hapticScheduler.queuePulse( utils::HapticDevice::Right,
+                                      { 0.08f, 120.0f, 0.7f } );
 
         m_rightHapticClickActivated = false;
         return;
@@ -5,10 +5,14 @@
 #include <memory>
 #include <chrono>
 #include <thread>
+#include <vector>
 #include <openvr.h>
 #include <cmath>
-#include "../utils/FrameRateUtils.h"
+#include "../utils/ChaperoneGeometryBlob.h"
+#include "../utils/HapticScheduler.h"
 #include "../settings/settings_object.h"
+#include "../settings/profile_store.h"
+#include "../settings/settings.h"
 
 class QQuickWindow;
 // application namespace
@@ -28,6 +32,12 @@ struct ChaperoneProfile : settings::ISettingsObject
     float playSpaceAreaX = 0.0f;
     float playSpaceAreaZ = 0.0f;
 
+    // Geometry is stored as a compact blob and only decoded the first time
+    // the profile is applied. Until then the geometry members above are
+    // empty and the blob is written back unchanged on save.
+    std::string chaperoneGeometryBlob;
+    bool chaperoneGeometryLoaded = true;
+
     bool includesVisibility = false;
     float visibility = 0.6f;
 
@@ -73,30 +83,25 @@ struct ChaperoneProfile : settings::ISettingsObject
         o.addValue( includesChaperoneGeometry );
         o.addValue( static_cast<int>( chaperoneGeometryQuadCount ) );
 
-        if ( chaperoneGeometryQuadCount > 0 )
+        // The second string marks the compact format. It is always written,
+        // even if empty, so that loadSettings can tell it apart from the
+        // legacy format that stored every coordinate as a separate double.
+        if ( !chaperoneGeometryLoaded )
         {
-            for ( auto& arrayMember : chaperoneGeometryQuads )
-            {
-                for ( auto& corner : arrayMember.vCorners )
-                {
-                    for ( auto& vector : corner.v )
-                    {
-                        o.addValue( static_cast<double>( vector ) );
-                    }
-                }
-            }
+            o.addValue( chaperoneGeometryBlob );
         }
-
-        for ( int i = 0; i < 3; ++i )
+        else if ( includesChaperoneGeometry )
         {
-            for ( int j = 0; j < 4; ++j )
-            {
-                o.addValue( static_cast<double>( standingCenter.m[i][j] ) );
-            }
+            o.addValue( utils::encodeChaperoneGeometry(
+                { chaperoneGeometryQuads,
+                  standingCenter,
+                  playSpaceAreaX,
+                  playSpaceAreaZ } ) );
+        }
+        else
+        {
+            o.addValue( std::string() );
         }
-
-        o.addValue( static_cast<double>( playSpaceAreaX ) );
-        o.addValue( static_cast<double>( playSpaceAreaZ ) );
 
         o.addValue( includesVisibility );
         o.addValue( static_cast<double>( visibility ) );
@@ -149,17 +154,21 @@ struct ChaperoneProfile : settings::ISettingsObject
         chaperoneGeometryQuadCount
             = static_cast<unsigned>( obj.getNextValueOrDefault( 0 ) );
 
-        // chaperoneGeometryQuads = nullptr;
-        const auto chaperoneGeometryQuadsValid
-            = obj.getNextValueOrDefault( false );
-        if ( chaperoneGeometryQuadsValid )
+        chaperoneGeometryQuads.clear();
+
+        if ( obj.hasValuesOfType<std::string>() )
         {
-            for ( int i = 0; i < static_cast<int>( chaperoneGeometryQuadCount );
-                  ++i )
-            {
-                chaperoneGeometryQuads.emplace_back();
-            }
+            chaperoneGeometryBlob = obj.getNextValueOrDefault( "" );
+            chaperoneGeometryLoaded = chaperoneGeometryBlob.empty();
+        }
+        else
+        {
+            // Legacy format, every coordinate is a separate double.
+            // It is converted to the compact format on the next save.
+            chaperoneGeometryBlob.clear();
+            chaperoneGeometryLoaded = true;
 
+            chaperoneGeometryQuads.resize( chaperoneGeometryQuadCount );
             for ( auto& arrayMember : chaperoneGeometryQuads )
             {
                 for ( auto& corner : arrayMember.vCorners )
@@ -171,19 +180,21 @@ struct ChaperoneProfile : settings::ISettingsObject
                     }
                 }
             }
-        }
 
-        for ( int i = 0; i < 3; ++i )
-        {
-            for ( int j = 0; j < 4; ++j )
+            for ( int i = 0; i < 3; ++i )
             {
-                standingCenter.m[i][j]
-                    = static_cast<float>( obj.getNextValueOrDefault( 0.0 ) );
+                for ( int j = 0; j < 4; ++j )
+                {
+                    standingCenter.m[i][j] = static_cast<float>(
+                        obj.getNextValueOrDefault( 0.0 ) );
+                }
             }
-        }
 
-        playSpaceAreaX = static_cast<float>( obj.getNextValueOrDefault( 0.0 ) );
-        playSpaceAreaZ = static_cast<float>( obj.getNextValueOrDefault( 0.0 ) );
+            playSpaceAreaX
+                = static_cast<float>( obj.getNextValueOrDefault( 0.0 ) );
+            playSpaceAreaZ
+                = static_cast<float>( obj.getNextValueOrDefault( 0.0 ) );
+        }
 
         includesVisibility = obj.getNextValueOrDefault( false );
         visibility = static_cast<float>( obj.getNextValueOrDefault( 0.6 ) );
@@ -234,6 +245,36 @@ struct ChaperoneProfile : settings::ISettingsObject
     {
         return "ChaperoneTabController::ChaperoneProfile";
     }
+
+    /*!
+       \brief Decodes the stored geometry blob if that hasn't happened yet.
+       \return false if the blob could not be decoded.
+     */
+    bool loadChaperoneGeometry()
+    {
+        if ( chaperoneGeometryLoaded )
+        {
+            return true;
+        }
+
+        auto geometry = utils::decodeChaperoneGeometry( chaperoneGeometryBlob );
+        if ( !geometry.has_value() )
+        {
+            return false;
+        }
+
+        chaperoneGeometryQuads = std::move( geometry->quads );
+        chaperoneGeometryQuadCount
+            = static_cast<unsigned>( chaperoneGeometryQuads.size() );
+        standingCenter = geometry->standingCenter;
+        playSpaceAreaX = geometry->playSpaceAreaX;
+        playSpaceAreaZ = geometry->playSpaceAreaZ;
+
+        chaperoneGeometryBlob.clear();
+        chaperoneGeometryLoaded = true;
+
+        return true;
+    }
 };
 
 class ChaperoneTabController : public QObject
@@ -296,6 +337,8 @@ class ChaperoneTabController : public QObject
         float chaperoneShowDashboardDistance READ chaperoneShowDashboardDistance
             WRITE setChaperoneShowDashboardDistance NOTIFY
                 chaperoneShowDashboardDistanceChanged )
+    Q_PROPERTY( QAbstractItemModel* chaperoneProfilesModel READ
+                    chaperoneProfilesModel CONSTANT )
 
 private:
     OverlayController* parent;
@@ -309,16 +352,32 @@ class ChaperoneTabController : public QObject
 
     bool m_chaperoneSwitchToBeginnerActive = false;
     int32_t m_chaperoneSwitchToBeginnerLastStyle = 0;
+    // Sets the style saved when switching to beginner.
+    bool restoreChaperoneStyle();
 
     bool m_chaperoneHapticFeedbackActive = false;
-    std::thread m_chaperoneHapticFeedbackThread;
+    utils::HapticScheduler m_hapticScheduler{
+        []( vr::VRActionHandle_t action,
+            float durationSeconds,
+            float frequency,
+            float amplitude,
+            vr::VRInputValueHandle_t input ) {
+            vr::VRInput()->TriggerHapticVibrationAction(
+                action, 0.0f, durationSeconds, frequency, amplitude, input );
+        }
+    };
 
     bool m_chaperoneAlarmSoundActive = false;
 
     bool m_chaperoneShowDashboardActive = false;
 
-    unsigned settingsUpdateCounter = 0;
-    void updateChaperoneSettings();
+    std::vector<settings::SubscriptionId> m_settingSubscriptions;
+    void subscribeToSettings();
+
+    bool isLiveChaperoneGeometry( const ChaperoneProfile& profile );
+    // Bool and int32_t keys of the collision bounds section.
+    template <typename Value>
+    bool liveCollisionBoundsEquals( const char* key, Value value );
 
     bool m_isHapticGood = true;
     bool m_isHMDActive = false;
@@ -329,16 +388,7 @@ class ChaperoneTabController : public QObject
 
     bool m_autosaveComplete = false;
 
-    int m_updateTicksChaperoneReload = 0;
-
-    unsigned int m_chaperoneSettingsUpdateCounter = 101;
-
-    vr::VRActionHandle_t m_rightActionHandle;
-    vr::VRActionHandle_t m_leftActionHandle;
-    vr::VRInputValueHandle_t m_leftInputHandle;
-    vr::VRInputValueHandle_t m_rightInputHandle;
-
-    std::vector<ChaperoneProfile> chaperoneProfiles;
+    settings::ProfileStore<ChaperoneProfile> chaperoneProfiles;
 
 public:
     ~ChaperoneTabController();
@@ -348,6 +398,7 @@ class ChaperoneTabController : public QObject
 
     void eventLoopTick( vr::TrackedDevicePose_t* devicePoses );
     void handleChaperoneWarnings( float distance );
+    void chaperoneDataReloaded();
 
     float boundsVisibility() const;
     float fadeDistance() const;
@@ -381,6 +432,7 @@ class ChaperoneTabController : public QObject
     void reloadChaperoneProfiles();
     void saveChaperoneProfiles();
 
+    QAbstractItemModel* chaperoneProfilesModel();
     Q_INVOKABLE unsigned getChaperoneProfileCount();
     Q_INVOKABLE QString getChaperoneProfileName( unsigned index );
 
@@ -400,22 +452,21 @@ public slots:
     void setCenterMarker( bool value, bool notify = true );
     void setPlaySpaceMarker( bool value, bool notify = true );
     void setForceBounds( bool value, bool notify = true );
-    void setDisableChaperone( bool value, bool notify = true );
+    void setDisableChaperone( bool value );
 
-    void setChaperoneSwitchToBeginnerEnabled( bool value, bool notify = true );
-    void setChaperoneSwitchToBeginnerDistance( float value,
-                                               bool notify = true );
+    void setChaperoneSwitchToBeginnerEnabled( bool value );
+    void setChaperoneSwitchToBeginnerDistance( float value );
 
-    void setChaperoneHapticFeedbackEnabled( bool value, bool notify = true );
-    void setChaperoneHapticFeedbackDistance( float value, bool notify = true );
+    void setChaperoneHapticFeedbackEnabled( bool value );
+    void setChaperoneHapticFeedbackDistance( float value );
 
-    void setChaperoneAlarmSoundEnabled( bool value, bool notify = true );
-    void setChaperoneAlarmSoundLooping( bool value, bool notify = true );
-    void setChaperoneAlarmSoundAdjustVolume( bool value, bool notify = true );
-    void setChaperoneAlarmSoundDistance( float value, bool notify = true );
+    void setChaperoneAlarmSoundEnabled( bool value );
+    void setChaperoneAlarmSoundLooping( bool value );
+    void setChaperoneAlarmSoundAdjustVolume( bool value );
+    void setChaperoneAlarmSoundDistance( float value );
 
-    void setChaperoneShowDashboardEnabled( bool value, bool notify = true );
-    void setChaperoneShowDashboardDistance( float value, bool notify = true );
+    void setChaperoneShowDashboardEnabled( bool value );
+    void setChaperoneShowDashboardDistance( float value );
 
     void flipOrientation( double degrees = 180 );
     void reloadFromDisk();
@@ -54,12 +54,17 @@ void MoveCenterTabController::initStage2( OverlayController* var_parent )
 
 void MoveCenterTabController::reloadOffsetProfiles()
 {
-    settings::loadAllObjects( m_offsetProfiles );
+    m_offsetProfiles.load();
 }
 
 void MoveCenterTabController::saveOffsetProfiles()
 {
-    settings::saveAllObjects( m_offsetProfiles );
+    m_offsetProfiles.save();
+}
+
+QAbstractItemModel* MoveCenterTabController::offsetProfilesModel()
+{
+    return &m_offsetProfiles.model();
 }
 
 Q_INVOKABLE unsigned MoveCenterTabController::getOffsetProfileCount()
@@ -76,32 +81,19 @@ Q_INVOKABLE QString
     }
     else
     {
-        return QString::fromStdString( m_offsetProfiles[index].profileName );
+        return QString::fromStdString( m_offsetProfiles.name( index ) );
     }
 }
 
 void MoveCenterTabController::addOffsetProfile( QString name )
 {
-    OffsetProfile* profile = nullptr;
-    for ( auto& p : m_offsetProfiles )
-    {
-        if ( p.profileName.compare( name.toStdString() ) == 0 )
-        {
-            profile = &p;
-            break;
-        }
-    }
-    if ( !profile )
-    {
-        auto i = m_offsetProfiles.size();
-        m_offsetProfiles.emplace_back();
-        profile = &m_offsetProfiles[i];
-    }
-    profile->profileName = name.toStdString();
-    profile->offsetX = m_offsetX;
-    profile->offsetY = m_offsetY;
-    profile->offsetZ = m_offsetZ;
-    profile->rotation = m_rotation;
+    OffsetProfile profile;
+    profile.profileName = name.toStdString();
+    profile.offsetX = m_offsetX;
+    profile.offsetY = m_offsetY;
+    profile.offsetZ = m_offsetZ;
+    profile.rotation = m_rotation;
+    m_offsetProfiles.put( std::move( profile ) );
     saveOffsetProfiles();
     emit offsetProfilesUpdated();
 }
@@ -110,7 +102,7 @@ void MoveCenterTabController::applyOffsetProfile( unsigned index )
 {
     if ( index < m_offsetProfiles.size() )
     {
-        auto& profile = m_offsetProfiles[index];
+        const auto& profile = m_offsetProfiles.at( index );
         m_rotation = profile.rotation;
         m_offsetX = profile.offsetX;
         m_offsetY = profile.offsetY;
@@ -130,8 +122,7 @@ void MoveCenterTabController::deleteOffsetProfile( unsigned index )
 {
     if ( index < m_offsetProfiles.size() )
     {
-        auto pos = m_offsetProfiles.begin() + index;
-        m_offsetProfiles.erase( pos );
+        m_offsetProfiles.remove( index );
         saveOffsetProfiles();
         emit offsetProfilesUpdated();
     }
@@ -1211,12 +1202,28 @@ void MoveCenterTabController::updateSeatedResetData()
     m_pendingSeatedRecenter = true;
 }
 
+void MoveCenterTabController::chaperoneDataReloaded()
+{
+    // Same condition as the reload on motion start: only pick up external
+    // edits while no offsets are applied, otherwise our own offset commits
+    // would become the new basis.
+    if ( m_chaperoneBasisAcquired && !m_roomSetupModeDetected
+         && !m_pendingZeroOffsets && m_chaperoneCommitted
+         && allowExternalEdits() && m_oldOffsetX == 0.0f
+         && m_oldOffsetY == 0.0f && m_oldOffsetZ == 0.0f && m_oldRotation == 0 )
+    {
+        updateChaperoneResetData();
+    }
+}
+
 void MoveCenterTabController::updateChaperoneResetData()
 {
     vr::VRChaperoneSetup()->RevertWorkingCopy();
     unsigned currentQuadCount = 0;
     vr::VRChaperoneSetup()->GetWorkingCollisionBoundsInfo( nullptr,
                                                            &currentQuadCount );
+    delete[] m_collisionBoundsForReset;
+    delete[] m_collisionBoundsForOffset;
     m_collisionBoundsForReset = new vr::HmdQuad_t[currentQuadCount];
     m_collisionBoundsForOffset = new vr::HmdQuad_t[currentQuadCount];
     m_collisionBoundsCountForReset = currentQuadCount;
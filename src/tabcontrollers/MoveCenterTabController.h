@@ -7,6 +7,7 @@
 #include <qmath.h>
 #include "../utils/FrameRateUtils.h"
 #include "../settings/settings_object.h"
+#include "../settings/profile_store.h"
 
 class QQuickWindow;
 // application namespace
@@ -52,6 +53,8 @@ struct OffsetProfile : settings::ISettingsObject
 
         o.addValue( rotation );
 
+        o.addValue( profileName );
+
         return o;
     }
 
@@ -62,6 +65,8 @@ struct OffsetProfile : settings::ISettingsObject
         offsetZ = static_cast<float>( obj.getNextValueOrDefault( 0.0 ) );
 
         rotation = obj.getNextValueOrDefault( 0 );
+
+        profileName = obj.getNextValueOrDefault( "" );
     }
 };
 
@@ -136,6 +141,8 @@ class MoveCenterTabController : public QObject
                     setEnableSeatedMotion NOTIFY enableSeatedMotionChanged )
     Q_PROPERTY( bool simpleRecenter READ simpleRecenter WRITE setSimpleRecenter
                     NOTIFY simpleRecenterChanged )
+    Q_PROPERTY( QAbstractItemModel* offsetProfilesModel READ offsetProfilesModel
+                    CONSTANT )
 
 private:
     OverlayController* parent;
@@ -206,7 +213,7 @@ class MoveCenterTabController : public QObject
     double m_velocity[3] = { 0.0, 0.0, 0.0 };
     std::chrono::steady_clock::time_point m_lastGravityUpdateTimePoint;
     std::chrono::steady_clock::time_point m_lastDragUpdateTimePoint;
-    vr::HmdQuad_t* m_collisionBoundsForReset;
+    vr::HmdQuad_t* m_collisionBoundsForReset = nullptr;
     uint32_t m_collisionBoundsCountForReset = 0;
     vr::HmdMatrix34_t m_universeCenterForReset
         = { { { 1.0f, 0.0f, 0.0f, 0.0f },
@@ -216,7 +223,7 @@ class MoveCenterTabController : public QObject
         = { { { 1.0f, 0.0f, 0.0f, 0.0f },
               { 0.0f, 1.0f, 0.0f, 0.0f },
               { 0.0f, 0.0f, 1.0f, 0.0f } } };
-    vr::HmdQuad_t* m_collisionBoundsForOffset;
+    vr::HmdQuad_t* m_collisionBoundsForOffset = nullptr;
     void updateCollisionBoundsForOffset();
 
     void updateHmdRotationCounter( vr::TrackedDevicePose_t hmdPose,
@@ -231,7 +238,7 @@ class MoveCenterTabController : public QObject
     void saveUncommittedChaperone();
     void outputLogHmdMatrix( vr::HmdMatrix34_t hmdMatrix );
 
-    std::vector<OffsetProfile> m_offsetProfiles;
+    settings::ProfileStore<OffsetProfile> m_offsetProfiles;
 
 public:
     void initStage1();
@@ -276,11 +283,13 @@ class MoveCenterTabController : public QObject
     double getHmdYawTotal();
     void resetHmdYawTotal();
     void incomingSeatedReset();
+    void chaperoneDataReloaded();
     void setBoundsBasisHeight( float newHeight );
     float getBoundsBasisMaxY();
 
     void reloadOffsetProfiles();
     void saveOffsetProfiles();
+    QAbstractItemModel* offsetProfilesModel();
     Q_INVOKABLE unsigned getOffsetProfileCount();
     Q_INVOKABLE QString getOffsetProfileName( unsigned index );
 
@@ -5,163 +5,38 @@
 // application namespace
 namespace advsettings
 {
-void SteamVRTabController::initStage1()
-{
-    m_steamVrSettingsUpdateCounter
-        = utils::adjustUpdateRate( k_steamVrSettingsUpdateCounter );
-    dashboardLoopTick();
-}
-
 void SteamVRTabController::initStage2( OverlayController* var_parent )
 {
     this->parent = var_parent;
-}
-
-void SteamVRTabController::dashboardLoopTick()
-{
-    if ( settingsUpdateCounter >= m_steamVrSettingsUpdateCounter )
-    {
-        vr::EVRSettingsError vrSettingsError;
-
-        // Checks and synchs performance graph
-        auto pg = vr::VRSettings()->GetBool( vr::k_pch_Perf_Section,
-                                             vr::k_pch_Perf_PerfGraphInHMD_Bool,
-                                             &vrSettingsError );
-        if ( vrSettingsError != vr::VRSettingsError_None )
-        {
-            LOG( WARNING ) << "Could not read \""
-                           << vr::k_pch_Perf_PerfGraphInHMD_Bool
-                           << "\" setting: "
-                           << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                                  vrSettingsError );
-        }
-        setPerformanceGraph( pg );
-
-        // synch systembutton
-        auto sb = vr::VRSettings()->GetBool(
-            vr::k_pch_SteamVR_Section,
-            vr::k_pch_SteamVR_SendSystemButtonToAllApps_Bool,
-            &vrSettingsError );
-        if ( vrSettingsError != vr::VRSettingsError_None )
-        {
-            LOG( WARNING ) << "Could not read \""
-                           << vr::k_pch_SteamVR_SendSystemButtonToAllApps_Bool
-                           << "\" setting: "
-                           << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                                  vrSettingsError );
-        }
-        setSystemButton( sb );
 
-        // synch nofadetogrid
-        auto nf = vr::VRSettings()->GetBool( vr::k_pch_SteamVR_Section,
-                                             vr::k_pch_SteamVR_DoNotFadeToGrid,
-                                             &vrSettingsError );
-        if ( vrSettingsError != vr::VRSettingsError_None )
-        {
-            LOG( WARNING ) << "Could not read \""
-                           << vr::k_pch_SteamVR_DoNotFadeToGrid
-                           << "\" setting: "
-                           << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                                  vrSettingsError );
-        }
-        setNoFadeToGrid( nf );
-
-        // synch multipleDriver
-        auto md = vr::VRSettings()->GetBool(
-            vr::k_pch_SteamVR_Section,
-            vr::k_pch_SteamVR_ActivateMultipleDrivers_Bool,
-            &vrSettingsError );
-        if ( vrSettingsError != vr::VRSettingsError_None )
-        {
-            LOG( WARNING ) << "Could not read \""
-                           << vr::k_pch_SteamVR_ActivateMultipleDrivers_Bool
-                           << "\" setting: "
-                           << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                                  vrSettingsError );
-        }
-        setMultipleDriver( md );
-
-        // synch dnd
-        auto donotd = vr::VRSettings()->GetBool(
-            vr::k_pch_Notifications_Section,
-            vr::k_pch_Notifications_DoNotDisturb_Bool,
-            &vrSettingsError );
-        if ( vrSettingsError != vr::VRSettingsError_None )
-        {
-            LOG( WARNING ) << "Could not read \""
-                           << vr::k_pch_Notifications_DoNotDisturb_Bool
-                           << "\" setting: "
-                           << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                                  vrSettingsError );
-        }
-        setDND( donotd );
-
-        // synch camera
-        auto ca = vr::VRSettings()->GetBool( vr::k_pch_Camera_Section,
-                                             vr::k_pch_Camera_EnableCamera_Bool,
-                                             &vrSettingsError );
-        if ( vrSettingsError != vr::VRSettingsError_None )
-        {
-            LOG( WARNING ) << "Could not read \""
-                           << vr::k_pch_Camera_EnableCamera_Bool
-                           << "\" setting: "
-                           << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                                  vrSettingsError );
-        }
-        setCameraActive( ca );
-
-        // synch camera room
-        auto cr = vr::VRSettings()->GetBool(
-            vr::k_pch_Camera_Section,
-            vr::k_pch_Camera_EnableCameraForRoomView_Bool,
-            &vrSettingsError );
-        if ( vrSettingsError != vr::VRSettingsError_None )
-        {
-            LOG( WARNING ) << "Could not read \""
-                           << vr::k_pch_Camera_EnableCameraForRoomView_Bool
-                           << "\" setting: "
-                           << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                                  vrSettingsError );
-        }
-        setCameraRoom( cr );
-
-        // synch camera dashboard
-        auto cd = vr::VRSettings()->GetBool(
-            vr::k_pch_Camera_Section,
-            vr::k_pch_Camera_EnableCameraInDashboard_Bool,
-            &vrSettingsError );
-        if ( vrSettingsError != vr::VRSettingsError_None )
-        {
-            LOG( WARNING ) << "Could not read \""
-                           << vr::k_pch_Camera_EnableCameraInDashboard_Bool
-                           << "\" setting: "
-                           << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                                  vrSettingsError );
-        }
-        setCameraDashboard( cd );
-
-        // synch camera bounds
-        auto cb = vr::VRSettings()->GetBool(
-            vr::k_pch_Camera_Section,
-            vr::k_pch_Camera_EnableCameraForCollisionBounds_Bool,
-            &vrSettingsError );
-        if ( vrSettingsError != vr::VRSettingsError_None )
-        {
-            LOG( WARNING )
-                << "Could not read \""
-                << vr::k_pch_Camera_EnableCameraForCollisionBounds_Bool
-                << "\" setting: "
-                << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                       vrSettingsError );
-        }
-        setCameraBounds( cb );
-
-        settingsUpdateCounter = 0;
-    }
-    else
-    {
-        settingsUpdateCounter++;
-    }
+    auto& cache = parent->vrSettingsCache();
+    cache.watchBool( vr::k_pch_Perf_Section,
+                     vr::k_pch_Perf_PerfGraphInHMD_Bool,
+                     [this]( bool value ) { setPerformanceGraph( value ); } );
+    cache.watchBool( vr::k_pch_SteamVR_Section,
+                     vr::k_pch_SteamVR_SendSystemButtonToAllApps_Bool,
+                     [this]( bool value ) { setSystemButton( value ); } );
+    cache.watchBool( vr::k_pch_SteamVR_Section,
+                     vr::k_pch_SteamVR_DoNotFadeToGrid,
+                     [this]( bool value ) { setNoFadeToGrid( value ); } );
+    cache.watchBool( vr::k_pch_SteamVR_Section,
+                     vr::k_pch_SteamVR_ActivateMultipleDrivers_Bool,
+                     [this]( bool value ) { setMultipleDriver( value ); } );
+    cache.watchBool( vr::k_pch_Notifications_Section,
+                     vr::k_pch_Notifications_DoNotDisturb_Bool,
+                     [this]( bool value ) { setDND( value ); } );
+    cache.watchBool( vr::k_pch_Camera_Section,
+                     vr::k_pch_Camera_EnableCamera_Bool,
+                     [this]( bool value ) { setCameraActive( value ); } );
+    cache.watchBool( vr::k_pch_Camera_Section,
+                     vr::k_pch_Camera_EnableCameraForRoomView_Bool,
+                     [this]( bool value ) { setCameraRoom( value ); } );
+    cache.watchBool( vr::k_pch_Camera_Section,
+                     vr::k_pch_Camera_EnableCameraInDashboard_Bool,
+                     [this]( bool value ) { setCameraDashboard( value ); } );
+    cache.watchBool( vr::k_pch_Camera_Section,
+                     vr::k_pch_Camera_EnableCameraForCollisionBounds_Bool,
+                     [this]( bool value ) { setCameraBounds( value ); } );
 }
 
 bool SteamVRTabController::performanceGraph() const
@@ -175,9 +50,9 @@ void SteamVRTabController::setPerformanceGraph( const bool value,
     if ( m_performanceGraphToggle != value )
     {
         m_performanceGraphToggle = value;
-        vr::VRSettings()->SetBool( vr::k_pch_Perf_Section,
-                                   vr::k_pch_Perf_PerfGraphInHMD_Bool,
-                                   m_performanceGraphToggle );
+        parent->vrSettingsCache().set( vr::k_pch_Perf_Section,
+                                       vr::k_pch_Perf_PerfGraphInHMD_Bool,
+                                       m_performanceGraphToggle );
         if ( notify )
         {
             emit performanceGraphChanged( m_performanceGraphToggle );
@@ -196,7 +71,7 @@ void SteamVRTabController::setMultipleDriver( const bool value,
     if ( m_multipleDriverToggle != value )
     {
         m_multipleDriverToggle = value;
-        vr::VRSettings()->SetBool(
+        parent->vrSettingsCache().set(
             vr::k_pch_SteamVR_Section,
             vr::k_pch_SteamVR_ActivateMultipleDrivers_Bool,
             m_multipleDriverToggle );
@@ -218,9 +93,9 @@ void SteamVRTabController::setNoFadeToGrid( const bool value,
     if ( m_noFadeToGridToggle != value )
     {
         m_noFadeToGridToggle = value;
-        vr::VRSettings()->SetBool( vr::k_pch_SteamVR_Section,
-                                   vr::k_pch_SteamVR_DoNotFadeToGrid,
-                                   m_noFadeToGridToggle );
+        parent->vrSettingsCache().set( vr::k_pch_SteamVR_Section,
+                                       vr::k_pch_SteamVR_DoNotFadeToGrid,
+                                       m_noFadeToGridToggle );
         if ( notify )
         {
             emit noFadeToGridChanged( m_noFadeToGridToggle );
@@ -239,7 +114,7 @@ void SteamVRTabController::setSystemButton( const bool value,
     if ( m_systemButtonToggle != value )
     {
         m_systemButtonToggle = value;
-        vr::VRSettings()->SetBool(
+        parent->vrSettingsCache().set(
             vr::k_pch_SteamVR_Section,
             vr::k_pch_SteamVR_SendSystemButtonToAllApps_Bool,
             m_systemButtonToggle );
@@ -260,9 +135,10 @@ void SteamVRTabController::setDND( const bool value, const bool notify )
     if ( m_dnd != value )
     {
         m_dnd = value;
-        vr::VRSettings()->SetBool( vr::k_pch_Notifications_Section,
-                                   vr::k_pch_Notifications_DoNotDisturb_Bool,
-                                   m_dnd );
+        parent->vrSettingsCache().set(
+            vr::k_pch_Notifications_Section,
+            vr::k_pch_Notifications_DoNotDisturb_Bool,
+            m_dnd );
         if ( notify )
         {
             emit dNDChanged( m_dnd );
@@ -284,9 +160,9 @@ void SteamVRTabController::setCameraActive( const bool value,
     if ( m_cameraActive != value )
     {
         m_cameraActive = value;
-        vr::VRSettings()->SetBool( vr::k_pch_Camera_Section,
-                                   vr::k_pch_Camera_EnableCamera_Bool,
-                                   m_cameraActive );
+        parent->vrSettingsCache().set( vr::k_pch_Camera_Section,
+                                       vr::k_pch_Camera_EnableCamera_Bool,
+                                       m_cameraActive );
         if ( notify )
         {
             emit cameraActiveChanged( m_cameraActive );
@@ -305,7 +181,7 @@ void SteamVRTabController::setCameraBounds( const bool value,
     if ( m_cameraBounds != value )
     {
         m_cameraBounds = value;
-        vr::VRSettings()->SetBool(
+        parent->vrSettingsCache().set(
             vr::k_pch_Camera_Section,
             vr::k_pch_Camera_EnableCameraForCollisionBounds_Bool,
             m_cameraBounds );
@@ -326,7 +202,7 @@ void SteamVRTabController::setCameraRoom( const bool value, const bool notify )
     if ( m_cameraRoom != value )
     {
         m_cameraRoom = value;
-        vr::VRSettings()->SetBool(
+        parent->vrSettingsCache().set(
             vr::k_pch_Camera_Section,
             vr::k_pch_Camera_EnableCameraForRoomView_Bool,
             m_cameraRoom );
@@ -368,7 +244,7 @@ void SteamVRTabController::setCameraDashboard( const bool value,
     if ( m_cameraDashboard != value )
     {
         m_cameraDashboard = value;
-        vr::VRSettings()->SetBool(
+        parent->vrSettingsCache().set(
             vr::k_pch_Camera_Section,
             vr::k_pch_Camera_EnableCameraInDashboard_Bool,
             m_cameraDashboard );
@@ -2,7 +2,6 @@
 #pragma once
 
 #include <QObject>
-#include "../utils/FrameRateUtils.h"
 
 class QQuickWindow;
 // application namespace
@@ -49,17 +48,9 @@ class SteamVRTabController : public QObject
     bool m_cameraRoom = false;
     bool m_cameraDashboard = false;
 
-    unsigned settingsUpdateCounter = 0;
-
-    unsigned int m_steamVrSettingsUpdateCounter = 97;
-
 public:
-    void initStage1();
     void initStage2( OverlayController* parent );
 
-    void eventLoopTick();
-    void dashboardLoopTick();
-
     bool performanceGraph() const;
     bool noFadeToGrid() const;
     bool multipleDriver() const;
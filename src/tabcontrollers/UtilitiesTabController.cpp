@@ -2,14 +2,24 @@
 #include <QQuickWindow>
 #include <QApplication>
 #include "../overlaycontroller.h"
-#include "../keyboard_input/input_sender.h"
 #include "../settings/settings.h"
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
 // application namespace
 namespace advsettings
 {
+namespace
+{
+constexpr std::chrono::minutes k_alarmSnooze{ 15 };
+// The scheduler follows the steady clock, which doesn't know about
+// suspends or changes of the wall clock. Waiting in steps of this length
+// keeps the alarm at most this late.
+constexpr std::chrono::minutes k_alarmRecheck{ 1 };
+
+} // namespace
+
 void UtilitiesTabController::initStage1()
 {
     auto qAlarmHour
@@ -19,13 +29,79 @@ void UtilitiesTabController::initStage1()
 
     m_alarmTime = QTime( qAlarmHour, qAlarmMinute );
 
+    // The alarm also follows changes from the settings file and imports.
+    m_settingSubscriptions.push_back( settings::subscribe(
+        settings::BoolSetting::UTILITY_alarmEnabled, [this]( bool enabled ) {
+            scheduleAlarm();
+            emit alarmEnabledChanged( enabled );
+        } ) );
+    m_settingSubscriptions.push_back( settings::subscribe(
+        settings::BoolSetting::UTILITY_alarmIsModal,
+        [this]( bool modal ) { emit alarmIsModalChanged( modal ); } ) );
+    // Our own setters update m_alarmTime first, so only other writers get
+    // past the comparisons.
+    m_settingSubscriptions.push_back( settings::subscribe(
+        settings::IntSetting::UTILITY_alarmHour, [this]( int hour ) {
+            if ( hour != m_alarmTime.hour() )
+            {
+                m_alarmTime = QTime( hour, m_alarmTime.minute() );
+                scheduleAlarm();
+                emit alarmTimeHourChanged( hour );
+            }
+        } ) );
+    m_settingSubscriptions.push_back( settings::subscribe(
+        settings::IntSetting::UTILITY_alarmMinute, [this]( int minute ) {
+            if ( minute != m_alarmTime.minute() )
+            {
+                m_alarmTime = QTime( m_alarmTime.hour(), minute );
+                scheduleAlarm();
+                emit alarmTimeMinuteChanged( minute );
+            }
+        } ) );
+
     m_utilitiesSettingsUpdateCounter
         = utils::adjustUpdateRate( k_utilitiesSettingsUpdateCounter );
+
+    // Shortcuts are compiled here and when they change, not on every press.
+    const std::array<settings::StringSetting, 3> shortcutSettings{
+        settings::StringSetting::KEYBOARDSHORTCUT_keyboardOne,
+        settings::StringSetting::KEYBOARDSHORTCUT_keyboardTwo,
+        settings::StringSetting::KEYBOARDSHORTCUT_keyboardThree,
+    };
+    for ( std::size_t i = 0; i < shortcutSettings.size(); ++i )
+    {
+        m_keyboardShortcuts[i]
+            = compileShortcut( settings::getSetting( shortcutSettings[i] ) );
+        m_settingSubscriptions.push_back( settings::subscribe(
+            shortcutSettings[i], [this, i]( const std::string& shortcut ) {
+                m_keyboardShortcuts[i] = compileShortcut( shortcut );
+            } ) );
+    }
+
+    const auto mediaApplication
+        = settings::StringSetting::UTILITY_mediaApplication;
+    keyboardinput::setPreferredMediaApplication(
+        QString::fromStdString( settings::getSetting( mediaApplication ) ) );
+    m_settingSubscriptions.push_back( settings::subscribe(
+        mediaApplication,
+        []( const std::string& application ) {
+            keyboardinput::setPreferredMediaApplication(
+                QString::fromStdString( application ) );
+        } ) );
+}
+
+UtilitiesTabController::~UtilitiesTabController()
+{
+    for ( const auto id : m_settingSubscriptions )
+    {
+        settings::unsubscribe( id );
+    }
 }
 
 void UtilitiesTabController::initStage2( OverlayController* var_parent )
 {
     this->m_parent = var_parent;
+    scheduleAlarm();
 }
 
 void UtilitiesTabController::sendKeyboardInput( QString input )
@@ -113,56 +189,6 @@ void UtilitiesTabController::sendKeyboardRShiftTilde0()
     keyboardinput::sendKeyboardRShiftTilde0();
 }
 
-void UtilitiesTabController::sendKeyboardRShiftTilde1Delayed()
-{
-    keyboardinput::sendKeyboardRShiftTilde1Delayed();
-}
-
-void UtilitiesTabController::sendKeyboardRShiftTilde2Delayed()
-{
-    keyboardinput::sendKeyboardRShiftTilde2Delayed();
-}
-
-void UtilitiesTabController::sendKeyboardRShiftTilde3Delayed()
-{
-    keyboardinput::sendKeyboardRShiftTilde3Delayed();
-}
-
-void UtilitiesTabController::sendKeyboardRShiftTilde4Delayed()
-{
-    keyboardinput::sendKeyboardRShiftTilde4Delayed();
-}
-
-void UtilitiesTabController::sendKeyboardRShiftTilde5Delayed()
-{
-    keyboardinput::sendKeyboardRShiftTilde5Delayed();
-}
-
-void UtilitiesTabController::sendKeyboardRShiftTilde6Delayed()
-{
-    keyboardinput::sendKeyboardRShiftTilde6Delayed();
-}
-
-void UtilitiesTabController::sendKeyboardRShiftTilde7Delayed()
-{
-    keyboardinput::sendKeyboardRShiftTilde7Delayed();
-}
-
-void UtilitiesTabController::sendKeyboardRShiftTilde8Delayed()
-{
-    keyboardinput::sendKeyboardRShiftTilde8Delayed();
-}
-
-void UtilitiesTabController::sendKeyboardRShiftTilde9Delayed()
-{
-    keyboardinput::sendKeyboardRShiftTilde9Delayed();
-}
-
-void UtilitiesTabController::sendKeyboardRShiftTilde0Delayed()
-{
-    keyboardinput::sendKeyboardRShiftTilde0Delayed();
-}
-
 void UtilitiesTabController::sendMediaNextSong()
 {
     keyboardinput::sendMediaNextSong();
@@ -179,27 +205,26 @@ void UtilitiesTabController::sendMediaStopSong()
 {
     keyboardinput::sendMediaStopSong();
 }
+void UtilitiesTabController::pinMediaPlayer( QString player )
+{
+    keyboardinput::pinMediaPlayer( player );
+    // Remembered by application, the instance is gone after a restart.
+    settings::setSetting( settings::StringSetting::UTILITY_mediaApplication,
+                          keyboardinput::mediaApplicationName( player )
+                              .toStdString() );
+}
 
 void UtilitiesTabController::sendKeyboardOne()
 {
-    const auto commands = settings::getSetting(
-        settings::StringSetting::KEYBOARDSHORTCUT_keyboardOne );
-
-    sendStringAsInput( commands );
+    keyboardinput::sendKeyboardProgram( m_keyboardShortcuts[0] );
 }
 void UtilitiesTabController::sendKeyboardTwo()
 {
-    const auto commands = settings::getSetting(
-        settings::StringSetting::KEYBOARDSHORTCUT_keyboardTwo );
-
-    sendStringAsInput( commands );
+    keyboardinput::sendKeyboardProgram( m_keyboardShortcuts[1] );
 }
 void UtilitiesTabController::sendKeyboardThree()
 {
-    const auto commands = settings::getSetting(
-        settings::StringSetting::KEYBOARDSHORTCUT_keyboardThree );
-
-    sendStringAsInput( commands );
+    keyboardinput::sendKeyboardProgram( m_keyboardShortcuts[2] );
 }
 
 bool UtilitiesTabController::alarmEnabled() const
@@ -227,26 +252,20 @@ int UtilitiesTabController::alarmTimeMinute() const
     return m_alarmTime.minute();
 }
 
-void UtilitiesTabController::setAlarmEnabled( bool enabled, bool notify )
+QObject* UtilitiesTabController::nowPlaying() const
+{
+    return &keyboardinput::nowPlaying();
+}
+
+void UtilitiesTabController::setAlarmEnabled( bool enabled )
 {
     settings::setSetting( settings::BoolSetting::UTILITY_alarmEnabled,
                           enabled );
-
-    m_alarmLastCheckTime = QTime();
-
-    if ( notify )
-    {
-        emit alarmEnabledChanged( enabled );
-    }
 }
 
-void UtilitiesTabController::setAlarmIsModal( bool modal, bool notify )
+void UtilitiesTabController::setAlarmIsModal( bool modal )
 {
     settings::setSetting( settings::BoolSetting::UTILITY_alarmIsModal, modal );
-    if ( notify )
-    {
-        emit alarmIsModalChanged( modal );
-    }
 }
 
 void UtilitiesTabController::setVrcDebug( bool value, bool notify )
@@ -279,7 +298,7 @@ void UtilitiesTabController::setAlarmTimeHour( int hour, bool notify )
     settings::setSetting( settings::IntSetting::UTILITY_alarmMinute,
                           m_alarmTime.minute() );
 
-    m_alarmLastCheckTime = QTime();
+    scheduleAlarm();
 
     if ( notify )
     {
@@ -305,7 +324,7 @@ void UtilitiesTabController::setAlarmTimeMinute( int min, bool notify )
         settings::setSetting( settings::IntSetting::UTILITY_alarmMinute,
                               m_alarmTime.minute() );
 
-        m_alarmLastCheckTime = QTime();
+        scheduleAlarm();
         if ( notify )
         {
             emit alarmTimeMinuteChanged( min );
@@ -332,7 +351,7 @@ void UtilitiesTabController::modAlarmTimeHour( int value, bool notify )
 
     if ( h != m_alarmTime.hour() )
     {
-        m_alarmLastCheckTime = QTime();
+        scheduleAlarm();
         if ( notify )
         {
             emit alarmTimeHourChanged( m_alarmTime.hour() );
@@ -353,7 +372,7 @@ void UtilitiesTabController::modAlarmTimeMinute( int value, bool notify )
 
     if ( m != m_alarmTime.minute() || h != m_alarmTime.hour() )
     {
-        m_alarmLastCheckTime = QTime();
+        scheduleAlarm();
         if ( notify )
         {
             if ( h != m_alarmTime.hour() )
@@ -368,6 +387,196 @@ void UtilitiesTabController::modAlarmTimeMinute( int value, bool notify )
     }
 }
 
+void UtilitiesTabController::scheduleAlarm()
+{
+    if ( !m_parent )
+    {
+        return;
+    }
+    m_parent->scheduler().cancel( m_alarmTask );
+    m_alarmTask = 0;
+    if ( !alarmEnabled() || !m_alarmTime.isValid() )
+    {
+        return;
+    }
+
+    // The next time the clock shows the alarm time. Still today while the
+    // clock shows it, so an alarm set to the current minute goes off now.
+    const auto now = QDateTime::currentDateTime();
+    m_alarmDue = QDateTime( now.date(), m_alarmTime );
+    if ( m_alarmDue.addSecs( 60 ) <= now )
+    {
+        m_alarmDue = m_alarmDue.addDays( 1 );
+    }
+    armAlarm();
+}
+
+void UtilitiesTabController::armAlarm()
+{
+    const auto delay = std::clamp<qint64>(
+        QDateTime::currentDateTime().msecsTo( m_alarmDue ),
+        0,
+        std::chrono::milliseconds( k_alarmRecheck ).count() );
+    m_alarmTask = m_parent->scheduler().scheduleAfter(
+        std::chrono::milliseconds( delay ), [this, time = m_alarmTime] {
+            QMetaObject::invokeMethod(
+                this, [this, time] { alarmWentOff( time ); },
+                Qt::QueuedConnection );
+        } );
+}
+
+void UtilitiesTabController::alarmWentOff( const QTime& time )
+{
+    // Changed while the alarm was on its way, the new one is scheduled.
+    if ( !alarmEnabled() || time != m_alarmTime )
+    {
+        return;
+    }
+    if ( QDateTime::currentDateTime() < m_alarmDue )
+    {
+        armAlarm();
+        return;
+    }
+
+    setAlarmEnabled( false );
+    char alarmMessageBuffer[1024];
+    std::snprintf( alarmMessageBuffer,
+                   1024,
+                   "The alarm at %02i:%02i went off.",
+                   alarmTimeHour(),
+                   alarmTimeMinute() );
+    showAlarm( alarmMessageBuffer );
+}
+
+void UtilitiesTabController::showAlarm( const std::string& message )
+{
+    if ( alarmIsModal() )
+    {
+        // Waits for the user, on a thread of its own instead of the GUI
+        // thread or a worker.
+        m_parent->scheduler().postBlocking( [this, message] {
+            // Either closeAlarmMessage sees the message as open, or it was
+            // called before and the message isn't shown.
+            ++m_alarmMessagesOpen;
+            if ( m_alarmMessageClosing )
+            {
+                --m_alarmMessagesOpen;
+                return;
+            }
+            auto res = vr::VROverlay()->ShowMessageOverlay(
+                message.c_str(), "Alarm Clock", "Ok", "+15 min" );
+            --m_alarmMessagesOpen;
+            if ( res == vr::VRMessageOverlayResponse_ButtonPress_1 )
+            {
+                // Independent of the alarm time, which can be set again
+                // meanwhile.
+                m_parent->scheduler().scheduleAfter(
+                    k_alarmSnooze, [this, message] {
+                        QMetaObject::invokeMethod(
+                            this, [this, message] { showAlarm( message ); },
+                            Qt::QueuedConnection );
+                    } );
+            }
+            else if ( res >= vr::
+                          VRMessageOverlayResponse_CouldntFindSystemOverlay )
+            {
+                static const char* errorMessages[]
+                    = { "CouldntFindSystemOverlay",
+                        "CouldntFindOrCreateClientOverlay",
+                        "ApplicationQuit" };
+                int errorCode
+                    = res
+                      - vr::VRMessageOverlayResponse_CouldntFindSystemOverlay;
+                if ( errorCode < 3 )
+                {
+                    LOG( ERROR ) << "Could not create Alarm Overlay: "
+                                 << errorMessages[errorCode];
+                }
+                else
+                {
+                    LOG( ERROR ) << "Could not create Alarm "
+                                    "Overlay: Unknown Error";
+                }
+            }
+        } );
+    }
+    else
+    {
+        vr::VRNotificationId notificationId;
+        vr::EVRInitError eError;
+        vr::IVRNotifications* vrnotification
+            = static_cast<vr::IVRNotifications*>( vr::VR_GetGenericInterface(
+                vr::IVRNotifications_Version, &eError ) );
+        if ( eError != vr::VRInitError_None )
+        {
+            LOG( ERROR ) << "Error while getting IVRNotifications interface"
+                         << vr::VR_GetVRInitErrorAsEnglishDescription( eError );
+            vrnotification = nullptr;
+        }
+        else
+        {
+            vr::NotificationBitmap_t* messageIconPtr = nullptr;
+            /*
+            // Can i even create this object on the stack, who takes
+            ownership? vr::NotificationBitmap_t messageIcon;
+
+            // First get image width and height
+            vr::VROverlay()->GetOverlayImageData(parent->overlayThumbnailHandle(),
+            nullptr, 0, (uint32_t*)&messageIcon.m_nWidth,
+            (uint32_t*)&messageIcon.m_nHeight);
+
+            messageIcon.m_nBytesPerPixel = 4;
+            unsigned bufferSize =
+            messageIcon.m_nWidth*messageIcon.m_nHeight*messageIcon.m_nBytesPerPixel;
+
+            // Can I delete this buffer after this section? Who
+            takes ownership? std::unique_ptr<char> imageBuffer;
+            imageBuffer.reset(new char[bufferSize]);
+            messageIcon.m_pImageData = imageBuffer.get();
+
+            // Get image data
+            auto iconError =
+            vr::VROverlay()->GetOverlayImageData(parent->overlayThumbnailHandle(),
+            messageIcon.m_pImageData, bufferSize,
+            (uint32_t*)&messageIcon.m_nWidth,
+            (uint32_t*)&messageIcon.m_nHeight); if (iconError !=
+            vr::VROverlayError_None) { LOG(ERROR) << "Error while
+            getting message overlay icon: " <<
+            vr::VROverlay()->GetOverlayErrorNameFromEnum(iconError);
+            } else {
+                messageIconPtr = &messageIcon;
+            }
+            */
+            auto nError = vrnotification->CreateNotification(
+                m_parent->overlayHandle(),
+                666,
+                vr::EVRNotificationType_Transient,
+                message.c_str(),
+                vr::EVRNotificationStyle_Application,
+                messageIconPtr,
+                &notificationId );
+            if ( nError != vr::VRNotificationError_OK )
+            {
+                LOG( ERROR ) << "Error while creating notification: "
+                             << nError;
+                vrnotification = nullptr;
+            }
+        }
+    }
+}
+
+void UtilitiesTabController::closeAlarmMessage()
+{
+    m_alarmMessageClosing = true;
+    // Messages count as open before they are shown, a close may come too
+    // early and has to be repeated until every message returned.
+    while ( m_alarmMessagesOpen > 0 )
+    {
+        vr::VROverlay()->CloseMessageOverlay();
+        std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+    }
+}
+
 QString getBatteryIconPath( int batteryState )
 {
     constexpr auto batteryPrefix = "/res/img/battery/battery_";
@@ -431,136 +640,6 @@ void UtilitiesTabController::eventLoopTick()
 {
     if ( settingsUpdateCounter >= m_utilitiesSettingsUpdateCounter )
     {
-        if ( alarmEnabled() && m_alarmTime.isValid() )
-        {
-            auto now = QTime::currentTime();
-            if ( m_alarmLastCheckTime.isValid()
-                 && m_alarmLastCheckTime <= m_alarmTime && m_alarmTime <= now )
-            {
-                setAlarmEnabled( false );
-                char alarmMessageBuffer[1024];
-                std::snprintf( alarmMessageBuffer,
-                               1024,
-                               "The alarm at %02i:%02i went off.",
-                               alarmTimeHour(),
-                               alarmTimeMinute() );
-                if ( alarmIsModal() )
-                {
-                    std::thread messageThread(
-                        []( UtilitiesTabController* parent,
-                            std::string message ) {
-                            auto res = vr::VROverlay()->ShowMessageOverlay(
-                                message.c_str(),
-                                "Alarm Clock",
-                                "Ok",
-                                "+15 min" );
-                            if ( res
-                                 == vr::VRMessageOverlayResponse_ButtonPress_1 )
-                            {
-                                parent->setAlarmTimeToCurrentTime();
-                                parent->modAlarmTimeMinute( 15 );
-                                parent->setAlarmEnabled( true );
-                            }
-                            else if (
-                                res >= vr::
-                                    VRMessageOverlayResponse_CouldntFindSystemOverlay )
-                            {
-                                static const char* errorMessages[]
-                                    = { "CouldntFindSystemOverlay",
-                                        "CouldntFindOrCreateClientOverlay",
-                                        "ApplicationQuit" };
-                                int errorCode
-                                    = res
-                                      - vr::
-                                          VRMessageOverlayResponse_CouldntFindSystemOverlay;
-                                if ( res < 3 )
-                                {
-                                    LOG( ERROR )
-                                        << "Could not create Alarm Overlay: "
-                                        << errorMessages[errorCode];
-                                }
-                                else
-                                {
-                                    LOG( ERROR ) << "Could not create Alarm "
-                                                    "Overlay: Unknown Error";
-                                }
-                            }
-                        },
-                        this,
-                        std::string( alarmMessageBuffer ) );
-                    messageThread.detach();
-                }
-                else
-                {
-                    vr::VRNotificationId notificationId;
-                    vr::EVRInitError eError;
-                    vr::IVRNotifications* vrnotification
-                        = static_cast<vr::IVRNotifications*>(
-                            vr::VR_GetGenericInterface(
-                                vr::IVRNotifications_Version, &eError ) );
-                    if ( eError != vr::VRInitError_None )
-                    {
-                        LOG( ERROR )
-                            << "Error while getting IVRNotifications interface"
-                            << vr::VR_GetVRInitErrorAsEnglishDescription(
-                                   eError );
-                        vrnotification = nullptr;
-                    }
-                    else
-                    {
-                        vr::NotificationBitmap_t* messageIconPtr = nullptr;
-                        /*
-                        // Can i even create this object on the stack, who takes
-                        ownership? vr::NotificationBitmap_t messageIcon;
-
-                        // First get image width and height
-                        vr::VROverlay()->GetOverlayImageData(parent->overlayThumbnailHandle(),
-                        nullptr, 0, (uint32_t*)&messageIcon.m_nWidth,
-                        (uint32_t*)&messageIcon.m_nHeight);
-
-                        messageIcon.m_nBytesPerPixel = 4;
-                        unsigned bufferSize =
-                        messageIcon.m_nWidth*messageIcon.m_nHeight*messageIcon.m_nBytesPerPixel;
-
-                        // Can I delete this buffer after this section? Who
-                        takes ownership? std::unique_ptr<char> imageBuffer;
-                        imageBuffer.reset(new char[bufferSize]);
-                        messageIcon.m_pImageData = imageBuffer.get();
-
-                        // Get image data
-                        auto iconError =
-                        vr::VROverlay()->GetOverlayImageData(parent->overlayThumbnailHandle(),
-                        messageIcon.m_pImageData, bufferSize,
-                        (uint32_t*)&messageIcon.m_nWidth,
-                        (uint32_t*)&messageIcon.m_nHeight); if (iconError !=
-                        vr::VROverlayError_None) { LOG(ERROR) << "Error while
-                        getting message overlay icon: " <<
-                        vr::VROverlay()->GetOverlayErrorNameFromEnum(iconError);
-                        } else {
-                            messageIconPtr = &messageIcon;
-                        }
-                        */
-                        auto nError = vrnotification->CreateNotification(
-                            m_parent->overlayHandle(),
-                            666,
-                            vr::EVRNotificationType_Transient,
-                            alarmMessageBuffer,
-                            vr::EVRNotificationStyle_Application,
-                            messageIconPtr,
-                            &notificationId );
-                        if ( nError != vr::VRNotificationError_OK )
-                        {
-                            LOG( ERROR )
-                                << "Error while creating notification: "
-                                << nError;
-                            vrnotification = nullptr;
-                        }
-                    }
-                }
-            }
-            m_alarmLastCheckTime = now;
-        }
-
         // attach battery overlay to all tracked devices that aren't a
         // controller or hmd
         for ( vr::TrackedDeviceIndex_t i = 0; i < vr::k_unMaxTrackedDeviceCount;
@@ -1,13 +1,20 @@
 
 #pragma once
 
+#include <QDateTime>
 #include <QObject>
 #include <QTime>
 #include <openvr.h>
+#include <array>
+#include <atomic>
 #include <memory>
+#include <string>
+#include <vector>
 #include "src/keyboard_input/keyboard_input.h"
 #include "src/media_keys/media_keys.h"
 #include "../utils/FrameRateUtils.h"
+#include "../utils/TaskScheduler.h"
+#include "../settings/settings.h"
 
 class QQuickWindow;
 // application namespace
@@ -29,14 +36,19 @@ class UtilitiesTabController : public QObject
                     NOTIFY alarmTimeHourChanged )
     Q_PROPERTY( int alarmTimeMinute READ alarmTimeMinute WRITE
                     setAlarmTimeMinute NOTIFY alarmTimeMinuteChanged )
+    Q_PROPERTY( QObject* nowPlaying READ nowPlaying CONSTANT )
 
 private:
-    OverlayController* m_parent;
+    OverlayController* m_parent = nullptr;
 
     unsigned settingsUpdateCounter = 0;
 
     QTime m_alarmTime;
-    QTime m_alarmLastCheckTime;
+    QDateTime m_alarmDue;
+    utils::TaskScheduler::TaskId m_alarmTask = 0;
+    // Snoozes and the next alarm may show messages at the same time.
+    std::atomic<int> m_alarmMessagesOpen{ 0 };
+    std::atomic<bool> m_alarmMessageClosing{ false };
 
     vr::VROverlayHandle_t m_batteryOverlayHandles[vr::k_unMaxTrackedDeviceCount]
         = { 0 };
@@ -45,17 +57,34 @@ class UtilitiesTabController : public QObject
 
     unsigned int m_utilitiesSettingsUpdateCounter = 19;
 
+    std::array<ShortcutProgram, 3> m_keyboardShortcuts;
+    std::vector<settings::SubscriptionId> m_settingSubscriptions;
+
+    void scheduleAlarm();
+    void armAlarm();
+    void alarmWentOff( const QTime& time );
+    void showAlarm( const std::string& message );
+
 public:
+    ~UtilitiesTabController();
+
     void initStage1();
     void initStage2( OverlayController* var_parent );
 
     void eventLoopTick();
 
+    /*!
+       \brief Closes the modal alarm messages that are open, they would
+       keep the scheduler from stopping.
+     */
+    void closeAlarmMessage();
+
     bool alarmEnabled() const;
     bool alarmIsModal() const;
     bool vrcDebug() const;
     int alarmTimeHour() const;
     int alarmTimeMinute() const;
+    QObject* nowPlaying() const;
 
 public slots:
     void sendKeyboardInput( QString input );
@@ -75,26 +104,17 @@ public slots:
     void sendKeyboardRShiftTilde8();
     void sendKeyboardRShiftTilde9();
     void sendKeyboardRShiftTilde0();
-    void sendKeyboardRShiftTilde1Delayed();
-    void sendKeyboardRShiftTilde2Delayed();
-    void sendKeyboardRShiftTilde3Delayed();
-    void sendKeyboardRShiftTilde4Delayed();
-    void sendKeyboardRShiftTilde5Delayed();
-    void sendKeyboardRShiftTilde6Delayed();
-    void sendKeyboardRShiftTilde7Delayed();
-    void sendKeyboardRShiftTilde8Delayed();
-    void sendKeyboardRShiftTilde9Delayed();
-    void sendKeyboardRShiftTilde0Delayed();
     void sendMediaNextSong();
     void sendMediaPreviousSong();
     void sendMediaPausePlay();
     void sendMediaStopSong();
+    void pinMediaPlayer( QString player );
     Q_INVOKABLE void sendKeyboardOne();
     Q_INVOKABLE void sendKeyboardTwo();
     Q_INVOKABLE void sendKeyboardThree();
 
-    void setAlarmEnabled( bool enabled, bool notify = true );
-    void setAlarmIsModal( bool modal, bool notify = true );
+    void setAlarmEnabled( bool enabled );
+    void setAlarmIsModal( bool modal );
     void setVrcDebug( bool value, bool notify = true );
     void setAlarmTimeHour( int hour, bool notify = true );
     void setAlarmTimeMinute( int min, bool notify = true );
@@ -7,22 +7,19 @@
 
 namespace advsettings
 {
-void VideoTabController::initStage1()
+void VideoTabController::initStage1( utils::VRSettingsCache& vrSettingsCache )
 {
+    m_vrSettingsCache = &vrSettingsCache;
+
     // In order to ensure gain is "normal" before applying to either overlay or
     // gain.
 
     synchGain( true );
     resetGain();
 
-    m_videoDashboardUpdateCounter
-        = utils::adjustUpdateRate( k_videoDashboardUpdateCounter );
-
-    initBrightnessOverlay();
-    initColorOverlay();
+    // The overlays are created the first time they are shown or changed.
     initMotionSmoothing();
     initSupersampleOverride();
-    m_overlayInit = true;
     reloadVideoConfig();
     reloadVideoProfiles();
 
@@ -30,6 +27,66 @@ void VideoTabController::initStage1()
     {
         setBrightnessEnabled( true, false, true );
     }
+
+    subscribeToSettings();
+}
+
+VideoTabController::~VideoTabController()
+{
+    for ( const auto id : m_settingSubscriptions )
+    {
+        settings::unsubscribe( id );
+    }
+}
+
+/*!
+Applies the overlay and color settings whenever they change, no matter if
+they were changed by our setters, the settings file or an import.
+*/
+void VideoTabController::subscribeToSettings()
+{
+    using settings::BoolSetting;
+    using settings::DoubleSetting;
+
+    m_settingSubscriptions = {
+        settings::subscribe( BoolSetting::VIDEO_brightnessEnabled,
+                             [this]( bool value ) {
+                                 setBrightnessEnabled( value, true, true );
+                             } ),
+        settings::subscribe( DoubleSetting::VIDEO_brightnessOpacityValue,
+                             [this]( double value ) {
+                                 setBrightnessOpacityValue(
+                                     static_cast<float>( value ), true, true );
+                             } ),
+        settings::subscribe( BoolSetting::VIDEO_isOverlayMethodActive,
+                             [this]( bool value ) {
+                                 setIsOverlayMethodActive( value, true, true );
+                             } ),
+        settings::subscribe( BoolSetting::VIDEO_colorOverlayEnabled,
+                             [this]( bool value ) {
+                                 setColorOverlayEnabled( value, true, true );
+                             } ),
+        settings::subscribe( DoubleSetting::VIDEO_colorOverlayOpacity,
+                             [this]( double value ) {
+                                 setColorOverlayOpacity(
+                                     static_cast<float>( value ), true, true );
+                             } ),
+        settings::subscribe( DoubleSetting::VIDEO_colorRed,
+                             [this]( double value ) {
+                                 setColorRed(
+                                     static_cast<float>( value ), true, true );
+                             } ),
+        settings::subscribe( DoubleSetting::VIDEO_colorGreen,
+                             [this]( double value ) {
+                                 setColorGreen(
+                                     static_cast<float>( value ), true, true );
+                             } ),
+        settings::subscribe( DoubleSetting::VIDEO_colorBlue,
+                             [this]( double value ) {
+                                 setColorBlue(
+                                     static_cast<float>( value ), true, true );
+                             } ),
+    };
 }
 
 void VideoTabController::initBrightnessOverlay()
@@ -114,6 +171,28 @@ void VideoTabController::initColorOverlay()
     }
 }
 
+void VideoTabController::createOverlays()
+{
+    if ( m_overlayInit )
+    {
+        return;
+    }
+    m_overlayInit = true;
+
+    initBrightnessOverlay();
+    initColorOverlay();
+
+    vr::VROverlayError overlayError = vr::VROverlay()->SetOverlayAlpha(
+        m_brightnessOverlayHandle, brightnessOpacityValue() );
+    if ( overlayError != vr::VROverlayError_None )
+    {
+        LOG( ERROR ) << "Could not set alpha for Brightness Overlay: "
+                     << vr::VROverlay()->GetOverlayErrorNameFromEnum(
+                            overlayError );
+    }
+    loadColorOverlay();
+}
+
 void VideoTabController::loadColorOverlay()
 {
     vr::VROverlayError overlayError = vr::VROverlay()->SetOverlayColor(
@@ -138,40 +217,25 @@ void VideoTabController::loadColorOverlay()
 
 void VideoTabController::eventLoopTick() {}
 
-void VideoTabController::dashboardLoopTick()
+void VideoTabController::initStage2( OverlayController* parent )
 {
-    if ( settingsUpdateCounter >= m_videoDashboardUpdateCounter )
-    {
-        vr::EVRSettingsError vrSettingsError;
-
-        // checks supersampling override and resynchs if necessry
-        // also prints error if can't find.
-        auto sso = vr::VRSettings()->GetBool(
-            vr::k_pch_SteamVR_Section,
-            vr::k_pch_SteamVR_SupersampleManualOverride_Bool,
-            &vrSettingsError );
-        if ( vrSettingsError != vr::VRSettingsError_None )
-        {
-            LOG( WARNING ) << "Could not read \""
-                           << vr::k_pch_SteamVR_SupersampleManualOverride_Bool
-                           << "\" setting: "
-                           << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                                  vrSettingsError );
-        }
-
-        setAllowSupersampleOverride( sso );
-        // checks supersampling and re-synchs if necessary
-        auto ss = vr::VRSettings()->GetFloat(
-            vr::k_pch_SteamVR_Section,
-            vr::k_pch_SteamVR_SupersampleScale_Float,
-            &vrSettingsError );
-        if ( vrSettingsError != vr::VRSettingsError_None )
-        {
-            LOG( WARNING ) << "Could not read \""
-                           << vr::k_pch_SteamVR_SupersampleScale_Float
-                           << "\" setting: "
-                           << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                                  vrSettingsError );
+    auto& cache = parent->vrSettingsCache();
+    cache.watchBool(
+        vr::k_pch_SteamVR_Section,
+        vr::k_pch_SteamVR_SupersampleManualOverride_Bool,
+        [this]( bool value ) { setAllowSupersampleOverride( value ); } );
+    cache.watchFloat(
+        vr::k_pch_SteamVR_Section,
+        vr::k_pch_SteamVR_SupersampleScale_Float,
+        [this]( float value ) {
+            if ( fabs( static_cast<double>( m_superSampling - value ) ) > 0.05 )
+            {
+                LOG( INFO ) << "OpenVR reports a changed supersampling value: "
+                            << m_superSampling << " => " << value;
+                setSuperSampling( value );
+            }
+        },
+        [this] {
             if ( m_superSampling != 1.0f )
             {
                 LOG( DEBUG ) << "OpenVR returns an error and we have a custom "
@@ -179,73 +243,54 @@ void VideoTabController::dashboardLoopTick()
                              << m_superSampling;
                 setSuperSampling( 1.0 );
             }
-        }
-        else if ( fabs( static_cast<double>( m_superSampling - ss ) ) > 0.05 )
-        {
-            LOG( INFO ) << "OpenVR reports a changed supersampling value: "
-                        << m_superSampling << " => " << ss;
-            setSuperSampling( ss );
-        }
-        // checks if Supersampling filter is on and changes if it has been
-        // changed elsewhere
-
-        auto sf = vr::VRSettings()->GetBool(
-            vr::k_pch_SteamVR_Section,
-            vr::k_pch_SteamVR_AllowSupersampleFiltering_Bool,
-            &vrSettingsError );
-        if ( vrSettingsError != vr::VRSettingsError_None )
-        {
-            LOG( WARNING ) << "Could not read \""
-                           << vr::k_pch_SteamVR_AllowSupersampleFiltering_Bool
-                           << "\" setting: "
-                           << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                                  vrSettingsError );
-        }
-        setAllowSupersampleFiltering( sf );
-
-        // Checks if Motion smoothing setting can be read and synchs adv
-        // settings to steamvr/openvr
-        auto ms
-            = vr::VRSettings()->GetBool( vr::k_pch_SteamVR_Section,
-                                         vr::k_pch_SteamVR_MotionSmoothing_Bool,
-                                         &vrSettingsError );
-        if ( vrSettingsError != vr::VRSettingsError_None )
-        {
-            LOG( WARNING ) << "Could not read \""
-                           << vr::k_pch_SteamVR_MotionSmoothing_Bool
-                           << "\" setting: "
-                           << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                                  vrSettingsError );
-        }
-        setMotionSmoothing( ms );
-
-        // Synch's our saved Values of gain to the SteamVR's version
-        // This will allow other apps to modify Gain.
-
-        bool valueAdjust = true;
-        if ( isOverlayMethodActive() )
-        {
-            valueAdjust = false;
-        }
-        synchGain( valueAdjust );
-
-        settingsUpdateCounter = 0;
-    }
-    else
-    {
-        settingsUpdateCounter++;
-    }
+        } );
+    cache.watchBool(
+        vr::k_pch_SteamVR_Section,
+        vr::k_pch_SteamVR_AllowSupersampleFiltering_Bool,
+        [this]( bool value ) { setAllowSupersampleFiltering( value ); } );
+    cache.watchBool( vr::k_pch_SteamVR_Section,
+                     vr::k_pch_SteamVR_MotionSmoothing_Bool,
+                     [this]( bool value ) { setMotionSmoothing( value ); } );
+
+    // Synch's our saved Values of gain to the SteamVR's version
+    // This will allow other apps to modify Gain.
+    const auto watchGain = [this, &cache]( const char* key,
+                                           settings::DoubleSetting setting ) {
+        cache.watchFloat(
+            vr::k_pch_SteamVR_Section, key, [this, setting]( float value ) {
+                // The overlay method keeps the runtime gain at 1.0.
+                const auto current = settings::getSetting( setting );
+                if ( !isOverlayMethodActive()
+                     && fabs( static_cast<double>( value ) - current )
+                            > 0.005 )
+                {
+                    settings::setSetting( setting,
+                                          static_cast<double>( value ) );
+                }
+            } );
+    };
+    watchGain( vr::k_pch_SteamVR_HmdDisplayColorGainR_Float,
+               settings::DoubleSetting::VIDEO_colorRed );
+    watchGain( vr::k_pch_SteamVR_HmdDisplayColorGainG_Float,
+               settings::DoubleSetting::VIDEO_colorGreen );
+    watchGain( vr::k_pch_SteamVR_HmdDisplayColorGainB_Float,
+               settings::DoubleSetting::VIDEO_colorBlue );
 }
 
 void VideoTabController::reloadVideoConfig()
 {
     setBrightnessEnabled( brightnessEnabled(), true );
     setColorOverlayEnabled( colorOverlayEnabled(), true );
-    setIsOverlayMethodActive( isOverlayMethodActive(), true );
+    setIsOverlayMethodActive( isOverlayMethodActive(), true, true );
     setColorRed( colorRed() );
     setColorGreen( colorGreen() );
     setColorBlue( colorBlue() );
 
+    if ( !m_overlayInit )
+    {
+        return;
+    }
+
     vr::VROverlayError overlayError = vr::VROverlay()->SetOverlayAlpha(
         m_brightnessOverlayHandle, brightnessOpacityValue() );
     if ( overlayError != vr::VROverlayError_None )
@@ -273,76 +318,83 @@ void VideoTabController::setBrightnessEnabled( bool value,
                                                bool notify,
                                                bool keepValue )
 {
-    if ( value != brightnessEnabled() || keepValue )
+    // Applied by the subscription with keepValue.
+    if ( !keepValue )
     {
-        if ( !keepValue )
-        {
-            settings::setSetting(
-                settings::BoolSetting::VIDEO_brightnessEnabled, value );
-        }
+        settings::setSetting( settings::BoolSetting::VIDEO_brightnessEnabled,
+                              value );
+        return;
+    }
 
-        auto overlayHandle = getBrightnessOverlayHandle();
-        if ( value )
+    // Hiding an overlay that was never created is a no-op.
+    auto overlayHandle = value ? getBrightnessOverlayHandle()
+                               : m_brightnessOverlayHandle;
+    if ( value )
+    {
+        if ( overlayHandle != vr::k_ulOverlayHandleInvalid )
         {
-            if ( overlayHandle != vr::k_ulOverlayHandleInvalid )
-            {
-                vr::VROverlay()->ShowOverlay( getBrightnessOverlayHandle() );
-                LOG( INFO ) << "Brightness Overlay toggled on";
-            }
+            vr::VROverlay()->ShowOverlay( getBrightnessOverlayHandle() );
+            LOG( INFO ) << "Brightness Overlay toggled on";
         }
-        else
+    }
+    else
+    {
+        if ( overlayHandle != vr::k_ulOverlayHandleInvalid )
         {
-            if ( overlayHandle != vr::k_ulOverlayHandleInvalid )
-            {
-                vr::VROverlay()->HideOverlay( getBrightnessOverlayHandle() );
-                LOG( INFO ) << "Brightness Overlay toggled off";
-            }
+            vr::VROverlay()->HideOverlay( getBrightnessOverlayHandle() );
+            LOG( INFO ) << "Brightness Overlay toggled off";
         }
+    }
 
-        if ( notify )
-        {
-            emit brightnessEnabledChanged( value );
-        }
+    if ( notify )
+    {
+        emit brightnessEnabledChanged( value );
     }
 }
 
 void VideoTabController::setBrightnessOpacityValue( float percvalue,
-                                                    bool notify )
+                                                    bool notify,
+                                                    bool keepValue )
 {
+    // Applied by the subscription with keepValue.
+    if ( !keepValue )
+    {
+        if ( fabs( static_cast<double>( percvalue - brightnessOpacityValue() ) )
+             > .005 )
+        {
+            settings::setSetting(
+                settings::DoubleSetting::VIDEO_brightnessOpacityValue,
+                static_cast<double>( percvalue ) );
+        }
+        return;
+    }
+
     // This takes the Perceived value, and converts it to allow more accurate
     // linear positioning. (human perception logarithmic)
     float realvalue = static_cast<float>(
         std::pow( static_cast<double>( 1.0f - percvalue ), 1 / 3. ) );
 
-    if ( fabs( static_cast<double>( percvalue - brightnessOpacityValue() ) )
-         > .005 )
+    if ( !( realvalue <= 1.0f && realvalue >= 0.00f ) )
     {
+        LOG( WARNING ) << "alpha value is invalid setting to 1.0";
+        // Applied again by the subscription.
         settings::setSetting(
-            settings::DoubleSetting::VIDEO_brightnessOpacityValue,
-            static_cast<double>( percvalue ) );
+            settings::DoubleSetting::VIDEO_brightnessOpacityValue, 0.0 );
+        return;
+    }
 
-        if ( realvalue <= 1.0f && realvalue >= 0.00f )
-        {
-            vr::VROverlayError overlayError = vr::VROverlay()->SetOverlayAlpha(
-                m_brightnessOverlayHandle, realvalue );
-            if ( overlayError != vr::VROverlayError_None )
-            {
-                LOG( ERROR ) << "Could not set alpha for brightness overlay: "
-                             << vr::VROverlay()->GetOverlayErrorNameFromEnum(
-                                    overlayError );
-            }
-        }
-        else
-        {
-            LOG( WARNING ) << "alpha value is invalid setting to 1.0";
-            settings::setSetting(
-                settings::DoubleSetting::VIDEO_brightnessOpacityValue, 0.0 );
-        }
+    vr::VROverlayError overlayError = vr::VROverlay()->SetOverlayAlpha(
+        getBrightnessOverlayHandle(), realvalue );
+    if ( overlayError != vr::VROverlayError_None )
+    {
+        LOG( ERROR ) << "Could not set alpha for brightness overlay: "
+                     << vr::VROverlay()->GetOverlayErrorNameFromEnum(
+                            overlayError );
+    }
 
-        if ( notify )
-        {
-            emit brightnessOpacityValueChanged( percvalue );
-        }
+    if ( notify )
+    {
+        emit brightnessOpacityValueChanged( percvalue );
     }
 }
 
@@ -392,11 +444,19 @@ bool VideoTabController::isOverlayMethodActive() const
 
 // setters
 
-void VideoTabController::setIsOverlayMethodActive( bool value, bool notify )
+void VideoTabController::setIsOverlayMethodActive( bool value,
+                                                   bool notify,
+                                                   bool keepValue )
 {
+    // Applied by the subscription with keepValue.
+    if ( !keepValue )
+    {
+        settings::setSetting(
+            settings::BoolSetting::VIDEO_isOverlayMethodActive, value );
+        return;
+    }
+
     resetGain();
-    settings::setSetting( settings::BoolSetting::VIDEO_isOverlayMethodActive,
-                          value );
 
     if ( value )
     {
@@ -418,64 +478,72 @@ void VideoTabController::setColorOverlayEnabled( bool value,
                                                  bool notify,
                                                  bool keepValue )
 {
-    if ( value != colorOverlayEnabled() || keepValue )
+    // Applied by the subscription with keepValue.
+    if ( !keepValue )
+    {
+        settings::setSetting( settings::BoolSetting::VIDEO_colorOverlayEnabled,
+                              value );
+        return;
+    }
+
+    auto overlayHandle = value ? getColorOverlayHandle() : m_colorOverlayHandle;
+    if ( value )
     {
-        if ( !keepValue )
+        if ( overlayHandle != vr::k_ulOverlayHandleInvalid )
         {
-            settings::setSetting(
-                settings::BoolSetting::VIDEO_colorOverlayEnabled, value );
+            vr::VROverlay()->ShowOverlay( getColorOverlayHandle() );
+            LOG( INFO ) << "Color Overlay toggled on";
         }
-        auto overlayHandle = getColorOverlayHandle();
-        if ( value )
+    }
+    else
+    {
+        if ( overlayHandle != vr::k_ulOverlayHandleInvalid )
         {
-            if ( overlayHandle != vr::k_ulOverlayHandleInvalid )
-            {
-                vr::VROverlay()->ShowOverlay( getColorOverlayHandle() );
-                LOG( INFO ) << "Color Overlay toggled on";
-            }
-        }
-        else
-        {
-            if ( overlayHandle != vr::k_ulOverlayHandleInvalid )
-            {
-                vr::VROverlay()->HideOverlay( getColorOverlayHandle() );
-                LOG( INFO ) << "Color Overlay toggled off";
-            }
+            vr::VROverlay()->HideOverlay( getColorOverlayHandle() );
+            LOG( INFO ) << "Color Overlay toggled off";
         }
+    }
 
-        if ( notify )
-        {
-            emit colorOverlayEnabledChanged( value );
-        }
+    if ( notify )
+    {
+        emit colorOverlayEnabledChanged( value );
     }
 }
 
-void VideoTabController::setColorOverlayOpacity( float value, bool notify )
+void VideoTabController::setColorOverlayOpacity( float value,
+                                                 bool notify,
+                                                 bool keepValue )
 {
-    if ( fabs( static_cast<double>( value - colorOverlayOpacity() ) ) > .005 )
+    if ( value > .85f )
     {
-        if ( value > .85f )
-        {
-            value = 0.85f;
-        }
-
-        settings::setSetting(
-            settings::DoubleSetting::VIDEO_colorOverlayOpacity,
-            static_cast<double>( value ) );
+        value = 0.85f;
+    }
 
-        vr::VROverlayError overlayError
-            = vr::VROverlay()->SetOverlayAlpha( m_colorOverlayHandle, value );
-        if ( overlayError != vr::VROverlayError_None )
+    // Applied by the subscription with keepValue.
+    if ( !keepValue )
+    {
+        if ( fabs( static_cast<double>( value - colorOverlayOpacity() ) )
+             > .005 )
         {
-            LOG( ERROR ) << "Could not set alpha for color overlay: "
-                         << vr::VROverlay()->GetOverlayErrorNameFromEnum(
-                                overlayError );
+            settings::setSetting(
+                settings::DoubleSetting::VIDEO_colorOverlayOpacity,
+                static_cast<double>( value ) );
         }
+        return;
+    }
 
-        if ( notify )
-        {
-            emit colorOverlayOpacityChanged( value );
-        }
+    vr::VROverlayError overlayError = vr::VROverlay()->SetOverlayAlpha(
+        getColorOverlayHandle(), value );
+    if ( overlayError != vr::VROverlayError_None )
+    {
+        LOG( ERROR ) << "Could not set alpha for color overlay: "
+                     << vr::VROverlay()->GetOverlayErrorNameFromEnum(
+                            overlayError );
+    }
+
+    if ( notify )
+    {
+        emit colorOverlayOpacityChanged( value );
     }
 }
 
@@ -550,49 +618,43 @@ void VideoTabController::synchGain( bool setValue )
 
 void VideoTabController::setColorRed( float value, bool notify, bool keepValue )
 {
-    if ( ( fabs( static_cast<double>( value - colorRed() ) ) > .005 )
-         || keepValue )
+    // Applied by the subscription with keepValue.
+    if ( !keepValue )
     {
-        if ( !keepValue )
+        if ( fabs( static_cast<double>( value - colorRed() ) ) > .005 )
         {
             settings::setSetting( settings::DoubleSetting::VIDEO_colorRed,
                                   static_cast<double>( value ) );
         }
+        return;
+    }
 
-        if ( isOverlayMethodActive() )
-        {
-            vr::VROverlayError overlayError = vr::VROverlay()->SetOverlayColor(
-                m_colorOverlayHandle, colorRed(), colorGreen(), colorBlue() );
-            if ( overlayError != vr::VROverlayError_None )
-            {
-                LOG( ERROR ) << "Could not set Red for color overlay: "
-                             << vr::VROverlay()->GetOverlayErrorNameFromEnum(
-                                    overlayError );
-            }
-        }
-        else
+    if ( isOverlayMethodActive() )
+    {
+        vr::VROverlayError overlayError = vr::VROverlay()->SetOverlayColor(
+            getColorOverlayHandle(),
+            colorRed(),
+            colorGreen(),
+            colorBlue() );
+        if ( overlayError != vr::VROverlayError_None )
         {
-            vr::EVRSettingsError vrSettingsError;
-            vr::VRSettings()->SetFloat(
-                vr::k_pch_SteamVR_Section,
-                vr::k_pch_SteamVR_HmdDisplayColorGainR_Float,
-                colorRed(),
-                &vrSettingsError );
-
-            if ( vrSettingsError != vr::VRSettingsError_None )
-            {
-                LOG( ERROR ) << "could not set Red Gain Value, Error: "
-                             << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                                    vrSettingsError );
-            }
+            LOG( ERROR ) << "Could not set Red for color overlay: "
+                         << vr::VROverlay()->GetOverlayErrorNameFromEnum(
+                                overlayError );
         }
+    }
+    else
+    {
+        m_vrSettingsCache->set( vr::k_pch_SteamVR_Section,
+                                vr::k_pch_SteamVR_HmdDisplayColorGainR_Float,
+                                colorRed() );
+    }
 
-        LOG( DEBUG ) << "Changed Red Value to: " << colorRed();
+    LOG( DEBUG ) << "Changed Red Value to: " << colorRed();
 
-        if ( notify )
-        {
-            emit colorRedChanged( colorRed() );
-        }
+    if ( notify )
+    {
+        emit colorRedChanged( colorRed() );
     }
 }
 
@@ -600,49 +662,43 @@ void VideoTabController::setColorGreen( float value,
                                         bool notify,
                                         bool keepValue )
 {
-    if ( ( fabs( static_cast<double>( value - colorGreen() ) ) > .005 )
-         || keepValue )
+    // Applied by the subscription with keepValue.
+    if ( !keepValue )
     {
-        if ( !keepValue )
+        if ( fabs( static_cast<double>( value - colorGreen() ) ) > .005 )
         {
             settings::setSetting( settings::DoubleSetting::VIDEO_colorGreen,
                                   static_cast<double>( value ) );
         }
+        return;
+    }
 
-        if ( isOverlayMethodActive() )
-        {
-            vr::VROverlayError overlayError = vr::VROverlay()->SetOverlayColor(
-                m_colorOverlayHandle, colorRed(), colorGreen(), colorBlue() );
-            if ( overlayError != vr::VROverlayError_None )
-            {
-                LOG( ERROR ) << "Could not set Green for color overlay: "
-                             << vr::VROverlay()->GetOverlayErrorNameFromEnum(
-                                    overlayError );
-            }
-        }
-        else
+    if ( isOverlayMethodActive() )
+    {
+        vr::VROverlayError overlayError = vr::VROverlay()->SetOverlayColor(
+            getColorOverlayHandle(),
+            colorRed(),
+            colorGreen(),
+            colorBlue() );
+        if ( overlayError != vr::VROverlayError_None )
         {
-            vr::EVRSettingsError vrSettingsError;
-            vr::VRSettings()->SetFloat(
-                vr::k_pch_SteamVR_Section,
-                vr::k_pch_SteamVR_HmdDisplayColorGainG_Float,
-                colorGreen(),
-                &vrSettingsError );
-
-            if ( vrSettingsError != vr::VRSettingsError_None )
-            {
-                LOG( ERROR ) << "could not set Green Gain Value, Error: "
-                             << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                                    vrSettingsError );
-            }
+            LOG( ERROR ) << "Could not set Green for color overlay: "
+                         << vr::VROverlay()->GetOverlayErrorNameFromEnum(
+                                overlayError );
         }
+    }
+    else
+    {
+        m_vrSettingsCache->set( vr::k_pch_SteamVR_Section,
+                                vr::k_pch_SteamVR_HmdDisplayColorGainG_Float,
+                                colorGreen() );
+    }
 
-        LOG( DEBUG ) << "Changed Green Value to: " << colorGreen();
+    LOG( DEBUG ) << "Changed Green Value to: " << colorGreen();
 
-        if ( notify )
-        {
-            emit colorGreenChanged( colorGreen() );
-        }
+    if ( notify )
+    {
+        emit colorGreenChanged( colorGreen() );
     }
 }
 
@@ -650,87 +706,53 @@ void VideoTabController::setColorBlue( float value,
                                        bool notify,
                                        bool keepValue )
 {
-    if ( ( fabs( static_cast<double>( value - colorBlue() ) ) > .005 )
-         || keepValue )
+    // Applied by the subscription with keepValue.
+    if ( !keepValue )
     {
-        if ( !keepValue )
+        if ( fabs( static_cast<double>( value - colorBlue() ) ) > .005 )
         {
             settings::setSetting( settings::DoubleSetting::VIDEO_colorBlue,
                                   static_cast<double>( value ) );
         }
-        if ( isOverlayMethodActive() )
-        {
-            vr::VROverlayError overlayError = vr::VROverlay()->SetOverlayColor(
-                m_colorOverlayHandle, colorRed(), colorGreen(), colorBlue() );
-            if ( overlayError != vr::VROverlayError_None )
-            {
-                LOG( ERROR ) << "Could not set Blue for color overlay: "
-                             << vr::VROverlay()->GetOverlayErrorNameFromEnum(
-                                    overlayError );
-            }
-        }
-        else
-        {
-            vr::EVRSettingsError vrSettingsError;
-            vr::VRSettings()->SetFloat(
-                vr::k_pch_SteamVR_Section,
-                vr::k_pch_SteamVR_HmdDisplayColorGainB_Float,
-                colorBlue(),
-                &vrSettingsError );
-
-            if ( vrSettingsError != vr::VRSettingsError_None )
-            {
-                LOG( ERROR ) << "could not set Blue Gain Value, Error: "
-                             << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                                    vrSettingsError );
-            }
-        }
-
-        LOG( DEBUG ) << "Changed Blue Value to: " << colorBlue();
+        return;
+    }
 
-        if ( notify )
+    if ( isOverlayMethodActive() )
+    {
+        vr::VROverlayError overlayError = vr::VROverlay()->SetOverlayColor(
+            getColorOverlayHandle(),
+            colorRed(),
+            colorGreen(),
+            colorBlue() );
+        if ( overlayError != vr::VROverlayError_None )
         {
-            emit colorBlueChanged( colorBlue() );
+            LOG( ERROR ) << "Could not set Blue for color overlay: "
+                         << vr::VROverlay()->GetOverlayErrorNameFromEnum(
+                                overlayError );
         }
     }
-}
-
-void VideoTabController::resetGain()
-{
-    vr::EVRSettingsError vrSettingsError;
-    vr::VRSettings()->SetFloat( vr::k_pch_SteamVR_Section,
-                                vr::k_pch_SteamVR_HmdDisplayColorGainR_Float,
-                                1.0f,
-                                &vrSettingsError );
-
-    if ( vrSettingsError != vr::VRSettingsError_None )
+    else
     {
-        LOG( ERROR ) << "could not set Red Gain Value, Error: "
-                     << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                            vrSettingsError );
+        m_vrSettingsCache->set( vr::k_pch_SteamVR_Section,
+                                vr::k_pch_SteamVR_HmdDisplayColorGainB_Float,
+                                colorBlue() );
     }
-    vr::VRSettings()->SetFloat( vr::k_pch_SteamVR_Section,
-                                vr::k_pch_SteamVR_HmdDisplayColorGainG_Float,
-                                1.0f,
-                                &vrSettingsError );
 
-    if ( vrSettingsError != vr::VRSettingsError_None )
+    LOG( DEBUG ) << "Changed Blue Value to: " << colorBlue();
+
+    if ( notify )
     {
-        LOG( ERROR ) << "could not set Green Gain Value, Error: "
-                     << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                            vrSettingsError );
+        emit colorBlueChanged( colorBlue() );
     }
+}
 
-    vr::VRSettings()->SetFloat( vr::k_pch_SteamVR_Section,
-                                vr::k_pch_SteamVR_HmdDisplayColorGainB_Float,
-                                1.0f,
-                                &vrSettingsError );
-
-    if ( vrSettingsError != vr::VRSettingsError_None )
+void VideoTabController::resetGain()
+{
+    for ( const auto key : { vr::k_pch_SteamVR_HmdDisplayColorGainR_Float,
+                             vr::k_pch_SteamVR_HmdDisplayColorGainG_Float,
+                             vr::k_pch_SteamVR_HmdDisplayColorGainB_Float } )
     {
-        LOG( ERROR ) << "could not set Blue Gain Value, Error: "
-                     << vr::VRSettings()->GetSettingsErrorNameFromEnum(
-                            vrSettingsError );
+        m_vrSettingsCache->set( vr::k_pch_SteamVR_Section, key, 1.0f );
     }
 }
 
@@ -800,9 +822,9 @@ void VideoTabController::setSuperSampling( float value, const bool notify )
         LOG( DEBUG ) << "Supersampling value changed: " << m_superSampling
                      << " => " << value;
         m_superSampling = value;
-        vr::VRSettings()->SetFloat( vr::k_pch_SteamVR_Section,
-                                    vr::k_pch_SteamVR_SupersampleScale_Float,
-                                    m_superSampling );
+        m_vrSettingsCache->set( vr::k_pch_SteamVR_Section,
+                                vr::k_pch_SteamVR_SupersampleScale_Float,
+                                m_superSampling );
         if ( notify )
         {
             emit superSamplingChanged( m_superSampling );
@@ -816,7 +838,7 @@ void VideoTabController::setAllowSupersampleOverride( const bool value,
     if ( m_allowSupersampleOverride != value )
     {
         m_allowSupersampleOverride = value;
-        vr::VRSettings()->SetBool(
+        m_vrSettingsCache->set(
             vr::k_pch_SteamVR_Section,
             vr::k_pch_SteamVR_SupersampleManualOverride_Bool,
             m_allowSupersampleOverride );
@@ -844,9 +866,9 @@ void VideoTabController::setMotionSmoothing( const bool value,
     if ( m_motionSmoothing != value )
     {
         m_motionSmoothing = value;
-        vr::VRSettings()->SetBool( vr::k_pch_SteamVR_Section,
-                                   vr::k_pch_SteamVR_MotionSmoothing_Bool,
-                                   m_motionSmoothing );
+        m_vrSettingsCache->set( vr::k_pch_SteamVR_Section,
+                                vr::k_pch_SteamVR_MotionSmoothing_Bool,
+                                m_motionSmoothing );
         if ( notify )
         {
             emit motionSmoothingChanged( m_motionSmoothing );
@@ -884,7 +906,7 @@ void VideoTabController::setAllowSupersampleFiltering( const bool value,
     if ( m_allowSupersampleFiltering != value )
     {
         m_allowSupersampleFiltering = value;
-        vr::VRSettings()->SetBool(
+        m_vrSettingsCache->set(
             vr::k_pch_SteamVR_Section,
             vr::k_pch_SteamVR_AllowSupersampleFiltering_Bool,
             m_allowSupersampleFiltering );
@@ -902,35 +924,22 @@ void VideoTabController::setAllowSupersampleFiltering( const bool value,
 
 void VideoTabController::addVideoProfile( const QString name )
 {
-    VideoProfile* profile = nullptr;
-    for ( auto& p : videoProfiles )
-    {
-        if ( p.profileName.compare( name.toStdString() ) == 0 )
-        {
-            profile = &p;
-            break;
-        }
-    }
-    if ( !profile )
-    {
-        auto i = videoProfiles.size();
-        videoProfiles.emplace_back();
-        profile = &videoProfiles[i];
-    }
-    profile->profileName = name.toStdString();
-
-    profile->supersampleOverride = m_allowSupersampleOverride;
-    profile->supersampling = m_superSampling;
-    profile->anisotropicFiltering = m_allowSupersampleFiltering;
-    profile->motionSmooth = m_motionSmoothing;
-    profile->colorRed = colorRed();
-    profile->colorGreen = colorGreen();
-    profile->colorBlue = colorBlue();
-    profile->brightnessToggle = brightnessEnabled();
-    profile->brightnessOpacityValue = brightnessOpacityValue();
-    profile->opacity = colorOverlayOpacity();
-    profile->overlayMethodState = isOverlayMethodActive();
-
+    VideoProfile profile;
+    profile.profileName = name.toStdString();
+
+    profile.supersampleOverride = m_allowSupersampleOverride;
+    profile.supersampling = m_superSampling;
+    profile.anisotropicFiltering = m_allowSupersampleFiltering;
+    profile.motionSmooth = m_motionSmoothing;
+    profile.colorRed = colorRed();
+    profile.colorGreen = colorGreen();
+    profile.colorBlue = colorBlue();
+    profile.brightnessToggle = brightnessEnabled();
+    profile.brightnessOpacityValue = brightnessOpacityValue();
+    profile.opacity = colorOverlayOpacity();
+    profile.overlayMethodState = isOverlayMethodActive();
+
+    videoProfiles.put( std::move( profile ) );
     saveVideoProfiles();
     emit videoProfilesUpdated();
     emit videoProfileAdded();
@@ -940,7 +949,7 @@ void VideoTabController::applyVideoProfile( const unsigned index )
 {
     if ( index < videoProfiles.size() )
     {
-        auto& profile = videoProfiles[index];
+        const auto& profile = videoProfiles.at( index );
 
         setAllowSupersampleOverride( profile.supersampleOverride );
         setSuperSampling( profile.supersampling );
@@ -960,8 +969,7 @@ void VideoTabController::deleteVideoProfile( const unsigned index )
 {
     if ( index < videoProfiles.size() )
     {
-        auto pos = videoProfiles.begin() + index;
-        videoProfiles.erase( pos );
+        videoProfiles.remove( index );
         saveVideoProfiles();
         emit videoProfilesUpdated();
     }
@@ -969,12 +977,17 @@ void VideoTabController::deleteVideoProfile( const unsigned index )
 
 void VideoTabController::reloadVideoProfiles()
 {
-    settings::loadAllObjects( videoProfiles );
+    videoProfiles.load();
 }
 
 void VideoTabController::saveVideoProfiles()
 {
-    settings::saveAllObjects( videoProfiles );
+    videoProfiles.save();
+}
+
+QAbstractItemModel* VideoTabController::videoProfilesModel()
+{
+    return &videoProfiles.model();
 }
 
 int VideoTabController::getVideoProfileCount()
@@ -990,7 +1003,7 @@ QString VideoTabController::getVideoProfileName( const unsigned index )
     }
     else
     {
-        return QString::fromStdString( videoProfiles[index].profileName );
+        return QString::fromStdString( videoProfiles.name( index ) );
     }
 }
 
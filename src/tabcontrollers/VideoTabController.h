@@ -4,11 +4,18 @@
 #include <QString>
 #include <QVariant>
 #include <openvr.h>
-#include "../utils/FrameRateUtils.h"
+#include <vector>
 #include "../settings/settings_object.h"
+#include "../settings/profile_store.h"
+#include "../settings/settings.h"
 
 class QQuickWindow;
 
+namespace utils
+{
+class VRSettingsCache;
+} // namespace utils
+
 namespace video_keys
 {
 constexpr auto k_brightnessOverlayFilename = "/res/img/video/dimmer.png";
@@ -59,6 +66,8 @@ struct VideoProfile : settings::ISettingsObject
 
         o.addValue( static_cast<double>( opacity ) );
 
+        o.addValue( profileName );
+
         return o;
     }
 
@@ -82,6 +91,8 @@ struct VideoProfile : settings::ISettingsObject
         overlayMethodState = obj.getNextValueOrDefault( false );
 
         opacity = static_cast<float>( obj.getNextValueOrDefault( 1.0 ) );
+
+        profileName = obj.getNextValueOrDefault( "" );
     }
 
     virtual std::string settingsName() const override
@@ -121,10 +132,10 @@ class VideoTabController : public QObject
                     setColorOverlayEnabled NOTIFY colorOverlayEnabledChanged )
     Q_PROPERTY( float colorOverlayOpacity READ colorOverlayOpacity WRITE
                     setColorOverlayOpacity NOTIFY colorOverlayOpacityChanged )
+    Q_PROPERTY( QAbstractItemModel* videoProfilesModel READ videoProfilesModel
+                    CONSTANT )
 
 private:
-    unsigned settingsUpdateCounter = 0;
-
     // how far away the overlay is, any OVERLAY closer will not be dimmed.
     const float k_hmdDistance = -0.15f;
 
@@ -139,13 +150,18 @@ class VideoTabController : public QObject
 
     bool m_overlayInit = false;
 
+    // Runtime settings are written through it, set in initStage1 because
+    // the setters already run there.
+    utils::VRSettingsCache* m_vrSettingsCache = nullptr;
+
+    std::vector<settings::SubscriptionId> m_settingSubscriptions;
+    void subscribeToSettings();
+
     float m_superSampling = 1.0;
     bool m_allowSupersampleOverride = false;
     bool m_motionSmoothing = true;
     bool m_allowSupersampleFiltering = true;
 
-    unsigned int m_videoDashboardUpdateCounter = 47;
-
     void setColor( float R,
                    float G,
                    float B,
@@ -158,6 +174,7 @@ class VideoTabController : public QObject
 
     void initColorOverlay();
     void loadColorOverlay();
+    void createOverlays();
 
     void reloadVideoConfig();
 
@@ -165,7 +182,7 @@ class VideoTabController : public QObject
 
     void synchGain( bool setValue = false );
 
-    std::vector<VideoProfile> videoProfiles;
+    settings::ProfileStore<VideoProfile> videoProfiles;
 
     QString getSettingsName()
     {
@@ -174,11 +191,13 @@ class VideoTabController : public QObject
 
     vr::VROverlayHandle_t getBrightnessOverlayHandle()
     {
+        createOverlays();
         return m_brightnessOverlayHandle;
     }
 
     vr::VROverlayHandle_t getColorOverlayHandle()
     {
+        createOverlays();
         return m_colorOverlayHandle;
     }
 
@@ -200,13 +219,16 @@ class VideoTabController : public QObject
     bool allowSupersampleFiltering() const;
     bool isOverlayMethodActive() const;
 
-    void initStage1();
+    ~VideoTabController();
+
+    void initStage1( utils::VRSettingsCache& vrSettingsCache );
+    void initStage2( OverlayController* parent );
     void eventLoopTick();
-    void dashboardLoopTick();
 
     void reloadVideoProfiles();
     void saveVideoProfiles();
 
+    QAbstractItemModel* videoProfilesModel();
     Q_INVOKABLE int getVideoProfileCount();
     Q_INVOKABLE QString getVideoProfileName( unsigned index );
 
@@ -214,7 +236,9 @@ public slots:
     void setBrightnessEnabled( bool value,
                                bool notify = true,
                                bool keepValue = false );
-    void setBrightnessOpacityValue( float percvalue, bool notify = true );
+    void setBrightnessOpacityValue( float percvalue,
+                                    bool notify = true,
+                                    bool keepValue = false );
 
     void setSuperSampling( float value, bool notify = true );
     void setAllowSupersampleOverride( bool value, bool notify = true );
@@ -229,12 +253,16 @@ public slots:
     void setColorOverlayEnabled( bool value,
                                  bool notify = true,
                                  bool keepValue = false );
-    void setColorOverlayOpacity( float value, bool notify = true );
+    void setColorOverlayOpacity( float value,
+                                 bool notify = true,
+                                 bool keepValue = false );
 
     void setMotionSmoothing( bool value, bool notify = true );
     void setAllowSupersampleFiltering( bool value, bool notify = true );
 
-    void setIsOverlayMethodActive( bool value, bool notify = true );
+    void setIsOverlayMethodActive( bool value,
+                                   bool notify = true,
+                                   bool keepValue = false );
 
     void addVideoProfile( QString name );
     void applyVideoProfile( unsigned index );
@@ -0,0 +1,144 @@
+#include "ChaperoneGeometryBlob.h"
+#include <QByteArray>
+#include <QDataStream>
+#include <easylogging++.h>
+
+namespace
+{
+constexpr char k_blobMagic[4] = { 'O', 'C', 'G', 'B' };
+constexpr int k_magicSize = 4;
+constexpr int k_checksumSize = 2;
+// 3 floats per corner, 4 corners per quad.
+constexpr int k_floatsPerQuad = 12;
+
+void prepareStream( QDataStream& stream )
+{
+    stream.setByteOrder( QDataStream::LittleEndian );
+    stream.setFloatingPointPrecision( QDataStream::SinglePrecision );
+}
+
+} // namespace
+
+namespace utils
+{
+std::string encodeChaperoneGeometry( const ChaperoneGeometry& geometry )
+{
+    QByteArray data;
+    data.reserve( k_magicSize + 1 + 4
+                  + static_cast<int>( geometry.quads.size() ) * k_floatsPerQuad
+                        * 4
+                  + 14 * 4 + k_checksumSize );
+
+    QDataStream stream( &data, QIODevice::WriteOnly );
+    prepareStream( stream );
+
+    stream.writeRawData( k_blobMagic, k_magicSize );
+    stream << static_cast<quint8>( k_chaperoneGeometryBlobVersion );
+    stream << static_cast<quint32>( geometry.quads.size() );
+
+    for ( const auto& quad : geometry.quads )
+    {
+        for ( const auto& corner : quad.vCorners )
+        {
+            for ( const auto v : corner.v )
+            {
+                stream << v;
+            }
+        }
+    }
+
+    for ( const auto& row : geometry.standingCenter.m )
+    {
+        for ( const auto v : row )
+        {
+            stream << v;
+        }
+    }
+
+    stream << geometry.playSpaceAreaX << geometry.playSpaceAreaZ;
+
+    stream << qChecksum( data.constData(), static_cast<uint>( data.size() ) );
+
+    return data.toBase64().toStdString();
+}
+
+std::optional<ChaperoneGeometry>
+    decodeChaperoneGeometry( const std::string& blob )
+{
+    const auto data
+        = QByteArray::fromBase64( QByteArray::fromStdString( blob ) );
+
+    if ( data.size() < k_magicSize + 1 + 4 + k_checksumSize
+         || !data.startsWith( QByteArray( k_blobMagic, k_magicSize ) ) )
+    {
+        LOG( ERROR ) << "Chaperone geometry blob is malformed.";
+        return std::nullopt;
+    }
+
+    const auto payloadSize = static_cast<uint>( data.size() - k_checksumSize );
+
+    QDataStream stream( data );
+    prepareStream( stream );
+
+    stream.skipRawData( k_magicSize );
+
+    quint8 version = 0;
+    stream >> version;
+    if ( version != k_chaperoneGeometryBlobVersion )
+    {
+        LOG( ERROR ) << "Unknown chaperone geometry blob version "
+                     << static_cast<int>( version ) << ".";
+        return std::nullopt;
+    }
+
+    quint32 quadCount = 0;
+    stream >> quadCount;
+
+    const auto expectedSize = static_cast<qint64>( k_magicSize ) + 1 + 4
+                              + static_cast<qint64>( quadCount )
+                                    * k_floatsPerQuad * 4
+                              + 14 * 4 + k_checksumSize;
+    if ( expectedSize != data.size() )
+    {
+        LOG( ERROR ) << "Chaperone geometry blob has size " << data.size()
+                     << ", expected " << expectedSize << ".";
+        return std::nullopt;
+    }
+
+    ChaperoneGeometry geometry;
+    geometry.quads.resize( quadCount );
+    for ( auto& quad : geometry.quads )
+    {
+        for ( auto& corner : quad.vCorners )
+        {
+            for ( auto& v : corner.v )
+            {
+                stream >> v;
+            }
+        }
+    }
+
+    for ( auto& row : geometry.standingCenter.m )
+    {
+        for ( auto& v : row )
+        {
+            stream >> v;
+        }
+    }
+
+    stream >> geometry.playSpaceAreaX >> geometry.playSpaceAreaZ;
+
+    quint16 storedChecksum = 0;
+    stream >> storedChecksum;
+
+    if ( stream.status() != QDataStream::Ok
+         || storedChecksum != qChecksum( data.constData(), payloadSize ) )
+    {
+        LOG( ERROR ) << "Chaperone geometry blob failed checksum validation.";
+        return std::nullopt;
+    }
+
+    return geometry;
+}
+
+} // namespace utils
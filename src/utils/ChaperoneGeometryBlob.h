@@ -0,0 +1,44 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+#include <openvr.h>
+
+namespace utils
+{
+/*!
+   \brief Chaperone geometry as it is stored in a chaperone profile.
+ */
+struct ChaperoneGeometry
+{
+    std::vector<vr::HmdQuad_t> quads;
+    vr::HmdMatrix34_t standingCenter = {};
+    float playSpaceAreaX = 0.0f;
+    float playSpaceAreaZ = 0.0f;
+};
+
+// Bump when the binary layout changes. Older versions are still decoded as
+// long as a decoding path exists for them in decodeChaperoneGeometry.
+constexpr unsigned char k_chaperoneGeometryBlobVersion = 1;
+
+/*!
+   \brief Encodes \a geometry as a versioned, checksummed binary blob.
+   \return Base64 representation of the blob, suitable for storing as a
+   single string value in the settings file.
+
+   Layout (little endian): 4 byte magic "OCGB", 1 byte version, 4 byte quad
+   count, 12 floats per quad, 12 floats standing center, 2 floats play area
+   size, 2 byte CRC-16 over everything before it.
+ */
+std::string encodeChaperoneGeometry( const ChaperoneGeometry& geometry );
+
+/*!
+   \brief Decodes a blob created by \c encodeChaperoneGeometry.
+   \return The geometry, or \c std::nullopt if the blob is truncated, has an
+   unknown version or fails the checksum.
+ */
+std::optional<ChaperoneGeometry>
+    decodeChaperoneGeometry( const std::string& blob );
+
+} // namespace utils
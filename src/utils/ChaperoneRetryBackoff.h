@@ -0,0 +1,57 @@
+#pragma once
+
+#include <algorithm>
+
+namespace utils
+{
+/*!
+   \brief Schedules the fallback checks while chaperone geometry can't be
+   loaded, in event loop ticks.
+
+   Chaperone events are what normally trigger a reload. A check is only due
+   when none arrived for \c delayTicks ticks, and every failed check doubles
+   the delay up to \c k_maxDelayTicks. \c restart is called whenever the data
+   was reloaded or a chaperone event was received.
+ */
+class ChaperoneRetryBackoff
+{
+public:
+    // 10 seconds to about 3 minutes at the default tick rate.
+    static constexpr unsigned k_initialDelayTicks = 500;
+    static constexpr unsigned k_maxDelayTicks = 8000;
+
+    void restart() noexcept
+    {
+        m_delayTicks = k_initialDelayTicks;
+        m_ticks = 0;
+    }
+
+    /*!
+       \return true if a fallback check is due in this tick.
+     */
+    [[nodiscard]] bool tick() noexcept
+    {
+        if ( ++m_ticks < m_delayTicks )
+        {
+            return false;
+        }
+        m_ticks = 0;
+        return true;
+    }
+
+    void checkFailed() noexcept
+    {
+        m_delayTicks = std::min( m_delayTicks * 2, k_maxDelayTicks );
+    }
+
+    [[nodiscard]] unsigned delayTicks() const noexcept
+    {
+        return m_delayTicks;
+    }
+
+private:
+    unsigned m_delayTicks = k_initialDelayTicks;
+    unsigned m_ticks = 0;
+};
+
+} // namespace utils
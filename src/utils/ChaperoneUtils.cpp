@@ -1,9 +1,103 @@
 #include "ChaperoneUtils.h"
 #include <iostream>
 #include <cmath>
+#include <algorithm>
+#include <easylogging++.h>
 
 namespace utils
 {
+const char* chaperoneUnavailableReasonName( ChaperoneUnavailableReason reason )
+{
+    switch ( reason )
+    {
+    case ChaperoneUnavailableReason::None:
+        return "none";
+    case ChaperoneUnavailableReason::NotLoaded:
+        return "not loaded";
+    case ChaperoneUnavailableReason::NoCollisionBounds:
+        return "no collision bounds set up";
+    case ChaperoneUnavailableReason::CalibrationInvalid:
+        return "tracking calibration invalid";
+    }
+    return "unknown";
+}
+
+namespace
+{
+bool isCalibrationValid( vr::ChaperoneCalibrationState state )
+{
+    // Missing play area or bounds are reported as calibration errors too,
+    // but those can't be fixed by waiting.
+    return state < vr::ChaperoneCalibrationState_Error
+           || state == vr::ChaperoneCalibrationState_Error_PlayAreaInvalid
+           || state
+                  == vr::ChaperoneCalibrationState_Error_CollisionBoundsInvalid;
+}
+
+} // namespace
+
+void ChaperoneUtils::_setUnavailableReason( ChaperoneUnavailableReason reason )
+{
+    if ( reason != _unavailableReason )
+    {
+        if ( reason == ChaperoneUnavailableReason::None )
+        {
+            LOG( INFO ) << "Chaperone geometry available, " << _quadsCount
+                        << " quads.";
+        }
+        else
+        {
+            LOG( WARNING ) << "Chaperone geometry unavailable: "
+                           << chaperoneUnavailableReasonName( reason );
+        }
+        _unavailableReason = reason;
+    }
+    _retryBackoff.restart();
+}
+
+void ChaperoneUtils::chaperoneEventReceived()
+{
+    std::lock_guard<std::recursive_mutex> lock( _mutex );
+    _retryBackoff.restart();
+}
+
+void ChaperoneUtils::retryLoadChaperoneData()
+{
+    std::lock_guard<std::recursive_mutex> lock( _mutex );
+
+    switch ( _unavailableReason )
+    {
+    case ChaperoneUnavailableReason::NotLoaded:
+        loadChaperoneData();
+        break;
+
+    // Calibration changes normally come with a chaperone event, this only
+    // covers runtimes that don't send one.
+    case ChaperoneUnavailableReason::CalibrationInvalid:
+        if ( !_retryBackoff.tick() )
+        {
+            break;
+        }
+        if ( isCalibrationValid( vr::VRChaperone()->GetCalibrationState() ) )
+        {
+            LOG( INFO ) << "Tracking calibration valid without a chaperone "
+                           "event, reloading chaperone data.";
+            loadChaperoneData();
+        }
+        else
+        {
+            _retryBackoff.checkFailed();
+        }
+        break;
+
+    // Geometry is there, distances are missing because nothing is tracked.
+    case ChaperoneUnavailableReason::None:
+    // Waiting for a chaperone event.
+    case ChaperoneUnavailableReason::NoCollisionBounds:
+        break;
+    }
+}
+
 float ChaperoneUtils::_getDistanceToChaperone(
     const vr::HmdVector3_t& x,
     vr::HmdVector3_t* projectedPoint )
@@ -124,6 +218,19 @@ void ChaperoneUtils::loadChaperoneData( bool fromLiveBounds )
             }
         }
     }
+
+    if ( _quadsCount > 0 )
+    {
+        _setUnavailableReason( ChaperoneUnavailableReason::None );
+    }
+    else if ( !isCalibrationValid( vr::VRChaperone()->GetCalibrationState() ) )
+    {
+        _setUnavailableReason( ChaperoneUnavailableReason::CalibrationInvalid );
+    }
+    else
+    {
+        _setUnavailableReason( ChaperoneUnavailableReason::NoCollisionBounds );
+    }
 }
 
 } // end namespace utils
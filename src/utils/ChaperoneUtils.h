@@ -3,9 +3,24 @@
 #include <memory>
 #include <mutex>
 #include <openvr.h>
+#include "ChaperoneRetryBackoff.h"
 
 namespace utils
 {
+enum class ChaperoneUnavailableReason
+{
+    None,
+    // Nothing has been loaded yet.
+    NotLoaded,
+    // No collision bounds are set up, e.g. seated only setups. This can only
+    // change through room setup, which emits chaperone events.
+    NoCollisionBounds,
+    // Tracking isn't calibrated, e.g. base stations haven't initialized yet.
+    CalibrationInvalid,
+};
+
+const char* chaperoneUnavailableReasonName( ChaperoneUnavailableReason reason );
+
 class ChaperoneUtils
 {
 private:
@@ -14,6 +29,12 @@ class ChaperoneUtils
     std::unique_ptr<vr::HmdVector3_t> _corners;
     bool _chaperoneWellFormed = true;
 
+    ChaperoneUnavailableReason _unavailableReason
+        = ChaperoneUnavailableReason::NotLoaded;
+    ChaperoneRetryBackoff _retryBackoff;
+
+    void _setUnavailableReason( ChaperoneUnavailableReason reason );
+
     float _getDistanceToChaperone( const vr::HmdVector3_t& point,
                                    vr::HmdVector3_t* projectedPoint );
 
@@ -26,6 +47,10 @@ class ChaperoneUtils
     {
         return _chaperoneWellFormed;
     }
+    ChaperoneUnavailableReason unavailableReason() const noexcept
+    {
+        return _unavailableReason;
+    }
 
     std::recursive_mutex& mutex() noexcept
     {
@@ -34,6 +59,23 @@ class ChaperoneUtils
 
     void loadChaperoneData( bool fromLiveBounds = true );
 
+    /*!
+       \brief Called for every chaperone event, before the debounced reload.
+       Postpones the fallback check, the reload is already on its way.
+     */
+    void chaperoneEventReceived();
+
+    /*!
+       \brief Called every tick in which no distance to the chaperone could be
+       computed.
+
+       Reloads immediately if nothing was loaded yet. Otherwise the data is
+       reloaded by the chaperone events that call \c loadChaperoneData. Only
+       while calibration is invalid is the calibration state checked as a
+       fallback, in case no event arrives, see \c ChaperoneRetryBackoff.
+     */
+    void retryLoadChaperoneData();
+
     float getDistanceToChaperone( const vr::HmdVector3_t& point,
                                   vr::HmdVector3_t* projectedPoint = nullptr,
                                   bool doLock = false )
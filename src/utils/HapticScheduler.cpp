@@ -0,0 +1,219 @@
+#include "HapticScheduler.h"
+#include <algorithm>
+#include <vector>
+
+namespace utils
+{
+HapticScheduler::HapticScheduler( TriggerFunction trigger,
+                                  std::chrono::milliseconds minPulseInterval )
+    : m_trigger( std::move( trigger ) ), m_minPulseInterval( minPulseInterval ),
+      m_worker( &HapticScheduler::run, this )
+{
+}
+
+HapticScheduler::~HapticScheduler()
+{
+    stop();
+}
+
+HapticScheduler::DeviceState& HapticScheduler::device( HapticDevice device )
+{
+    return m_devices.at( static_cast<size_t>( device ) );
+}
+
+void HapticScheduler::setActionHandle( HapticDevice d,
+                                       vr::VRActionHandle_t handle )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    device( d ).actionHandle = handle;
+}
+
+void HapticScheduler::setInputHandle( HapticDevice d,
+                                      vr::VRInputValueHandle_t handle )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    device( d ).inputHandle = handle;
+}
+
+void HapticScheduler::queuePulse( HapticDevice d, const HapticPulse& pulse )
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        auto& state = device( d );
+
+        if ( !state.pending.empty() && state.pending.back() == pulse )
+        {
+            ++m_droppedPulses;
+            return;
+        }
+        if ( state.pending.size() >= k_maxQueuedPulses )
+        {
+            state.pending.pop_front();
+            ++m_droppedPulses;
+        }
+        state.pending.push_back( pulse );
+    }
+    m_wake.notify_one();
+}
+
+void HapticScheduler::setProximity( HapticDevice d, float intensity )
+{
+    intensity = std::clamp( intensity, 0.0f, 1.0f );
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        auto& state = device( d );
+        if ( state.proximityActive && state.proximity == intensity )
+        {
+            return;
+        }
+        // Don't wait out a long period when the user is getting closer.
+        if ( !state.proximityActive || intensity > state.proximity )
+        {
+            state.nextProximity = Clock::time_point{};
+        }
+        state.proximityActive = true;
+        state.proximity = intensity;
+    }
+    m_wake.notify_one();
+}
+
+void HapticScheduler::clearProximity( HapticDevice d )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    device( d ).proximityActive = false;
+}
+
+void HapticScheduler::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_running = false;
+    }
+    m_wake.notify_one();
+    if ( m_worker.joinable() )
+    {
+        m_worker.join();
+    }
+}
+
+unsigned long long HapticScheduler::triggeredPulses() const
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_triggeredPulses;
+}
+
+unsigned long long HapticScheduler::droppedPulses() const
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_droppedPulses;
+}
+
+HapticPulse HapticScheduler::proximityPulse( float intensity )
+{
+    // Half on, half off so the repetition rate is noticeable.
+    using Seconds = std::chrono::duration<float>;
+    const auto period
+        = std::chrono::duration_cast<Seconds>( proximityPeriod( intensity ) );
+    return { period.count() / 2,
+             k_proximityMinFrequency
+                 + ( k_proximityMaxFrequency - k_proximityMinFrequency )
+                       * intensity,
+             k_proximityMinAmplitude
+                 + ( k_proximityMaxAmplitude - k_proximityMinAmplitude )
+                       * intensity };
+}
+
+HapticScheduler::Clock::duration
+    HapticScheduler::proximityPeriod( float intensity )
+{
+    const auto range = k_proximityMaxPeriod - k_proximityMinPeriod;
+    return std::chrono::duration_cast<Clock::duration>(
+        k_proximityMaxPeriod
+        - std::chrono::duration_cast<Clock::duration>( range ) * intensity );
+}
+
+void HapticScheduler::run()
+{
+    std::vector<Trigger> triggers;
+
+    std::unique_lock<std::mutex> lock( m_mutex );
+    while ( m_running )
+    {
+        const auto now = Clock::now();
+        auto wakeAt = Clock::time_point::max();
+
+        for ( auto& state : m_devices )
+        {
+            const bool hasWork
+                = !state.pending.empty() || state.proximityActive;
+            if ( !hasWork )
+            {
+                continue;
+            }
+            if ( now < state.nextAllowed )
+            {
+                wakeAt = std::min( wakeAt, state.nextAllowed );
+                continue;
+            }
+
+            if ( !state.pending.empty() )
+            {
+                triggers.push_back( { state.actionHandle,
+                                      state.inputHandle,
+                                      state.pending.front() } );
+                state.pending.pop_front();
+                state.nextAllowed = now + m_minPulseInterval;
+            }
+            else if ( now >= state.nextProximity )
+            {
+                triggers.push_back( { state.actionHandle,
+                                      state.inputHandle,
+                                      proximityPulse( state.proximity ) } );
+                state.nextAllowed = now + m_minPulseInterval;
+                state.nextProximity
+                    = now + std::max( proximityPeriod( state.proximity ),
+                                      m_minPulseInterval );
+            }
+
+            if ( !state.pending.empty() )
+            {
+                wakeAt = std::min( wakeAt, state.nextAllowed );
+            }
+            else if ( state.proximityActive )
+            {
+                wakeAt = std::min(
+                    wakeAt,
+                    std::max( state.nextAllowed, state.nextProximity ) );
+            }
+        }
+
+        if ( !triggers.empty() )
+        {
+            m_triggeredPulses += triggers.size();
+            // The runtime call can block, don't hold the lock during it.
+            lock.unlock();
+            for ( const auto& t : triggers )
+            {
+                m_trigger( t.actionHandle,
+                           t.pulse.durationSeconds,
+                           t.pulse.frequency,
+                           t.pulse.amplitude,
+                           t.inputHandle );
+            }
+            triggers.clear();
+            lock.lock();
+            continue;
+        }
+
+        if ( wakeAt == Clock::time_point::max() )
+        {
+            m_wake.wait( lock );
+        }
+        else
+        {
+            m_wake.wait_until( lock, wakeAt );
+        }
+    }
+}
+
+} // namespace utils
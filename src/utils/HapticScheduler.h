@@ -0,0 +1,140 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <openvr.h>
+
+namespace utils
+{
+enum class HapticDevice
+{
+    Left = 0,
+    Right = 1,
+    LAST_ENUMERATOR,
+};
+
+struct HapticPulse
+{
+    float durationSeconds = 0.0f;
+    float frequency = 0.0f;
+    float amplitude = 0.0f;
+
+    bool operator==( const HapticPulse& other ) const noexcept
+    {
+        return durationSeconds == other.durationSeconds
+               && frequency == other.frequency && amplitude == other.amplitude;
+    }
+};
+
+/*!
+   \brief Queues haptic pulses per device and sends them to the runtime on
+   its own worker thread.
+
+   Two kinds of pulses exist: one shot pulses added with \c queuePulse, and a
+   repeating proximity pulse whose amplitude, frequency and repetition rate
+   scale with the intensity set through \c setProximity. One shot pulses take
+   priority over the proximity pulse.
+
+   Consecutive calls to the runtime for the same device are spaced at least
+   \c minPulseInterval apart. Identical pulses queued while one is still
+   pending are dropped instead of piling up.
+ */
+class HapticScheduler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using TriggerFunction = std::function<void( vr::VRActionHandle_t,
+                                                float durationSeconds,
+                                                float frequency,
+                                                float amplitude,
+                                                vr::VRInputValueHandle_t )>;
+
+    // One frame at 90 Hz, the runtime doesn't process haptic events faster.
+    static constexpr std::chrono::milliseconds k_defaultMinPulseInterval{ 11 };
+    static constexpr size_t k_maxQueuedPulses = 8;
+
+    // Proximity envelope, from barely inside the activation distance (0.0)
+    // to touching the bounds (1.0). Haptic frequency range is 0-320 Hz.
+    static constexpr float k_proximityMinAmplitude = 0.2f;
+    static constexpr float k_proximityMaxAmplitude = 0.8f;
+    static constexpr float k_proximityMinFrequency = 80.0f;
+    static constexpr float k_proximityMaxFrequency = 200.0f;
+    static constexpr std::chrono::milliseconds k_proximityMaxPeriod{ 200 };
+    static constexpr std::chrono::milliseconds k_proximityMinPeriod{ 50 };
+
+    explicit HapticScheduler( TriggerFunction trigger,
+                              std::chrono::milliseconds minPulseInterval
+                              = k_defaultMinPulseInterval );
+    ~HapticScheduler();
+
+    HapticScheduler( const HapticScheduler& ) = delete;
+    HapticScheduler& operator=( const HapticScheduler& ) = delete;
+
+    void setActionHandle( HapticDevice device, vr::VRActionHandle_t handle );
+    void setInputHandle( HapticDevice device, vr::VRInputValueHandle_t handle );
+
+    void queuePulse( HapticDevice device, const HapticPulse& pulse );
+
+    /*!
+       \brief Starts or updates the proximity pulses for \a device.
+       \param intensity From 0.0 (weakest) to 1.0 (strongest and most
+       frequent).
+     */
+    void setProximity( HapticDevice device, float intensity );
+    void clearProximity( HapticDevice device );
+
+    /*!
+       \brief Stops the worker thread. Pending pulses are discarded.
+     */
+    void stop();
+
+    unsigned long long triggeredPulses() const;
+    unsigned long long droppedPulses() const;
+
+    static HapticPulse proximityPulse( float intensity );
+    static Clock::duration proximityPeriod( float intensity );
+
+private:
+    struct DeviceState
+    {
+        vr::VRActionHandle_t actionHandle = vr::k_ulInvalidActionHandle;
+        vr::VRInputValueHandle_t inputHandle = vr::k_ulInvalidInputValueHandle;
+        std::deque<HapticPulse> pending;
+        bool proximityActive = false;
+        float proximity = 0.0f;
+        Clock::time_point nextAllowed = {};
+        Clock::time_point nextProximity = {};
+    };
+
+    struct Trigger
+    {
+        vr::VRActionHandle_t actionHandle;
+        vr::VRInputValueHandle_t inputHandle;
+        HapticPulse pulse;
+    };
+
+    void run();
+
+    DeviceState& device( HapticDevice device );
+
+    TriggerFunction m_trigger;
+    const Clock::duration m_minPulseInterval;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wake;
+    bool m_running = true;
+    std::array<DeviceState,
+               static_cast<size_t>( HapticDevice::LAST_ENUMERATOR )>
+        m_devices;
+    unsigned long long m_triggeredPulses = 0;
+    unsigned long long m_droppedPulses = 0;
+
+    std::thread m_worker;
+};
+
+} // namespace utils
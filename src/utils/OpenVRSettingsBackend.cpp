@@ -0,0 +1,95 @@
+#include "VRSettingsCache.h"
+#include <openvr.h>
+#include <easylogging++.h>
+
+namespace utils
+{
+namespace
+{
+// Same limit the audio tab used for device ids.
+constexpr uint32_t k_maxStringSettingLength = 1024;
+
+bool logSettingsError( const char* action,
+                       const std::string& key,
+                       const vr::EVRSettingsError error )
+{
+    if ( error == vr::VRSettingsError_None )
+    {
+        return false;
+    }
+    LOG( WARNING ) << "Could not " << action << " \"" << key
+                   << "\" setting: "
+                   << vr::VRSettings()->GetSettingsErrorNameFromEnum( error );
+    return true;
+}
+
+} // namespace
+
+std::optional<VRSettingValue>
+    OpenVRSettingsBackend::read( const std::string& section,
+                                 const std::string& key,
+                                 VRSettingType type )
+{
+    vr::EVRSettingsError error = vr::VRSettingsError_None;
+    VRSettingValue value;
+
+    switch ( type )
+    {
+    case VRSettingType::Bool:
+        value
+            = vr::VRSettings()->GetBool( section.c_str(), key.c_str(), &error );
+        break;
+    case VRSettingType::Int32:
+        value = static_cast<int>( vr::VRSettings()->GetInt32(
+            section.c_str(), key.c_str(), &error ) );
+        break;
+    case VRSettingType::Float:
+        value = vr::VRSettings()->GetFloat(
+            section.c_str(), key.c_str(), &error );
+        break;
+    case VRSettingType::String:
+    {
+        char buffer[k_maxStringSettingLength];
+        vr::VRSettings()->GetString(
+            section.c_str(), key.c_str(), buffer, sizeof( buffer ), &error );
+        value = std::string( error == vr::VRSettingsError_None ? buffer
+                                                               : "" );
+        break;
+    }
+    }
+
+    if ( logSettingsError( "read", key, error ) )
+    {
+        return std::nullopt;
+    }
+    return value;
+}
+
+bool OpenVRSettingsBackend::write( const std::string& section,
+                                   const std::string& key,
+                                   const VRSettingValue& value )
+{
+    vr::EVRSettingsError error = vr::VRSettingsError_None;
+
+    if ( const auto b = std::get_if<bool>( &value ) )
+    {
+        vr::VRSettings()->SetBool( section.c_str(), key.c_str(), *b, &error );
+    }
+    else if ( const auto i = std::get_if<int>( &value ) )
+    {
+        vr::VRSettings()->SetInt32( section.c_str(), key.c_str(), *i, &error );
+    }
+    else if ( const auto f = std::get_if<float>( &value ) )
+    {
+        vr::VRSettings()->SetFloat( section.c_str(), key.c_str(), *f, &error );
+    }
+    else if ( const auto s = std::get_if<std::string>( &value ) )
+    {
+        vr::VRSettings()->SetString(
+            section.c_str(), key.c_str(), s->c_str(), &error );
+    }
+
+    return !logSettingsError( "write", key, error );
+}
+
+} // namespace utils
@@ -0,0 +1,93 @@
+#include "StartupProfiler.h"
+#include <iomanip>
+#include <sstream>
+
+namespace
+{
+double milliseconds( const utils::StartupProfiler::Clock::duration d )
+{
+    return std::chrono::duration<double, std::milli>( d ).count();
+}
+
+} // namespace
+
+namespace utils
+{
+StartupProfiler::StartupProfiler( const Clock::time_point start )
+    : m_start( start ), m_last( start )
+{
+}
+
+void StartupProfiler::mark( std::string phase, const Clock::time_point now )
+{
+    if ( m_finished )
+    {
+        return;
+    }
+    m_phases.push_back( { std::move( phase ), now - m_last } );
+    m_last = now;
+}
+
+void StartupProfiler::finish( std::string phase, const Clock::time_point now )
+{
+    mark( std::move( phase ), now );
+    m_finished = true;
+}
+
+void StartupProfiler::deferred( std::string task,
+                                const Clock::duration duration )
+{
+    m_deferred.push_back( { std::move( task ), duration } );
+}
+
+bool StartupProfiler::finished() const noexcept
+{
+    return m_finished;
+}
+
+const std::vector<StartupProfiler::Phase>&
+    StartupProfiler::phases() const noexcept
+{
+    return m_phases;
+}
+
+StartupProfiler::Clock::duration StartupProfiler::total() const noexcept
+{
+    return m_last - m_start;
+}
+
+std::string StartupProfiler::report() const
+{
+    std::ostringstream out;
+    out << std::fixed << std::setprecision( 1 );
+    for ( const auto& phase : m_phases )
+    {
+        out << phase.name << ": " << milliseconds( phase.duration ) << " ms, ";
+    }
+    out << "total: " << milliseconds( total() ) << " ms";
+    return out.str();
+}
+
+std::string StartupProfiler::deferredReport() const
+{
+    std::ostringstream out;
+    out << std::fixed << std::setprecision( 1 );
+    Clock::duration sum{};
+    for ( const auto& task : m_deferred )
+    {
+        out << task.name << ": " << milliseconds( task.duration ) << " ms, ";
+        sum += task.duration;
+    }
+    out << "deferred: " << milliseconds( sum )
+        << " ms, first tick without deferring: "
+        << milliseconds( total() + sum ) << " ms";
+    return out.str();
+}
+
+StartupProfiler& startupProfiler()
+{
+    static StartupProfiler profiler;
+    return profiler;
+}
+
+} // namespace utils
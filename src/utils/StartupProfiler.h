@@ -0,0 +1,66 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace utils
+{
+/*!
+   \brief Measures how long each phase of the application startup takes.
+
+   Every call to \c mark ends the phase that started with the previous mark
+   (or at construction). \c finish ends the last phase and stops recording,
+   later marks are ignored.
+
+   Work moved behind the first tick is recorded with \c deferred. It used
+   to run before the first tick, so the report of it also gives the time
+   to the first tick without deferring, for comparison.
+ */
+class StartupProfiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Phase
+    {
+        std::string name;
+        Clock::duration duration;
+    };
+
+    explicit StartupProfiler( Clock::time_point start = Clock::now() );
+
+    void mark( std::string phase, Clock::time_point now = Clock::now() );
+    void finish( std::string phase, Clock::time_point now = Clock::now() );
+
+    void deferred( std::string task, Clock::duration duration );
+
+    bool finished() const noexcept;
+    const std::vector<Phase>& phases() const noexcept;
+    Clock::duration total() const noexcept;
+
+    /*!
+       \brief One line with every phase and the total, in milliseconds.
+     */
+    std::string report() const;
+
+    /*!
+       \brief One line with every deferred task, their sum and the total
+       they would have added to, in milliseconds.
+     */
+    std::string deferredReport() const;
+
+private:
+    Clock::time_point m_start;
+    Clock::time_point m_last;
+    std::vector<Phase> m_phases;
+    std::vector<Phase> m_deferred;
+    bool m_finished = false;
+};
+
+/*!
+   \brief The profiler for this process, started at its first use.
+ */
+StartupProfiler& startupProfiler();
+
+} // namespace utils
@@ -0,0 +1,379 @@
+#include "TaskScheduler.h"
+#include <algorithm>
+#include <utility>
+
+namespace utils
+{
+namespace
+{
+constexpr std::uint64_t k_slotMask = TaskScheduler::k_slots - 1;
+
+constexpr unsigned shiftOf( const std::size_t level ) noexcept
+{
+    return static_cast<unsigned>( TaskScheduler::k_slotBits * level );
+}
+
+// Index of the first set bit at or after \a start, wrapping around.
+unsigned nextOccupied( const std::uint64_t occupied, const unsigned start )
+{
+    auto rotated = start == 0 ? occupied
+                              : ( occupied >> start )
+                                    | ( occupied << ( 64 - start ) );
+    unsigned offset = 0;
+    while ( ( rotated & 1 ) == 0 )
+    {
+        rotated >>= 1;
+        ++offset;
+    }
+    return offset;
+}
+
+} // namespace
+
+TaskScheduler::TaskScheduler( std::size_t workers ) : m_start( Clock::now() )
+{
+    workers = std::max<std::size_t>( workers, 1 );
+    for ( std::size_t i = 0; i < workers; ++i )
+    {
+        m_workers.emplace_back( &TaskScheduler::runJobs, this );
+    }
+    m_timerThread = std::thread( &TaskScheduler::runTimers, this );
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    stop();
+}
+
+void TaskScheduler::post( Task task )
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        if ( !m_running )
+        {
+            return;
+        }
+        m_jobs.push_back( { 0, std::move( task ) } );
+    }
+    m_jobsQueued.notify_one();
+}
+
+void TaskScheduler::postBlocking( Task task )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if ( !m_running )
+    {
+        return;
+    }
+    // Threads of earlier calls that returned are done with.
+    const auto finished = std::remove_if(
+        m_blockingThreads.begin(),
+        m_blockingThreads.end(),
+        []( BlockingThread& t ) {
+            if ( !*t.done )
+            {
+                return false;
+            }
+            t.thread.join();
+            return true;
+        } );
+    m_blockingThreads.erase( finished, m_blockingThreads.end() );
+
+    auto done = std::make_shared<std::atomic<bool>>( false );
+    m_blockingThreads.push_back(
+        { std::thread( [task = std::move( task ), done] {
+              task();
+              *done = true;
+          } ),
+          done } );
+}
+
+TaskScheduler::TaskId TaskScheduler::scheduleAfter( Clock::duration delay,
+                                                    Task task )
+{
+    return add(
+        Clock::now() + delay, Clock::duration::zero(), std::move( task ) );
+}
+
+TaskScheduler::TaskId TaskScheduler::scheduleAt( Clock::time_point due,
+                                                 Task task )
+{
+    return add( due, Clock::duration::zero(), std::move( task ) );
+}
+
+TaskScheduler::TaskId TaskScheduler::scheduleEvery( Clock::duration period,
+                                                    Task task )
+{
+    period = std::max<Clock::duration>( period, k_tick );
+    return add( Clock::now() + period, period, std::move( task ) );
+}
+
+bool TaskScheduler::cancel( TaskId id )
+{
+    if ( id == 0 )
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock( m_mutex );
+    // Its slot entry is skipped when the slot is reached.
+    const auto cancelled = m_timers.erase( id ) > 0;
+    // Due, but not picked up by a worker yet.
+    const auto job
+        = std::find_if( m_jobs.begin(), m_jobs.end(), [id]( const Job& j ) {
+              return j.id == id;
+          } );
+    if ( job == m_jobs.end() )
+    {
+        return cancelled;
+    }
+    m_jobs.erase( job );
+    return true;
+}
+
+void TaskScheduler::stop()
+{
+    std::unordered_map<TaskId, Timer> timers;
+    std::deque<Job> jobs;
+    std::vector<BlockingThread> blockingThreads;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_running = false;
+        // Destroyed after unlocking, their captures may run anything.
+        timers.swap( m_timers );
+        jobs.swap( m_jobs );
+        blockingThreads.swap( m_blockingThreads );
+        m_levels = {};
+    }
+    m_timersChanged.notify_all();
+    m_jobsQueued.notify_all();
+
+    if ( m_timerThread.joinable() )
+    {
+        m_timerThread.join();
+    }
+    for ( auto& worker : m_workers )
+    {
+        if ( worker.joinable() )
+        {
+            worker.join();
+        }
+    }
+    for ( auto& t : blockingThreads )
+    {
+        t.thread.join();
+    }
+}
+
+std::size_t TaskScheduler::pendingTimers() const
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_timers.size();
+}
+
+unsigned long long TaskScheduler::completedTasks() const
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_completedTasks;
+}
+
+TaskScheduler::TaskId TaskScheduler::add( Clock::time_point due,
+                                          Clock::duration period,
+                                          Task task )
+{
+    TaskId id = 0;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        if ( !m_running )
+        {
+            return 0;
+        }
+        id = ++m_lastId;
+        m_timers.emplace( id, Timer{ due, period, std::move( task ) } );
+        place( id, tickOf( due ) );
+    }
+    m_timersChanged.notify_one();
+    return id;
+}
+
+std::uint64_t TaskScheduler::tickOf( Clock::time_point time ) const
+{
+    if ( time <= m_start )
+    {
+        return 0;
+    }
+    // Rounded up, never early.
+    const auto elapsed = time - m_start;
+    return static_cast<std::uint64_t>(
+        ( elapsed + k_tick - Clock::duration{ 1 } ) / k_tick );
+}
+
+void TaskScheduler::place( TaskId id, std::uint64_t dueTick )
+{
+    // Overdue timers go to the next processed tick. Timers beyond the top
+    // level wait in its furthest slot and are placed again from there.
+    constexpr auto maxDelta = ( std::uint64_t{ 1 } << shiftOf( k_levels ) ) - 1;
+    const auto delta
+        = std::min( dueTick > m_tick ? dueTick - m_tick : 0, maxDelta );
+
+    std::size_t level = 0;
+    while ( level + 1 < k_levels
+            && delta >= ( std::uint64_t{ 1 } << shiftOf( level + 1 ) ) )
+    {
+        ++level;
+    }
+    const auto slot = ( ( m_tick + delta ) >> shiftOf( level ) ) & k_slotMask;
+    m_levels[level].entries[slot].push_back( id );
+    m_levels[level].occupied |= std::uint64_t{ 1 } << slot;
+}
+
+std::optional<std::uint64_t> TaskScheduler::nextTick() const
+{
+    std::optional<std::uint64_t> next;
+    for ( std::size_t level = 0; level < k_levels; ++level )
+    {
+        const auto occupied = m_levels[level].occupied;
+        if ( occupied == 0 )
+        {
+            continue;
+        }
+        // Slots of higher levels are reached at the start of their span, the
+        // first one not processed yet is at or after m_tick.
+        const auto shift = shiftOf( level );
+        const auto first
+            = ( m_tick + ( std::uint64_t{ 1 } << shift ) - 1 ) >> shift;
+        const auto offset = nextOccupied(
+            occupied, static_cast<unsigned>( first & k_slotMask ) );
+        const auto tick = ( first + offset ) << shift;
+        if ( !next || tick < *next )
+        {
+            next = tick;
+        }
+    }
+    return next;
+}
+
+void TaskScheduler::processTick( std::uint64_t tick )
+{
+    m_tick = tick;
+    // Top down, a timer may move through several levels in one tick.
+    for ( auto level = k_levels - 1; level > 0; --level )
+    {
+        const auto shift = shiftOf( level );
+        if ( ( tick & ( ( std::uint64_t{ 1 } << shift ) - 1 ) ) != 0 )
+        {
+            continue;
+        }
+        const auto slot = ( tick >> shift ) & k_slotMask;
+        const auto ids = std::move( m_levels[level].entries[slot] );
+        m_levels[level].entries[slot].clear();
+        m_levels[level].occupied &= ~( std::uint64_t{ 1 } << slot );
+        for ( const auto id : ids )
+        {
+            const auto timer = m_timers.find( id );
+            if ( timer != m_timers.end() )
+            {
+                place( id, tickOf( timer->second.due ) );
+            }
+        }
+    }
+
+    const auto slot = tick & k_slotMask;
+    const auto ids = std::move( m_levels[0].entries[slot] );
+    m_levels[0].entries[slot].clear();
+    m_levels[0].occupied &= ~( std::uint64_t{ 1 } << slot );
+    m_tick = tick + 1;
+    for ( const auto id : ids )
+    {
+        expire( id );
+    }
+}
+
+void TaskScheduler::expire( TaskId id )
+{
+    const auto found = m_timers.find( id );
+    if ( found == m_timers.end() )
+    {
+        return;
+    }
+    auto& timer = found->second;
+    if ( timer.period == Clock::duration::zero() )
+    {
+        m_jobs.push_back( { id, std::move( timer.task ) } );
+        m_timers.erase( found );
+        return;
+    }
+
+    if ( !timer.running )
+    {
+        timer.running = true;
+        m_jobs.push_back( { id, timer.task } );
+    }
+    // The next multiple of the period that is still ahead.
+    const auto now = Clock::now();
+    do
+    {
+        timer.due += timer.period;
+    } while ( timer.due <= now );
+    place( id, tickOf( timer.due ) );
+}
+
+void TaskScheduler::runTimers()
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    while ( m_running )
+    {
+        const auto next = nextTick();
+        if ( !next )
+        {
+            m_timersChanged.wait( lock );
+            continue;
+        }
+        const auto due
+            = m_start
+              + std::chrono::duration_cast<Clock::duration>( k_tick )
+                    * static_cast<Clock::rep>( *next );
+        if ( Clock::now() < due )
+        {
+            // Woken early when a timer is added, it may be due sooner.
+            m_timersChanged.wait_until( lock, due );
+            continue;
+        }
+
+        const auto queued = m_jobs.size();
+        processTick( *next );
+        if ( m_jobs.size() > queued )
+        {
+            m_jobsQueued.notify_all();
+        }
+    }
+}
+
+void TaskScheduler::runJobs()
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    while ( true )
+    {
+        m_jobsQueued.wait(
+            lock, [this] { return !m_running || !m_jobs.empty(); } );
+        if ( !m_running )
+        {
+            return;
+        }
+        auto job = std::move( m_jobs.front() );
+        m_jobs.pop_front();
+
+        lock.unlock();
+        job.task();
+        job.task = nullptr;
+        lock.lock();
+
+        ++m_completedTasks;
+        if ( const auto timer = m_timers.find( job.id );
+             timer != m_timers.end() )
+        {
+            timer->second.running = false;
+        }
+    }
+}
+
+} // namespace utils
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace utils
+{
+/*!
+   \brief Runs tasks after a delay, at a time or periodically, on a small pool
+   of worker threads.
+
+   Timers are kept in a hierarchical timer wheel: \c k_levels levels of
+   \c k_slots slots, a level 0 slot is one \c k_tick long and a slot of every
+   other level spans a whole turn of the level below. Adding and cancelling a
+   timer takes constant time, timers are never early and at most one tick
+   late. The timer thread sleeps until the next occupied slot instead of
+   ticking.
+
+   Due tasks are run by the workers, so a task blocking on the runtime only
+   holds up the tasks behind it once every worker is busy. Calls that wait
+   for the user, like modal messages, go to \c postBlocking instead and
+   never take a worker. Tasks must not use
+   Qt objects living in another thread directly, they post to them instead.
+ */
+class TaskScheduler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using Task = std::function<void()>;
+    // 0 is never returned, it can be used for "no task".
+    using TaskId = std::uint64_t;
+
+    static constexpr std::chrono::milliseconds k_tick{ 10 };
+    static constexpr unsigned k_slotBits = 6;
+    static constexpr std::size_t k_slots = std::size_t{ 1 } << k_slotBits;
+    // 64^4 ticks, about 5 years. Later timers wait at the top level.
+    static constexpr std::size_t k_levels = 4;
+    // Two, so one slow call to the runtime doesn't delay every timer.
+    static constexpr std::size_t k_defaultWorkers = 2;
+
+    explicit TaskScheduler( std::size_t workers = k_defaultWorkers );
+    ~TaskScheduler();
+
+    TaskScheduler( const TaskScheduler& ) = delete;
+    TaskScheduler& operator=( const TaskScheduler& ) = delete;
+
+    /*!
+       \brief Runs \a task on a worker as soon as one is free.
+     */
+    void post( Task task );
+
+    /*!
+       \brief Runs \a task on a thread of its own, for calls that may block
+       for as long as the user is away. \c stop waits for it, the caller
+       has to make it return first.
+     */
+    void postBlocking( Task task );
+
+    TaskId scheduleAfter( Clock::duration delay, Task task );
+    TaskId scheduleAt( Clock::time_point due, Task task );
+
+    /*!
+       \brief Runs \a task every \a period, the first time one \a period from
+       now.
+
+       Runs are due at multiples of \a period, late runs don't delay the
+       following ones. A run that is due while the previous one hasn't
+       finished is skipped.
+     */
+    TaskId scheduleEvery( Clock::duration period, Task task );
+
+    /*!
+       \brief Cancels a timer, a periodic one isn't run again. A run that
+       already started isn't interrupted.
+       \return False if \a id is unknown or a one shot task already started.
+     */
+    bool cancel( TaskId id );
+
+    /*!
+       \brief Stops the timer thread and the workers. Pending timers and
+       tasks are discarded, running tasks are waited for.
+     */
+    void stop();
+
+    std::size_t pendingTimers() const;
+    unsigned long long completedTasks() const;
+
+private:
+    struct Timer
+    {
+        Clock::time_point due;
+        // Zero for one shot timers.
+        Clock::duration period;
+        Task task;
+        bool running = false;
+    };
+
+    struct Job
+    {
+        // 0 for posted tasks.
+        TaskId id;
+        Task task;
+    };
+
+    struct BlockingThread
+    {
+        std::thread thread;
+        std::shared_ptr<std::atomic<bool>> done;
+    };
+
+    struct Level
+    {
+        std::array<std::vector<TaskId>, k_slots> entries;
+        // Bit n is set while slot n holds a timer.
+        std::uint64_t occupied = 0;
+    };
+
+    void runTimers();
+    void runJobs();
+
+    TaskId add( Clock::time_point due, Clock::duration period, Task task );
+    std::uint64_t tickOf( Clock::time_point time ) const;
+    void place( TaskId id, std::uint64_t dueTick );
+    std::optional<std::uint64_t> nextTick() const;
+    void processTick( std::uint64_t tick );
+    void expire( TaskId id );
+
+    const Clock::time_point m_start;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_timersChanged;
+    std::condition_variable m_jobsQueued;
+    bool m_running = true;
+
+    std::array<Level, k_levels> m_levels;
+    // Ticks before this one are processed.
+    std::uint64_t m_tick = 0;
+    TaskId m_lastId = 0;
+    std::unordered_map<TaskId, Timer> m_timers;
+    std::deque<Job> m_jobs;
+    unsigned long long m_completedTasks = 0;
+
+    std::vector<std::thread> m_workers;
+    std::thread m_timerThread;
+    std::vector<BlockingThread> m_blockingThreads;
+};
+
+} // namespace utils
@@ -0,0 +1,280 @@
+#include "VRSettingsCache.h"
+#include <algorithm>
+
+namespace utils
+{
+VRSettingsCache::VRSettingsCache( std::unique_ptr<VRSettingsBackend> backend )
+    : m_backend( std::move( backend ) )
+{
+}
+
+void VRSettingsCache::setPollIntervals( unsigned minPollIntervalTicks,
+                                        unsigned maxPollIntervalTicks )
+{
+    m_minPollIntervalTicks = std::max( minPollIntervalTicks, 1u );
+    m_maxPollIntervalTicks
+        = std::max( maxPollIntervalTicks, m_minPollIntervalTicks );
+    m_pollIntervalTicks = m_minPollIntervalTicks;
+}
+
+VRSettingsCache::Entry& VRSettingsCache::entry( const std::string& section,
+                                                const std::string& key,
+                                                VRSettingType type )
+{
+    const auto entryKey = EntryKey{ section, key };
+    const auto it = m_entryIndices.find( entryKey );
+    if ( it != m_entryIndices.end() )
+    {
+        return m_entries[it->second];
+    }
+
+    m_entryIndices.emplace( entryKey, m_entries.size() );
+    m_entries.push_back( { section, key, type, std::nullopt, {} } );
+    return m_entries.back();
+}
+
+unsigned long long VRSettingsCache::watch( const std::string& section,
+                                           const std::string& key,
+                                           VRSettingType type,
+                                           Callback callback,
+                                           ReadErrorCallback onReadError )
+{
+    auto& e = entry( section, key, type );
+    const auto id = ++m_lastId;
+    e.subscribers.push_back( { id, callback, onReadError } );
+
+    // Keys watched by several controllers are only read once.
+    if ( !e.value )
+    {
+        ++m_runtimeReads;
+        e.value = m_backend->read( section, key, type );
+    }
+    if ( e.value )
+    {
+        callback( *e.value );
+    }
+    else if ( onReadError )
+    {
+        onReadError();
+    }
+
+    return id;
+}
+
+unsigned long long
+    VRSettingsCache::watchBool( const std::string& section,
+                                const std::string& key,
+                                std::function<void( bool )> callback )
+{
+    return watch( section,
+                  key,
+                  VRSettingType::Bool,
+                  [callback]( const VRSettingValue& v ) {
+                      callback( std::get<bool>( v ) );
+                  } );
+}
+
+unsigned long long
+    VRSettingsCache::watchInt32( const std::string& section,
+                                 const std::string& key,
+                                 std::function<void( int )> callback )
+{
+    return watch( section,
+                  key,
+                  VRSettingType::Int32,
+                  [callback]( const VRSettingValue& v ) {
+                      callback( std::get<int>( v ) );
+                  } );
+}
+
+unsigned long long
+    VRSettingsCache::watchFloat( const std::string& section,
+                                 const std::string& key,
+                                 std::function<void( float )> callback,
+                                 ReadErrorCallback onReadError )
+{
+    return watch(
+        section,
+        key,
+        VRSettingType::Float,
+        [callback]( const VRSettingValue& v ) {
+            callback( std::get<float>( v ) );
+        },
+        onReadError );
+}
+
+unsigned long long VRSettingsCache::watchString(
+    const std::string& section,
+    const std::string& key,
+    std::function<void( const std::string& )> callback )
+{
+    return watch( section,
+                  key,
+                  VRSettingType::String,
+                  [callback]( const VRSettingValue& v ) {
+                      callback( std::get<std::string>( v ) );
+                  } );
+}
+
+void VRSettingsCache::unwatch( unsigned long long id )
+{
+    for ( auto& e : m_entries )
+    {
+        const auto it = std::find_if(
+            e.subscribers.begin(),
+            e.subscribers.end(),
+            [id]( const Subscriber& s ) { return s.id == id; } );
+        if ( it != e.subscribers.end() )
+        {
+            e.subscribers.erase( it );
+            return;
+        }
+    }
+}
+
+void VRSettingsCache::updateValue( Entry& e, const VRSettingValue& value )
+{
+    if ( e.value == value )
+    {
+        return;
+    }
+    e.value = value;
+
+    // Callbacks may watch new keys, which can reallocate m_entries.
+    const auto subscribers = e.subscribers;
+    for ( const auto& s : subscribers )
+    {
+        s.callback( value );
+    }
+}
+
+void VRSettingsCache::readFailed( const Entry& e )
+{
+    const auto subscribers = e.subscribers;
+    for ( const auto& s : subscribers )
+    {
+        if ( s.onReadError )
+        {
+            s.onReadError();
+        }
+    }
+}
+
+void VRSettingsCache::set( const std::string& section,
+                           const std::string& key,
+                           const VRSettingValue& value )
+{
+    auto& e
+        = entry( section, key, static_cast<VRSettingType>( value.index() ) );
+    // Not counted as coalesced, no write was saved. Most of these are
+    // subscribers handing the value they were just called with to a setter.
+    if ( e.value == value )
+    {
+        return;
+    }
+
+    const auto inserted
+        = m_pendingWrites.insert_or_assign( EntryKey{ section, key }, value )
+              .second;
+    if ( !inserted )
+    {
+        ++m_coalescedWrites;
+    }
+
+    updateValue( e, value );
+}
+
+std::vector<VRSettingEntry> VRSettingsCache::watchedValues() const
+{
+    std::vector<VRSettingEntry> values;
+    for ( const auto& e : m_entries )
+    {
+        if ( !e.subscribers.empty() && e.value )
+        {
+            values.push_back( { e.section, e.key, e.type, *e.value } );
+        }
+    }
+    return values;
+}
+
+void VRSettingsCache::requestPoll() noexcept
+{
+    m_pollRequested = true;
+}
+
+void VRSettingsCache::flushWrites()
+{
+    for ( const auto& [entryKey, value] : m_pendingWrites )
+    {
+        ++m_runtimeWrites;
+        m_backend->write( entryKey.first, entryKey.second, value );
+    }
+    m_pendingWrites.clear();
+}
+
+void VRSettingsCache::tick()
+{
+    flushWrites();
+
+    if ( ++m_ticksSincePoll < m_pollIntervalTicks && !m_pollRequested )
+    {
+        return;
+    }
+    poll();
+}
+
+void VRSettingsCache::poll()
+{
+    flushWrites();
+
+    m_ticksSincePoll = 0;
+    m_pollRequested = false;
+
+    auto changed = false;
+    for ( std::size_t i = 0; i < m_entries.size(); ++i )
+    {
+        if ( m_entries[i].subscribers.empty() )
+        {
+            continue;
+        }
+
+        ++m_runtimeReads;
+        const auto value = m_backend->read(
+            m_entries[i].section, m_entries[i].key, m_entries[i].type );
+        if ( !value )
+        {
+            readFailed( m_entries[i] );
+        }
+        else if ( m_entries[i].value != value )
+        {
+            changed = true;
+            updateValue( m_entries[i], *value );
+        }
+    }
+
+    m_pollIntervalTicks
+        = changed ? m_minPollIntervalTicks
+                  : std::min( m_pollIntervalTicks * 2, m_maxPollIntervalTicks );
+}
+
+unsigned long long VRSettingsCache::runtimeReads() const noexcept
+{
+    return m_runtimeReads;
+}
+
+unsigned long long VRSettingsCache::runtimeWrites() const noexcept
+{
+    return m_runtimeWrites;
+}
+
+unsigned long long VRSettingsCache::coalescedWrites() const noexcept
+{
+    return m_coalescedWrites;
+}
+
+unsigned VRSettingsCache::pollIntervalTicks() const noexcept
+{
+    return m_pollIntervalTicks;
+}
+
+} // namespace utils
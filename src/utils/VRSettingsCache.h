@@ -0,0 +1,206 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace utils
+{
+using VRSettingValue = std::variant<bool, int, float, std::string>;
+
+enum class VRSettingType
+{
+    Bool = 0,
+    Int32 = 1,
+    Float = 2,
+    String = 3,
+};
+
+struct VRSettingEntry
+{
+    std::string section;
+    std::string key;
+    VRSettingType type;
+    VRSettingValue value;
+};
+
+/*!
+   \brief Access to the runtime settings, vr::VRSettings() in the application.
+ */
+class VRSettingsBackend
+{
+public:
+    virtual ~VRSettingsBackend() = default;
+
+    /*!
+       \return No value if the setting could not be read.
+     */
+    virtual std::optional<VRSettingValue> read( const std::string& section,
+                                                const std::string& key,
+                                                VRSettingType type )
+        = 0;
+
+    virtual bool write( const std::string& section,
+                        const std::string& key,
+                        const VRSettingValue& value )
+        = 0;
+};
+
+class OpenVRSettingsBackend final : public VRSettingsBackend
+{
+public:
+    std::optional<VRSettingValue> read( const std::string& section,
+                                        const std::string& key,
+                                        VRSettingType type ) override;
+
+    bool write( const std::string& section,
+                const std::string& key,
+                const VRSettingValue& value ) override;
+};
+
+/*!
+   \brief Shadow copy of the runtime settings we display or react to.
+
+   Watched keys are polled together in one pass from \c tick. The poll
+   interval starts at \c minPollIntervalTicks, doubles after every pass that
+   finds no change up to \c maxPollIntervalTicks, and drops back to the
+   minimum as soon as a change is seen. Subscribers are only called when a
+   value changes.
+
+   Writes through \c set update the cache immediately and are sent to the
+   runtime on the next tick. Several writes to the same key in between
+   result in one runtime call. Writing the cached value does nothing, so a
+   subscriber may pass the value it was called with on to a setter that
+   writes it.
+ */
+class VRSettingsCache
+{
+public:
+    using Callback = std::function<void( const VRSettingValue& )>;
+    using ReadErrorCallback = std::function<void()>;
+
+    static constexpr unsigned k_defaultMinPollIntervalTicks = 89;
+    static constexpr unsigned k_defaultMaxPollIntervalTicks = 89 * 8;
+
+    explicit VRSettingsCache( std::unique_ptr<VRSettingsBackend> backend );
+
+    VRSettingsCache( const VRSettingsCache& ) = delete;
+    VRSettingsCache& operator=( const VRSettingsCache& ) = delete;
+
+    void setPollIntervals( unsigned minPollIntervalTicks,
+                           unsigned maxPollIntervalTicks );
+
+    /*!
+       \brief Calls \a callback with the current value and again every time
+       the value changes. \a onReadError, if set, is called on every read
+       of the key that fails.
+       \return Id for \c unwatch.
+     */
+    unsigned long long watch( const std::string& section,
+                              const std::string& key,
+                              VRSettingType type,
+                              Callback callback,
+                              ReadErrorCallback onReadError = {} );
+
+    unsigned long long watchBool( const std::string& section,
+                                  const std::string& key,
+                                  std::function<void( bool )> callback );
+    unsigned long long watchInt32( const std::string& section,
+                                   const std::string& key,
+                                   std::function<void( int )> callback );
+    unsigned long long watchFloat( const std::string& section,
+                                   const std::string& key,
+                                   std::function<void( float )> callback,
+                                   ReadErrorCallback onReadError = {} );
+    unsigned long long
+        watchString( const std::string& section,
+                     const std::string& key,
+                     std::function<void( const std::string& )> callback );
+
+    void unwatch( unsigned long long id );
+
+    /*!
+       \brief Queues a write of \a value. Subscribers of the key are called
+       if the value changed.
+     */
+    void set( const std::string& section,
+              const std::string& key,
+              const VRSettingValue& value );
+
+    /*!
+       \brief Current values of all watched keys that could be read.
+     */
+    std::vector<VRSettingEntry> watchedValues() const;
+
+    /*!
+       \brief Polls all watched keys on the next \c tick.
+     */
+    void requestPoll() noexcept;
+
+    /*!
+       \brief Reads all watched keys now. Queued writes are made first, so
+       they aren't replaced by the values they overwrite.
+     */
+    void poll();
+
+    void tick();
+
+    /*!
+       \brief Sends all queued writes to the runtime now.
+     */
+    void flushWrites();
+
+    unsigned long long runtimeReads() const noexcept;
+    unsigned long long runtimeWrites() const noexcept;
+    unsigned long long coalescedWrites() const noexcept;
+    unsigned pollIntervalTicks() const noexcept;
+
+private:
+    struct Subscriber
+    {
+        unsigned long long id;
+        Callback callback;
+        ReadErrorCallback onReadError;
+    };
+
+    struct Entry
+    {
+        std::string section;
+        std::string key;
+        VRSettingType type;
+        std::optional<VRSettingValue> value;
+        std::vector<Subscriber> subscribers;
+    };
+
+    using EntryKey = std::pair<std::string, std::string>;
+
+    Entry& entry( const std::string& section,
+                  const std::string& key,
+                  VRSettingType type );
+    void updateValue( Entry& entry, const VRSettingValue& value );
+    void readFailed( const Entry& entry );
+
+    std::unique_ptr<VRSettingsBackend> m_backend;
+
+    std::vector<Entry> m_entries;
+    std::map<EntryKey, std::size_t> m_entryIndices;
+    std::map<EntryKey, VRSettingValue> m_pendingWrites;
+
+    unsigned m_minPollIntervalTicks = k_defaultMinPollIntervalTicks;
+    unsigned m_maxPollIntervalTicks = k_defaultMaxPollIntervalTicks;
+    unsigned m_pollIntervalTicks = k_defaultMinPollIntervalTicks;
+    unsigned m_ticksSincePoll = 0;
+    bool m_pollRequested = false;
+
+    unsigned long long m_lastId = 0;
+    unsigned long long m_runtimeReads = 0;
+    unsigned long long m_runtimeWrites = 0;
+    unsigned long long m_coalescedWrites = 0;
+};
+
+} // namespace utils
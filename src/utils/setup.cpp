@@ -67,6 +67,14 @@ CommandLineOptions returnCommandLineParser( const MyQApplication& application )
                                             k_forceRemoveManifestDescription );
     parser.addOption( forceRemoveManifest );
 
+    QCommandLineOption exportSnapshot(
+        k_exportSnapshot, k_exportSnapshotDescription, "file" );
+    parser.addOption( exportSnapshot );
+
+    QCommandLineOption importSnapshot(
+        k_importSnapshot, k_importSnapshotDescription, "file" );
+    parser.addOption( importSnapshot );
+
     parser.process( application );
 
     const bool desktopModeEnabled = parser.isSet( desktopMode );
@@ -88,11 +96,23 @@ CommandLineOptions returnCommandLineParser( const MyQApplication& application )
     LOG_IF( forceRemoveManifestEnabled, INFO )
         << "Forcing removal of applications manifest.";
 
+    const auto exportSnapshotFile = parser.value( exportSnapshot );
+    LOG_IF( !exportSnapshotFile.isEmpty(), INFO )
+        << "Exporting settings snapshot to '"
+        << exportSnapshotFile.toStdString() << "'.";
+
+    const auto importSnapshotFile = parser.value( importSnapshot );
+    LOG_IF( !importSnapshotFile.isEmpty(), INFO )
+        << "Importing settings snapshot from '"
+        << importSnapshotFile.toStdString() << "'.";
+
     const CommandLineOptions commandLineArgs{ desktopModeEnabled,
                                               forceNoSoundEnabled,
                                               forceNoManifestEnabled,
                                               forceInstallManifestEnabled,
-                                              forceRemoveManifestEnabled };
+                                              forceRemoveManifestEnabled,
+                                              exportSnapshotFile,
+                                              importSnapshotFile };
 
     LOG( INFO ) << "Command line arguments processed.";
 
@@ -26,6 +26,8 @@ struct CommandLineOptions
     const bool forceNoManifest = false;
     const bool forceInstallManifest = false;
     const bool forceRemoveManifest = false;
+    const QString exportSnapshot;
+    const QString importSnapshot;
 };
 
 // Manages the programs control flow and main settings.
@@ -88,6 +90,15 @@ constexpr auto k_forceRemoveManifest = "force-remove-manifest";
 constexpr auto k_forceRemoveManifestDescription
     = "Forces removing the applications manifest. Application will exit early.";
 
+constexpr auto k_exportSnapshot = "export-snapshot";
+constexpr auto k_exportSnapshotDescription
+    = "Writes all settings, profiles and watched SteamVR settings to <file> "
+      "after startup.";
+
+constexpr auto k_importSnapshot = "import-snapshot";
+constexpr auto k_importSnapshotDescription
+    = "Applies a snapshot written with --export-snapshot after startup.";
+
 CommandLineOptions returnCommandLineParser( const MyQApplication& application );
 
 } // namespace argument
@@ -0,0 +1,32 @@
+QT += testlib
+QT -= gui
+CONFIG   += c++1z
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += ELPP_QT_LOGGING \
+    ELPP_THREAD_SAFE
+
+INCLUDEPATH += ../../src/utils \
+    ../../src/settings \
+    ../../src/tabcontrollers \
+    ../../third-party/openvr/headers \
+    ../../third-party/easylogging++
+
+SOURCES +=  tst_geometryblobtest.cpp \
+    ../../src/utils/ChaperoneGeometryBlob.cpp \
+    ../../src/settings/settings_object.cpp \
+    ../../src/settings/profile_list_model.cpp \
+    ../../src/settings/profile_collection.cpp \
+    ../../third-party/easylogging++/easylogging++.cc
+
+HEADERS += \
+    ../../src/utils/ChaperoneGeometryBlob.h \
+    ../../src/settings/settings_object.h \
+    ../../src/settings/profile_store.h \
+    ../../src/settings/profile_list_model.h \
+    ../../src/settings/profile_collection.h \
+    ../../src/settings/internal/settings_object_data.h
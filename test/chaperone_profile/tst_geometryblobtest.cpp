@@ -0,0 +1,412 @@
+#include <QtTest>
+#include <QDebug>
+#include <QFileInfo>
+#include <QSettings>
+#include <QTemporaryDir>
+#include <memory>
+#include "ChaperoneGeometryBlob.h"
+#include "ChaperoneTabController.h"
+#include "profile_store.h"
+
+INITIALIZE_EASYLOGGINGPP
+
+namespace
+{
+std::unique_ptr<QTemporaryDir> g_settingsDir;
+std::unique_ptr<QSettings> g_settings;
+
+} // namespace
+
+namespace settings
+{
+// Stands in for the application settings file.
+QSettings& getQSettings()
+{
+    return *g_settings;
+}
+} // namespace settings
+
+class GeometryBlobTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void roundTrip();
+
+    void emptyGeometry();
+
+    void corruptedBlobIsRejected();
+
+    void truncatedBlobIsRejected();
+
+    void unknownVersionIsRejected();
+
+    void legacyProfileIsMigratedOnSave();
+
+    void storedProfileGeometryIsDecoded();
+
+    void legacyProfilesLoadBenchmarked_data();
+    void legacyProfilesLoadBenchmarked();
+
+    void compactProfilesLoadBenchmarked_data();
+    void compactProfilesLoadBenchmarked();
+};
+
+namespace
+{
+constexpr int k_quadsPerProfile = 64;
+
+utils::ChaperoneGeometry createGeometry( const int quadCount )
+{
+    utils::ChaperoneGeometry g;
+    g.quads.resize( static_cast<size_t>( quadCount ) );
+
+    auto value = 0.0f;
+    for ( auto& quad : g.quads )
+    {
+        for ( auto& corner : quad.vCorners )
+        {
+            for ( auto& v : corner.v )
+            {
+                v = value;
+                value += 0.37f;
+            }
+        }
+    }
+
+    for ( int i = 0; i < 3; ++i )
+    {
+        for ( int j = 0; j < 4; ++j )
+        {
+            g.standingCenter.m[i][j] = static_cast<float>( i * 4 + j ) * 0.5f;
+        }
+    }
+
+    g.playSpaceAreaX = 3.5f;
+    g.playSpaceAreaZ = 2.25f;
+
+    return g;
+}
+
+bool geometryEqual( const utils::ChaperoneGeometry& a,
+                    const utils::ChaperoneGeometry& b )
+{
+    if ( a.quads.size() != b.quads.size() )
+    {
+        return false;
+    }
+    for ( size_t q = 0; q < a.quads.size(); ++q )
+    {
+        for ( int c = 0; c < 4; ++c )
+        {
+            for ( int v = 0; v < 3; ++v )
+            {
+                if ( a.quads[q].vCorners[c].v[v]
+                     != b.quads[q].vCorners[c].v[v] )
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    for ( int i = 0; i < 3; ++i )
+    {
+        for ( int j = 0; j < 4; ++j )
+        {
+            if ( a.standingCenter.m[i][j] != b.standingCenter.m[i][j] )
+            {
+                return false;
+            }
+        }
+    }
+    return a.playSpaceAreaX == b.playSpaceAreaX
+           && a.playSpaceAreaZ == b.playSpaceAreaZ;
+}
+
+advsettings::ChaperoneProfile createProfile( const int number )
+{
+    const auto g = createGeometry( k_quadsPerProfile );
+
+    advsettings::ChaperoneProfile p;
+    p.profileName = "Profile " + std::to_string( number );
+    p.includesChaperoneGeometry = true;
+    p.chaperoneGeometryQuadCount = static_cast<unsigned>( g.quads.size() );
+    p.chaperoneGeometryQuads = g.quads;
+    p.standingCenter = g.standingCenter;
+    p.playSpaceAreaX = g.playSpaceAreaX;
+    p.playSpaceAreaZ = g.playSpaceAreaZ;
+    p.includesVisibility = true;
+    p.visibility = 0.8f;
+    return p;
+}
+
+// Saves in the layout used before the compact blob, one double per
+// coordinate in front of the other doubles.
+struct LegacyChaperoneProfile : advsettings::ChaperoneProfile
+{
+    settings::SettingsObjectData saveSettings() const override
+    {
+        auto o = ChaperoneProfile::saveSettings();
+
+        auto strings = o.takeValues<std::string>();
+        // The geometry blob is the last string.
+        strings.pop_back();
+
+        std::vector<double> doubles;
+        for ( const auto& quad : chaperoneGeometryQuads )
+        {
+            for ( const auto& corner : quad.vCorners )
+            {
+                for ( const auto v : corner.v )
+                {
+                    doubles.push_back( static_cast<double>( v ) );
+                }
+            }
+        }
+        for ( int i = 0; i < 3; ++i )
+        {
+            for ( int j = 0; j < 4; ++j )
+            {
+                doubles.push_back(
+                    static_cast<double>( standingCenter.m[i][j] ) );
+            }
+        }
+        doubles.push_back( static_cast<double>( playSpaceAreaX ) );
+        doubles.push_back( static_cast<double>( playSpaceAreaZ ) );
+        const auto others = o.takeValues<double>();
+        doubles.insert( doubles.end(), others.begin(), others.end() );
+
+        o.setValues<std::string>( std::move( strings ) );
+        o.setValues<double>( std::move( doubles ) );
+        return o;
+    }
+};
+
+void openSettingsFile( const QString& fileName )
+{
+    g_settings.reset();
+    g_settings = std::make_unique<QSettings>( fileName, QSettings::IniFormat );
+}
+
+QString createSettingsFile( const QString& name )
+{
+    g_settingsDir = std::make_unique<QTemporaryDir>();
+    const auto fileName = g_settingsDir->filePath( name );
+    openSettingsFile( fileName );
+    return fileName;
+}
+
+void writeLegacyProfiles( const int profileCount )
+{
+    for ( int p = 1; p <= profileCount; ++p )
+    {
+        LegacyChaperoneProfile profile;
+        static_cast<advsettings::ChaperoneProfile&>( profile )
+            = createProfile( p );
+        settings::saveNumberedObject( profile, p );
+    }
+    g_settings->sync();
+}
+
+void writeCompactProfiles( const int profileCount )
+{
+    for ( int p = 1; p <= profileCount; ++p )
+    {
+        settings::saveNumberedObject( createProfile( p ), p );
+    }
+    g_settings->sync();
+}
+
+// The load done for every profile at startup, parsing the file included.
+void loadProfiles( const QString& fileName, const int profileCount )
+{
+    openSettingsFile( fileName );
+    for ( int p = 1; p <= profileCount; ++p )
+    {
+        advsettings::ChaperoneProfile profile;
+        settings::loadNumberedObject( profile, p );
+        QVERIFY( profile.profileName == "Profile " + std::to_string( p ) );
+    }
+}
+
+// Entries in the file, not the array size, stale ones count as well.
+int savedDoubles( const int slot )
+{
+    g_settings->beginGroup(
+        QString( "ChaperoneTabController::ChaperoneProfile-%1" ).arg( slot ) );
+    g_settings->beginGroup( "doubles" );
+    const auto entries = g_settings->childGroups().size();
+    g_settings->endGroup();
+    g_settings->endGroup();
+    return entries;
+}
+
+void addProfileCountRows()
+{
+    QTest::addColumn<int>( "profileCount" );
+
+    QTest::newRow( "1 profile" ) << 1;
+    QTest::newRow( "10 profiles" ) << 10;
+    QTest::newRow( "100 profiles" ) << 100;
+}
+
+} // namespace
+
+void GeometryBlobTest::roundTrip()
+{
+    const auto g = createGeometry( k_quadsPerProfile );
+
+    const auto decoded
+        = utils::decodeChaperoneGeometry( utils::encodeChaperoneGeometry( g ) );
+
+    QVERIFY( decoded.has_value() );
+    QVERIFY( geometryEqual( g, *decoded ) );
+}
+
+void GeometryBlobTest::emptyGeometry()
+{
+    const auto g = createGeometry( 0 );
+
+    const auto decoded
+        = utils::decodeChaperoneGeometry( utils::encodeChaperoneGeometry( g ) );
+
+    QVERIFY( decoded.has_value() );
+    QVERIFY( decoded->quads.empty() );
+    QVERIFY( geometryEqual( g, *decoded ) );
+}
+
+void GeometryBlobTest::corruptedBlobIsRejected()
+{
+    const auto blob
+        = utils::encodeChaperoneGeometry( createGeometry( k_quadsPerProfile ) );
+
+    auto data = QByteArray::fromBase64( QByteArray::fromStdString( blob ) );
+    data[20] = static_cast<char>( data[20] ^ 0x01 );
+
+    QVERIFY( !utils::decodeChaperoneGeometry( data.toBase64().toStdString() )
+                  .has_value() );
+}
+
+void GeometryBlobTest::truncatedBlobIsRejected()
+{
+    const auto blob
+        = utils::encodeChaperoneGeometry( createGeometry( k_quadsPerProfile ) );
+
+    auto data = QByteArray::fromBase64( QByteArray::fromStdString( blob ) );
+    data.chop( 5 );
+
+    QVERIFY( !utils::decodeChaperoneGeometry( data.toBase64().toStdString() )
+                  .has_value() );
+    QVERIFY( !utils::decodeChaperoneGeometry( "" ).has_value() );
+}
+
+void GeometryBlobTest::unknownVersionIsRejected()
+{
+    const auto blob = utils::encodeChaperoneGeometry( createGeometry( 1 ) );
+
+    auto data = QByteArray::fromBase64( QByteArray::fromStdString( blob ) );
+    data[4] = static_cast<char>( utils::k_chaperoneGeometryBlobVersion + 1 );
+
+    QVERIFY( !utils::decodeChaperoneGeometry( data.toBase64().toStdString() )
+                  .has_value() );
+}
+
+void GeometryBlobTest::legacyProfileIsMigratedOnSave()
+{
+    createSettingsFile( "migration.ini" );
+    writeLegacyProfiles( 1 );
+    const auto geometryDoubles = k_quadsPerProfile * 4 * 3 + 12 + 2;
+    QVERIFY( savedDoubles( 1 ) > geometryDoubles );
+
+    advsettings::ChaperoneProfile profile;
+    settings::loadNumberedObject( profile, 1 );
+    const auto expected = createGeometry( k_quadsPerProfile );
+    QVERIFY( geometryEqual( { profile.chaperoneGeometryQuads,
+                              profile.standingCenter,
+                              profile.playSpaceAreaX,
+                              profile.playSpaceAreaZ },
+                            expected ) );
+    QCOMPARE( profile.visibility, 0.8f );
+
+    settings::saveNumberedObject( profile, 1 );
+
+    // Only the doubles that aren't geometry are left.
+    QCOMPARE( savedDoubles( 1 ), 6 );
+    advsettings::ChaperoneProfile migrated;
+    settings::loadNumberedObject( migrated, 1 );
+    QVERIFY( !migrated.chaperoneGeometryBlob.empty() );
+    QCOMPARE( migrated.visibility, 0.8f );
+}
+
+void GeometryBlobTest::storedProfileGeometryIsDecoded()
+{
+    createSettingsFile( "store.ini" );
+    {
+        settings::ProfileStore<advsettings::ChaperoneProfile> store;
+        store.put( createProfile( 0 ) );
+        store.save();
+    }
+
+    // The way applyChaperoneProfile reaches the geometry.
+    settings::ProfileStore<advsettings::ChaperoneProfile> store;
+    store.load();
+    auto& profile = store.cached( 0 );
+    QVERIFY( !profile.chaperoneGeometryLoaded );
+    QVERIFY( profile.loadChaperoneGeometry() );
+    QVERIFY( geometryEqual( { profile.chaperoneGeometryQuads,
+                              profile.standingCenter,
+                              profile.playSpaceAreaX,
+                              profile.playSpaceAreaZ },
+                            createGeometry( k_quadsPerProfile ) ) );
+    QCOMPARE( profile.chaperoneGeometryQuadCount,
+              static_cast<unsigned>( k_quadsPerProfile ) );
+
+    // Decoding doesn't change what is saved.
+    const auto blob = profile.saveSettings().takeValues<std::string>();
+    advsettings::ChaperoneProfile saved;
+    settings::loadNumberedObject( saved, 1 );
+    QVERIFY( blob.back() == saved.chaperoneGeometryBlob );
+}
+
+void GeometryBlobTest::legacyProfilesLoadBenchmarked_data()
+{
+    addProfileCountRows();
+}
+
+void GeometryBlobTest::legacyProfilesLoadBenchmarked()
+{
+    QFETCH( int, profileCount );
+
+    const auto fileName = createSettingsFile( "legacy.ini" );
+    writeLegacyProfiles( profileCount );
+    qInfo() << "Legacy file size:" << QFileInfo( fileName ).size() << "bytes";
+
+    QBENCHMARK
+    {
+        loadProfiles( fileName, profileCount );
+    }
+}
+
+void GeometryBlobTest::compactProfilesLoadBenchmarked_data()
+{
+    addProfileCountRows();
+}
+
+void GeometryBlobTest::compactProfilesLoadBenchmarked()
+{
+    QFETCH( int, profileCount );
+
+    const auto fileName = createSettingsFile( "compact.ini" );
+    writeCompactProfiles( profileCount );
+    qInfo() << "Compact file size:" << QFileInfo( fileName ).size() << "bytes";
+
+    // Geometry is decoded lazily on apply, so startup only reads the string.
+    QBENCHMARK
+    {
+        loadProfiles( fileName, profileCount );
+    }
+}
+
+QTEST_APPLESS_MAIN( GeometryBlobTest )
+
+#include "./release/tst_geometryblobtest.moc"
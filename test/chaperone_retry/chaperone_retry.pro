@@ -0,0 +1,15 @@
+QT += testlib
+QT -= gui
+CONFIG   += c++1z
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += ../../src/utils
+
+SOURCES +=  tst_chaperoneretrytest.cpp
+
+HEADERS += \
+    ../../src/utils/ChaperoneRetryBackoff.h
@@ -0,0 +1,86 @@
+#include <QtTest>
+#include <vector>
+#include "ChaperoneRetryBackoff.h"
+
+using utils::ChaperoneRetryBackoff;
+
+class ChaperoneRetryTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void firstCheckWaitsForInitialDelay();
+
+    void failedChecksBackOffToMaximum();
+
+    void restartResetsDelay();
+};
+
+namespace
+{
+// Ticks until the next check is due.
+unsigned ticksUntilCheck( ChaperoneRetryBackoff& backoff )
+{
+    unsigned ticks = 1;
+    while ( !backoff.tick() )
+    {
+        ++ticks;
+    }
+    return ticks;
+}
+
+} // namespace
+
+void ChaperoneRetryTest::firstCheckWaitsForInitialDelay()
+{
+    ChaperoneRetryBackoff backoff;
+
+    QCOMPARE( ticksUntilCheck( backoff ),
+              ChaperoneRetryBackoff::k_initialDelayTicks );
+    // Without a failed check the delay stays the same.
+    QCOMPARE( ticksUntilCheck( backoff ),
+              ChaperoneRetryBackoff::k_initialDelayTicks );
+}
+
+void ChaperoneRetryTest::failedChecksBackOffToMaximum()
+{
+    ChaperoneRetryBackoff backoff;
+
+    std::vector<unsigned> delays;
+    for ( int i = 0; i < 7; ++i )
+    {
+        delays.push_back( ticksUntilCheck( backoff ) );
+        backoff.checkFailed();
+    }
+
+    const std::vector<unsigned> expected{ 500, 1000, 2000, 4000,
+                                          8000, 8000, 8000 };
+    QCOMPARE( delays, expected );
+    QCOMPARE( backoff.delayTicks(), ChaperoneRetryBackoff::k_maxDelayTicks );
+}
+
+void ChaperoneRetryTest::restartResetsDelay()
+{
+    ChaperoneRetryBackoff backoff;
+    for ( int i = 0; i < 3; ++i )
+    {
+        ticksUntilCheck( backoff );
+        backoff.checkFailed();
+    }
+
+    // A chaperone event arrives halfway to the next check.
+    for ( unsigned i = 0; i < backoff.delayTicks() / 2; ++i )
+    {
+        QVERIFY( !backoff.tick() );
+    }
+    backoff.restart();
+
+    QCOMPARE( backoff.delayTicks(),
+              ChaperoneRetryBackoff::k_initialDelayTicks );
+    QCOMPARE( ticksUntilCheck( backoff ),
+              ChaperoneRetryBackoff::k_initialDelayTicks );
+}
+
+QTEST_APPLESS_MAIN( ChaperoneRetryTest )
+
+#include "./release/tst_chaperoneretrytest.moc"
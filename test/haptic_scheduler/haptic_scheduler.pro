@@ -0,0 +1,17 @@
+QT += testlib
+QT -= gui
+CONFIG   += c++1z
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += ../../src/utils \
+    ../../third-party/openvr/headers
+
+SOURCES +=  tst_hapticschedulertest.cpp \
+    ../../src/utils/HapticScheduler.cpp
+
+HEADERS += \
+    ../../src/utils/HapticScheduler.h
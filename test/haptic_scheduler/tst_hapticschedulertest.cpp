@@ -0,0 +1,244 @@
+#include <QtTest>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "HapticScheduler.h"
+
+using utils::HapticDevice;
+using utils::HapticPulse;
+using utils::HapticScheduler;
+
+namespace
+{
+constexpr vr::VRActionHandle_t k_leftAction = 1;
+constexpr vr::VRActionHandle_t k_rightAction = 2;
+
+struct RecordedCall
+{
+    HapticScheduler::Clock::time_point time;
+    vr::VRActionHandle_t action;
+    HapticPulse pulse;
+};
+
+// Stands in for IVRInput::TriggerHapticVibrationAction.
+class RecordingRuntime
+{
+public:
+    HapticScheduler::TriggerFunction trigger()
+    {
+        return [this]( vr::VRActionHandle_t action,
+                       float durationSeconds,
+                       float frequency,
+                       float amplitude,
+                       vr::VRInputValueHandle_t ) {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_calls.push_back( { HapticScheduler::Clock::now(),
+                                 action,
+                                 { durationSeconds, frequency, amplitude } } );
+        };
+    }
+
+    std::vector<RecordedCall> calls()
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        return m_calls;
+    }
+
+    std::vector<RecordedCall> callsFor( vr::VRActionHandle_t action )
+    {
+        std::vector<RecordedCall> result;
+        for ( const auto& c : calls() )
+        {
+            if ( c.action == action )
+            {
+                result.push_back( c );
+            }
+        }
+        return result;
+    }
+
+    int callCount()
+    {
+        return static_cast<int>( calls().size() );
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<RecordedCall> m_calls;
+};
+
+void setHandles( HapticScheduler& scheduler )
+{
+    scheduler.setActionHandle( HapticDevice::Left, k_leftAction );
+    scheduler.setActionHandle( HapticDevice::Right, k_rightAction );
+}
+
+HapticPulse pulseNumber( int i )
+{
+    return { 0.01f, 100.0f + static_cast<float>( i ), 0.5f };
+}
+
+} // namespace
+
+class HapticSchedulerTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void queuedPulsesAreSpacedByMinInterval();
+
+    void identicalPulsesAreCoalesced();
+
+    void queueIsBounded();
+
+    void devicesAreIndependent();
+
+    void proximityEnvelopeScalesWithIntensity();
+
+    void proximityPulsesRepeatAtPeriod();
+};
+
+void HapticSchedulerTest::queuedPulsesAreSpacedByMinInterval()
+{
+    constexpr std::chrono::milliseconds minInterval{ 30 };
+    RecordingRuntime runtime;
+    HapticScheduler scheduler( runtime.trigger(), minInterval );
+    setHandles( scheduler );
+
+    for ( int i = 0; i < 4; ++i )
+    {
+        scheduler.queuePulse( HapticDevice::Left, pulseNumber( i ) );
+    }
+
+    QTRY_COMPARE( runtime.callCount(), 4 );
+
+    const auto calls = runtime.calls();
+    for ( size_t i = 1; i < calls.size(); ++i )
+    {
+        QVERIFY( calls[i].time - calls[i - 1].time >= minInterval );
+        QCOMPARE( calls[i].pulse.frequency,
+                  pulseNumber( static_cast<int>( i ) ).frequency );
+    }
+    QCOMPARE( scheduler.triggeredPulses(), 4ull );
+    QCOMPARE( scheduler.droppedPulses(), 0ull );
+}
+
+void HapticSchedulerTest::identicalPulsesAreCoalesced()
+{
+    RecordingRuntime runtime;
+    HapticScheduler scheduler( runtime.trigger(),
+                               std::chrono::milliseconds( 30 ) );
+    setHandles( scheduler );
+
+    for ( int i = 0; i < 10; ++i )
+    {
+        scheduler.queuePulse( HapticDevice::Left, pulseNumber( 0 ) );
+    }
+
+    QTest::qWait( 200 );
+
+    // The worker might have picked up the first pulse before the second one
+    // was queued, every further duplicate is dropped.
+    QVERIFY( runtime.callCount() >= 1 );
+    QVERIFY( runtime.callCount() <= 2 );
+    QCOMPARE( scheduler.droppedPulses()
+                  + static_cast<unsigned long long>( runtime.callCount() ),
+              10ull );
+}
+
+void HapticSchedulerTest::queueIsBounded()
+{
+    RecordingRuntime runtime;
+    HapticScheduler scheduler( runtime.trigger(),
+                               std::chrono::milliseconds( 20 ) );
+    setHandles( scheduler );
+
+    constexpr int queued = 20;
+    for ( int i = 0; i < queued; ++i )
+    {
+        scheduler.queuePulse( HapticDevice::Left, pulseNumber( i ) );
+    }
+
+    QTest::qWait( 400 );
+
+    QVERIFY( runtime.callCount()
+             <= static_cast<int>( HapticScheduler::k_maxQueuedPulses ) + 1 );
+    QCOMPARE( scheduler.droppedPulses()
+                  + static_cast<unsigned long long>( runtime.callCount() ),
+              static_cast<unsigned long long>( queued ) );
+    // The newest pulse always survives.
+    QCOMPARE( runtime.calls().back().pulse.frequency,
+              pulseNumber( queued - 1 ).frequency );
+}
+
+void HapticSchedulerTest::devicesAreIndependent()
+{
+    constexpr std::chrono::milliseconds minInterval{ 200 };
+    RecordingRuntime runtime;
+    HapticScheduler scheduler( runtime.trigger(), minInterval );
+    setHandles( scheduler );
+
+    scheduler.queuePulse( HapticDevice::Left, pulseNumber( 0 ) );
+    scheduler.queuePulse( HapticDevice::Right, pulseNumber( 1 ) );
+
+    QTRY_COMPARE_WITH_TIMEOUT( runtime.callCount(), 2, 150 );
+
+    QCOMPARE( runtime.callsFor( k_leftAction ).size(), size_t{ 1 } );
+    QCOMPARE( runtime.callsFor( k_rightAction ).size(), size_t{ 1 } );
+}
+
+void HapticSchedulerTest::proximityEnvelopeScalesWithIntensity()
+{
+    const auto far = HapticScheduler::proximityPulse( 0.0f );
+    const auto close = HapticScheduler::proximityPulse( 1.0f );
+
+    QCOMPARE( far.amplitude, HapticScheduler::k_proximityMinAmplitude );
+    QCOMPARE( close.amplitude, HapticScheduler::k_proximityMaxAmplitude );
+    QCOMPARE( far.frequency, HapticScheduler::k_proximityMinFrequency );
+    QCOMPARE( close.frequency, HapticScheduler::k_proximityMaxFrequency );
+
+    QVERIFY( HapticScheduler::proximityPeriod( 1.0f )
+             < HapticScheduler::proximityPeriod( 0.5f ) );
+    QVERIFY( HapticScheduler::proximityPeriod( 0.5f )
+             < HapticScheduler::proximityPeriod( 0.0f ) );
+    QVERIFY( close.durationSeconds < far.durationSeconds );
+}
+
+void HapticSchedulerTest::proximityPulsesRepeatAtPeriod()
+{
+    RecordingRuntime runtime;
+    HapticScheduler scheduler( runtime.trigger() );
+    setHandles( scheduler );
+
+    constexpr std::chrono::milliseconds activeTime{ 500 };
+    const auto period = HapticScheduler::proximityPeriod( 1.0f );
+
+    scheduler.setProximity( HapticDevice::Left, 1.0f );
+    // Repeated updates with the same intensity must not add pulses.
+    for ( int i = 0; i < 100; ++i )
+    {
+        scheduler.setProximity( HapticDevice::Left, 1.0f );
+    }
+    std::this_thread::sleep_for( activeTime );
+    scheduler.clearProximity( HapticDevice::Left );
+
+    const auto calls = runtime.callsFor( k_leftAction );
+    const auto expected = static_cast<int>( activeTime / period );
+    QVERIFY( static_cast<int>( calls.size() ) >= expected - 1 );
+    QVERIFY( static_cast<int>( calls.size() ) <= expected + 1 );
+    for ( size_t i = 1; i < calls.size(); ++i )
+    {
+        QVERIFY( calls[i].time - calls[i - 1].time >= period );
+    }
+    QVERIFY( runtime.callsFor( k_rightAction ).empty() );
+
+    // Let a pulse that was already being sent finish.
+    QTest::qWait( 20 );
+    const auto countAfterClear = runtime.callCount();
+    QTest::qWait( 200 );
+    QCOMPARE( runtime.callCount(), countAfterClear );
+}
+
+QTEST_GUILESS_MAIN( HapticSchedulerTest )
+
+#include "./release/tst_hapticschedulertest.moc"
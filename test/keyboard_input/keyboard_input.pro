@@ -7,10 +7,16 @@ CONFIG -= app_bundle
 
 TEMPLATE = app
 
-INCLUDEPATH += ../../src/keyboard_input
+INCLUDEPATH += ../../src/keyboard_input \
+    ../../third-party/easylogging++
 
 SOURCES +=  tst_parsertest.cpp \
-    ../../src/keyboard_input/input_parser.cpp
+    ../../src/keyboard_input/input_parser.cpp \
+    ../../src/keyboard_input/input_sender.cpp \
+    ../../src/keyboard_input/keyboard_macro.cpp \
+    ../../third-party/easylogging++/easylogging++.cc
 
 HEADERS += \
-    ../../src/keyboard_input/input_parser.h
+    ../../src/keyboard_input/input_parser.h \
+    ../../src/keyboard_input/input_sender.h \
+    ../../src/keyboard_input/keyboard_macro.h
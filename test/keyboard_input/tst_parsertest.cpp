@@ -1,6 +1,10 @@
 #include <QtTest>
 #include <QDebug>
+#include <array>
 #include "input_parser.h"
+#include "keyboard_macro.h"
+
+INITIALIZE_EASYLOGGINGPP
 
 class ParserTest : public QObject
 {
@@ -37,11 +41,17 @@ private slots:
 
     void sixtyfourAsBenchmarked();
 
+    void everyNamedKeyBenchmarked();
+
     void removeDuplicateSpaces();
 
     void removeDuplicateModifiers();
 
     void removeIncorrectTokensBenchmark();
+
+    void shortcutParseBenchmarked();
+
+    void compiledShortcutLookupBenchmarked();
 };
 
 const std::string alphabet = "abcdefghijklmnopqrstuvxyz";
@@ -377,6 +387,23 @@ void ParserTest::sixtyfourAsBenchmarked()
     }
 }
 
+void ParserTest::everyNamedKeyBenchmarked()
+{
+    constexpr auto namedKeys
+        = "^*>#F1F2F3F4F5F6F7F8F9 BACKSPACE SPACE TAB ESC INS DEL END PGDN "
+          "PGUP CAPS PRNSCRN PAUSE SCRLOCK LEFTARROW RIGHTARROW UPARROW "
+          "DOWNARROW KPSLASH KPSTAR KPMINUS KPPLUS ENTER az09";
+
+    const auto t = ParseKeyboardInputsToTokens( namedKeys );
+    QCOMPARE( t.size(), static_cast<std::size_t>( 62 ) );
+    QCOMPARE( t.back(), Token::KEY_9 );
+
+    QBENCHMARK
+    {
+        auto t = ParseKeyboardInputsToTokens( namedKeys );
+    }
+}
+
 void ParserTest::removeDuplicateSpaces()
 {
     const auto e = std::vector<Token>( { Token::KEY_a,
@@ -492,6 +519,43 @@ void ParserTest::removeIncorrectTokensBenchmark()
     }
 }
 
+// A shortcut press before shortcuts were compiled: parse, then send.
+void ParserTest::shortcutParseBenchmarked()
+{
+    const std::string shortcut = "^c *TAB >a BACKSPACEBACKSPACE ^v ENTER";
+
+    QVERIFY( !parseMacro( shortcut ).empty() );
+
+    QBENCHMARK
+    {
+        auto macro = parseMacro( shortcut );
+    }
+}
+
+// A press of the same shortcut once compiled, as sendKeyboardOne does it:
+// the program is taken from the table and its events are read. Queueing it
+// for sending is the same either way and isn't measured.
+void ParserTest::compiledShortcutLookupBenchmarked()
+{
+    const std::array<ShortcutProgram, 3> shortcuts{
+        compileShortcut( "^c *TAB >a BACKSPACEBACKSPACE ^v ENTER" ),
+        compileShortcut( "^z" ),
+        compileShortcut( "^v" ),
+    };
+    std::size_t events = 0;
+
+    QBENCHMARK
+    {
+        const auto program = shortcuts[0];
+        for ( const auto& step : *program )
+        {
+            events += step.events.size();
+        }
+    }
+
+    QVERIFY( events > 0 );
+}
+
 QTEST_APPLESS_MAIN( ParserTest )
 
 #include "./release/tst_parsertest.moc"
@@ -0,0 +1,43 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include "input_parser.h"
+
+INITIALIZE_EASYLOGGINGPP
+
+extern "C" int LLVMFuzzerInitialize( int*, char*** )
+{
+    // Every unknown character is logged, which would drown the fuzzer.
+    el::Configurations conf;
+    conf.setGlobally( el::ConfigurationType::Enabled, "false" );
+    el::Loggers::reconfigureAllLoggers( conf );
+    return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput( const std::uint8_t* data,
+                                       const std::size_t size )
+{
+    const std::string input( reinterpret_cast<const char*>( data ), size );
+
+    const auto tokens = ParseKeyboardInputsToTokens( input );
+    // Every token is made of at least one character.
+    if ( tokens.size() > input.size() )
+    {
+        std::abort();
+    }
+    for ( const auto token : tokens )
+    {
+        if ( !isLiteral( token ) && !isModifier( token )
+             && token != Token::TOKEN_NEW_SEQUENCE )
+        {
+            std::abort();
+        }
+    }
+
+    if ( removeIncorrectTokens( tokens ).size() > tokens.size() )
+    {
+        std::abort();
+    }
+    return 0;
+}
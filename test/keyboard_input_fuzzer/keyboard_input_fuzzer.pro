@@ -0,0 +1,23 @@
+CONFIG += c++1z
+CONFIG += console warn_on
+CONFIG -= qt app_bundle
+
+TEMPLATE = app
+
+# libFuzzer target, needs clang. Run with a corpus directory, for example
+# ./keyboard_input_fuzzer -max_len=256 corpus/
+QMAKE_CC = clang
+QMAKE_CXX = clang++
+QMAKE_LINK = clang++
+QMAKE_CXXFLAGS += -fsanitize=fuzzer,address,undefined
+QMAKE_LFLAGS += -fsanitize=fuzzer,address,undefined
+
+INCLUDEPATH += ../../src/keyboard_input \
+    ../../third-party/easylogging++
+
+SOURCES +=  fuzz_parser.cpp \
+    ../../src/keyboard_input/input_parser.cpp \
+    ../../third-party/easylogging++/easylogging++.cc
+
+HEADERS += \
+    ../../src/keyboard_input/input_parser.h
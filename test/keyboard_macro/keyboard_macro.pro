@@ -0,0 +1,24 @@
+QT += testlib
+QT -= gui
+CONFIG   += c++1z
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += ../../src/keyboard_input \
+    ../../third-party/easylogging++
+
+SOURCES +=  tst_keyboardmacrotest.cpp \
+    ../../src/keyboard_input/keyboard_macro.cpp \
+    ../../src/keyboard_input/macro_executor.cpp \
+    ../../src/keyboard_input/input_sender.cpp \
+    ../../src/keyboard_input/input_parser.cpp \
+    ../../third-party/easylogging++/easylogging++.cc
+
+HEADERS += \
+    ../../src/keyboard_input/keyboard_macro.h \
+    ../../src/keyboard_input/macro_executor.h \
+    ../../src/keyboard_input/input_sender.h \
+    ../../src/keyboard_input/input_parser.h
@@ -0,0 +1,352 @@
+#include <QtTest>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "keyboard_macro.h"
+#include "macro_executor.h"
+
+INITIALIZE_EASYLOGGINGPP
+
+using namespace std::chrono_literals;
+
+namespace
+{
+struct RecordedSend
+{
+    MacroExecutor::Clock::time_point time;
+    std::vector<KeyEvent> events;
+};
+
+// Stands in for the platform sender.
+class RecordingSender
+{
+public:
+    MacroExecutor::SendFunction send()
+    {
+        return [this]( const std::vector<KeyEvent>& events ) {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_sends.push_back( { MacroExecutor::Clock::now(), events } );
+        };
+    }
+
+    std::vector<RecordedSend> sends() const
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        return m_sends;
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    std::vector<RecordedSend> m_sends;
+};
+
+bool waitForIdle( const MacroExecutor& executor )
+{
+    const auto deadline = MacroExecutor::Clock::now() + 5s;
+    while ( !executor.idle() )
+    {
+        if ( MacroExecutor::Clock::now() > deadline )
+        {
+            return false;
+        }
+        std::this_thread::sleep_for( 1ms );
+    }
+    return true;
+}
+
+std::chrono::duration<double, std::milli>
+    offset( const std::vector<RecordedSend>& sends, const std::size_t i )
+{
+    return sends.at( i ).time - sends.front().time;
+}
+
+// Late by at most this much, and never early.
+constexpr std::chrono::duration<double, std::milli> k_tolerance{ 2.0 };
+constexpr std::chrono::duration<double, std::milli> k_earliness{ 0.5 };
+
+} // namespace
+
+class KeyboardMacroTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void plainShortcutIsOneStep();
+    void waitsSplitSteps();
+    void holdPressesAndReleases();
+    void invalidAnnotationKeepsPreviousKeys();
+    void repeatCountRepeatsKeys();
+    void quotedTextIsTyped();
+    void quotedTextSharesShift();
+    void quotedTextEscapes();
+    void explicitHoldAndRelease();
+    void keysBetweenWaitsAreOneBatch();
+    void invalidExtensionsKeepPreviousKeys();
+
+    void stepsAreSentOnTime();
+    void macrosRunInOrder();
+    void runDoesNotBlock();
+    void cancelReleasesHeldKeys();
+    void stopReleasesHeldKeys();
+};
+
+void KeyboardMacroTest::plainShortcutIsOneStep()
+{
+    const auto macro = parseMacro( "^c" );
+
+    QCOMPARE( macro.size(), std::size_t{ 1 } );
+    QVERIFY( macro[0].delay == 0ms );
+    QVERIFY( macro[0].events
+             == toKeyEvents( { Token::MODIFIER_CTRL, Token::KEY_c } ) );
+}
+
+void KeyboardMacroTest::waitsSplitSteps()
+{
+    const auto macro = parseMacro( "^c{50}{25}^v{10}" );
+
+    QCOMPARE( macro.size(), std::size_t{ 3 } );
+    QVERIFY( macro[0].delay == 0ms );
+    QVERIFY( macro[1].delay == 75ms );
+    QVERIFY( macro[1].events
+             == toKeyEvents( { Token::MODIFIER_CTRL, Token::KEY_v } ) );
+    // A trailing wait is kept as an empty step.
+    QVERIFY( macro[2].delay == 10ms );
+    QVERIFY( macro[2].events.empty() );
+}
+
+void KeyboardMacroTest::holdPressesAndReleases()
+{
+    const auto macro = parseMacro( "{5}*a{h200}" );
+
+    QCOMPARE( macro.size(), std::size_t{ 2 } );
+    QVERIFY( macro[0].delay == 5ms );
+    const std::vector<KeyEvent> press{ { Token::MODIFIER_ALT, KeyStatus::Down },
+                                       { Token::KEY_a, KeyStatus::Down } };
+    QVERIFY( macro[0].events == press );
+
+    QVERIFY( macro[1].delay == 200ms );
+    const std::vector<KeyEvent> release{ { Token::KEY_a, KeyStatus::Up },
+                                         { Token::MODIFIER_ALT,
+                                           KeyStatus::Up } };
+    QVERIFY( macro[1].events == release );
+}
+
+void KeyboardMacroTest::invalidAnnotationKeepsPreviousKeys()
+{
+    for ( const auto input : { "a{x}b", "a{}b", "a{99999999}b", "a{12" } )
+    {
+        const auto macro = parseMacro( input );
+        QCOMPARE( macro.size(), std::size_t{ 1 } );
+        QVERIFY( macro[0].events == toKeyEvents( { Token::KEY_a } ) );
+    }
+}
+
+void KeyboardMacroTest::repeatCountRepeatsKeys()
+{
+    const auto macro = parseMacro( "^z{x3}BACKSPACE{x2}" );
+
+    QCOMPARE( macro.size(), std::size_t{ 1 } );
+    const auto undo = toKeyEvents( { Token::MODIFIER_CTRL, Token::KEY_z } );
+    auto expected = repeatKeys( undo, 3 );
+    const auto backspaces
+        = toKeyEvents( { Token::KEY_BACKSPACE, Token::KEY_BACKSPACE } );
+    expected.insert( expected.end(), backspaces.begin(), backspaces.end() );
+    QVERIFY( macro[0].events == expected );
+}
+
+void KeyboardMacroTest::quotedTextIsTyped()
+{
+    const auto macro = parseMacro( "\"a-1\"ENTER" );
+
+    QCOMPARE( macro.size(), std::size_t{ 1 } );
+    QVERIFY( macro[0].events
+             == toKeyEvents( { Token::KEY_a,
+                               Token::KEY_MINUS,
+                               Token::KEY_1,
+                               Token::KEY_ENTER } ) );
+}
+
+void KeyboardMacroTest::quotedTextSharesShift()
+{
+    const auto macro = parseMacro( "\"AB!c\"" );
+
+    const std::vector<KeyEvent> expected{
+        { Token::MODIFIER_SHIFT, KeyStatus::Down },
+        { Token::KEY_a, KeyStatus::Down },
+        { Token::KEY_a, KeyStatus::Up },
+        { Token::KEY_b, KeyStatus::Down },
+        { Token::KEY_b, KeyStatus::Up },
+        { Token::KEY_1, KeyStatus::Down },
+        { Token::KEY_1, KeyStatus::Up },
+        { Token::MODIFIER_SHIFT, KeyStatus::Up },
+        { Token::KEY_c, KeyStatus::Down },
+        { Token::KEY_c, KeyStatus::Up },
+    };
+    QCOMPARE( macro.size(), std::size_t{ 1 } );
+    QVERIFY( macro[0].events == expected );
+}
+
+void KeyboardMacroTest::quotedTextEscapes()
+{
+    // Braces are text inside quotes, not annotations.
+    const auto macro = parseMacro( R"("\"{1}\\")" );
+
+    const std::vector<KeyEvent> expected{
+        { Token::MODIFIER_SHIFT, KeyStatus::Down },
+        { Token::KEY_APOSTROPHE, KeyStatus::Down },
+        { Token::KEY_APOSTROPHE, KeyStatus::Up },
+        { Token::KEY_LEFTBRACKET, KeyStatus::Down },
+        { Token::KEY_LEFTBRACKET, KeyStatus::Up },
+        { Token::MODIFIER_SHIFT, KeyStatus::Up },
+        { Token::KEY_1, KeyStatus::Down },
+        { Token::KEY_1, KeyStatus::Up },
+        { Token::MODIFIER_SHIFT, KeyStatus::Down },
+        { Token::KEY_RIGHTBRACKET, KeyStatus::Down },
+        { Token::KEY_RIGHTBRACKET, KeyStatus::Up },
+        { Token::MODIFIER_SHIFT, KeyStatus::Up },
+        { Token::KEY_BACKSLASH, KeyStatus::Down },
+        { Token::KEY_BACKSLASH, KeyStatus::Up },
+    };
+    QCOMPARE( macro.size(), std::size_t{ 1 } );
+    QVERIFY( macro[0].events == expected );
+}
+
+void KeyboardMacroTest::explicitHoldAndRelease()
+{
+    const auto macro = parseMacro( "{+^w}{300}{-w}a{-^}" );
+
+    QCOMPARE( macro.size(), std::size_t{ 2 } );
+    const std::vector<KeyEvent> press{ { Token::MODIFIER_CTRL,
+                                         KeyStatus::Down },
+                                       { Token::KEY_w, KeyStatus::Down } };
+    QVERIFY( macro[0].events == press );
+
+    QVERIFY( macro[1].delay == 300ms );
+    const std::vector<KeyEvent> release{ { Token::KEY_w, KeyStatus::Up },
+                                         { Token::KEY_a, KeyStatus::Down },
+                                         { Token::KEY_a, KeyStatus::Up },
+                                         { Token::MODIFIER_CTRL,
+                                           KeyStatus::Up } };
+    QVERIFY( macro[1].events == release );
+}
+
+void KeyboardMacroTest::keysBetweenWaitsAreOneBatch()
+{
+    const auto macro = parseMacro( "a{x2}\"B\"{+c}{-c}d{h10}e" );
+
+    QCOMPARE( macro.size(), std::size_t{ 2 } );
+    QCOMPARE( macro[0].events.size(), std::size_t{ 2 + 2 + 4 + 2 + 1 } );
+    // The release of the hold and the following keys are sent together.
+    QVERIFY( macro[1].delay == 10ms );
+    QCOMPARE( macro[1].events.size(), std::size_t{ 1 + 2 } );
+}
+
+void KeyboardMacroTest::invalidExtensionsKeepPreviousKeys()
+{
+    // Bytes above 127 are negative as char.
+    for ( const auto input : { "a{x1001}b",
+                               "a{x\xc3\xa9}b",
+                               "a{+}b",
+                               "a{-XYZ}b",
+                               "a\"b",
+                               "a\"\xc3\xa9\"b" } )
+    {
+        const auto macro = parseMacro( input );
+        QCOMPARE( macro.size(), std::size_t{ 1 } );
+        QVERIFY( macro[0].events == toKeyEvents( { Token::KEY_a } ) );
+    }
+}
+
+void KeyboardMacroTest::stepsAreSentOnTime()
+{
+    RecordingSender sender;
+    MacroExecutor executor( sender.send() );
+
+    executor.run( parseMacro( "a{20}b{5}c{h30}" ) );
+    QVERIFY( waitForIdle( executor ) );
+
+    const auto sends = sender.sends();
+    QCOMPARE( sends.size(), std::size_t{ 4 } );
+
+    const std::vector<std::chrono::duration<double, std::milli>> expected{
+        0ms, 20ms, 25ms, 55ms
+    };
+    for ( std::size_t i = 1; i < sends.size(); ++i )
+    {
+        const auto actual = offset( sends, i );
+        QVERIFY2( actual >= expected[i] - k_earliness
+                      && actual <= expected[i] + k_tolerance,
+                  qPrintable( QString( "step %1 sent after %2 ms" )
+                                  .arg( i )
+                                  .arg( actual.count() ) ) );
+    }
+}
+
+void KeyboardMacroTest::macrosRunInOrder()
+{
+    RecordingSender sender;
+    MacroExecutor executor( sender.send() );
+
+    executor.run( parseMacro( "a{10}" ) );
+    executor.run( parseMacro( "b" ) );
+    QVERIFY( waitForIdle( executor ) );
+
+    const auto sends = sender.sends();
+    QCOMPARE( sends.size(), std::size_t{ 2 } );
+    QVERIFY( sends[0].events == toKeyEvents( { Token::KEY_a } ) );
+    QVERIFY( sends[1].events == toKeyEvents( { Token::KEY_b } ) );
+    // The trailing wait of the first macro spaces them.
+    QVERIFY( offset( sends, 1 ) >= 10ms - k_earliness );
+}
+
+void KeyboardMacroTest::runDoesNotBlock()
+{
+    RecordingSender sender;
+    MacroExecutor executor( sender.send() );
+
+    const auto start = MacroExecutor::Clock::now();
+    executor.run( parseMacro( "a{500}b" ) );
+    QVERIFY( MacroExecutor::Clock::now() - start < 50ms );
+
+    executor.cancel();
+    QVERIFY( waitForIdle( executor ) );
+}
+
+void KeyboardMacroTest::cancelReleasesHeldKeys()
+{
+    RecordingSender sender;
+    MacroExecutor executor( sender.send() );
+
+    executor.run( parseMacro( "^{h5000}" ) );
+    std::this_thread::sleep_for( 20ms );
+    executor.cancel();
+    QVERIFY( waitForIdle( executor ) );
+
+    const auto sends = sender.sends();
+    QCOMPARE( sends.size(), std::size_t{ 2 } );
+    const std::vector<KeyEvent> release{ { Token::MODIFIER_CTRL,
+                                           KeyStatus::Up } };
+    QVERIFY( sends[1].events == release );
+    QVERIFY( offset( sends, 1 ) < 1000ms );
+}
+
+void KeyboardMacroTest::stopReleasesHeldKeys()
+{
+    RecordingSender sender;
+    {
+        MacroExecutor executor( sender.send() );
+        executor.run( parseMacro( ">{h5000}" ) );
+        std::this_thread::sleep_for( 20ms );
+    }
+
+    const auto sends = sender.sends();
+    QCOMPARE( sends.size(), std::size_t{ 2 } );
+    const std::vector<KeyEvent> release{ { Token::MODIFIER_SHIFT,
+                                           KeyStatus::Up } };
+    QVERIFY( sends[1].events == release );
+}
+
+QTEST_APPLESS_MAIN( KeyboardMacroTest )
+
+#include "./release/tst_keyboardmacrotest.moc"
@@ -0,0 +1,24 @@
+QT += testlib dbus
+QT -= gui
+CONFIG   += c++1z
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += ELPP_QT_LOGGING \
+    ELPP_THREAD_SAFE
+
+# Starts its own dbus-daemon, the session bus is never used.
+
+INCLUDEPATH += ../../src/media_keys \
+    ../../third-party/easylogging++
+
+SOURCES +=  tst_mprisplayerstest.cpp \
+    ../../src/media_keys/mpris_player_registry.cpp \
+    ../../third-party/easylogging++/easylogging++.cc
+
+HEADERS += \
+    ../../src/media_keys/mpris_player_registry.h \
+    ../../src/media_keys/now_playing.h
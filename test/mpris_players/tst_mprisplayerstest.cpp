@@ -0,0 +1,476 @@
+#include <QtTest>
+#include <QDBusConnection>
+#include <QDBusContext>
+#include <QDBusMessage>
+#include <QElapsedTimer>
+#include <QProcess>
+#include <memory>
+#include "mpris_player_registry.h"
+
+INITIALIZE_EASYLOGGINGPP
+
+using keyboardinput::MprisPlayerRegistry;
+using keyboardinput::NowPlaying;
+
+namespace
+{
+constexpr auto k_registryConnection = "registry";
+
+constexpr auto k_playerPath = "/org/mpris/MediaPlayer2";
+constexpr auto k_playerInterface = "org.mpris.MediaPlayer2.Player";
+
+/*!
+   \brief A player on its own connection, which counts the calls it gets
+   and reports its state like MPRIS players do.
+ */
+class FakePlayer : public QObject, protected QDBusContext
+{
+    Q_OBJECT
+    Q_CLASSINFO( "D-Bus Interface", "org.mpris.MediaPlayer2.Player" )
+    Q_PROPERTY( QString PlaybackStatus READ playbackStatus )
+    Q_PROPERTY( QVariantMap Metadata READ metadata )
+    Q_PROPERTY( qlonglong Position READ position )
+
+public:
+    enum class Replies
+    {
+        Yes,
+        Never,
+    };
+
+    FakePlayer( const QString& address,
+                const QString& name,
+                const Replies replies = Replies::Yes )
+        : m_name( name ), m_replies( replies ),
+          m_connection( QDBusConnection::connectToBus( address, name ) )
+    {
+        m_connection.registerObject( k_playerPath,
+                                     this,
+                                     QDBusConnection::ExportAllSlots
+                                         | QDBusConnection::
+                                             ExportAllProperties );
+        m_connection.registerService( name );
+    }
+
+    ~FakePlayer() override
+    {
+        // Waits for the bus, the name is gone before the next test lists.
+        m_connection.unregisterService( m_name );
+        QDBusConnection::disconnectFromBus( m_name );
+    }
+
+    int calls( const QString& method ) const
+    {
+        return m_calls.value( method );
+    }
+
+    QString playbackStatus() const
+    {
+        return m_playbackStatus;
+    }
+
+    QVariantMap metadata() const
+    {
+        return m_metadata;
+    }
+
+    qlonglong position() const
+    {
+        return m_positionUs;
+    }
+
+    void setPlaybackStatus( const QString& status )
+    {
+        m_playbackStatus = status;
+        propertiesChanged( { { "PlaybackStatus", status } } );
+    }
+
+    void setTrack( const QString& title,
+                   const QStringList& artists,
+                   const qlonglong lengthUs )
+    {
+        m_metadata = { { "xesam:title", title },
+                       { "xesam:artist", artists },
+                       { "mpris:length", lengthUs } };
+        m_positionUs = 0;
+        propertiesChanged( { { "Metadata", m_metadata } } );
+    }
+
+    void seek( const qlonglong positionUs )
+    {
+        m_positionUs = positionUs;
+        auto seeked = QDBusMessage::createSignal(
+            k_playerPath, k_playerInterface, "Seeked" );
+        seeked << positionUs;
+        m_connection.send( seeked );
+    }
+
+public slots:
+    void Next()
+    {
+        called( "Next" );
+    }
+
+    void Previous()
+    {
+        called( "Previous" );
+    }
+
+    void PlayPause()
+    {
+        called( "PlayPause" );
+    }
+
+    void Stop()
+    {
+        called( "Stop" );
+    }
+
+private:
+    void propertiesChanged( const QVariantMap& changed )
+    {
+        auto signal
+            = QDBusMessage::createSignal( k_playerPath,
+                                          "org.freedesktop.DBus.Properties",
+                                          "PropertiesChanged" );
+        signal << QString( k_playerInterface ) << changed << QStringList();
+        m_connection.send( signal );
+    }
+
+    void called( const QString& method )
+    {
+        ++m_calls[method];
+        if ( m_replies == Replies::Never )
+        {
+            setDelayedReply( true );
+        }
+    }
+
+    const QString m_name;
+    const Replies m_replies;
+    QDBusConnection m_connection;
+    QHash<QString, int> m_calls;
+    QString m_playbackStatus = "Stopped";
+    QVariantMap m_metadata;
+    qlonglong m_positionUs = 0;
+};
+
+} // namespace
+
+class MprisPlayersTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void runningPlayersAreListed();
+    void playersAreFollowed();
+    void callsReachOnlyActivePlayer();
+    void callsBeforeListingAreSent();
+    void callsDontWaitForReplies();
+
+    void trackIsFetched();
+    void changesAreFollowed();
+    void seeksAreFollowed();
+    void lastPlayingPlayerIsActive();
+    void nowPlayingOnlyChangesOnChange();
+
+    void applicationNames();
+    void pinnedPlayerIsActive();
+    void preferredApplicationIsActive();
+
+private:
+    QDBusConnection bus() const;
+
+    QProcess m_daemon;
+    QString m_address;
+};
+
+QDBusConnection MprisPlayersTest::bus() const
+{
+    return QDBusConnection::connectToBus( m_address, k_registryConnection );
+}
+
+void MprisPlayersTest::initTestCase()
+{
+    m_daemon.start( "dbus-daemon",
+                    { "--session", "--nofork", "--print-address" } );
+    if ( !m_daemon.waitForStarted() )
+    {
+        QSKIP( "Needs dbus-daemon." );
+    }
+    QVERIFY( m_daemon.waitForReadyRead( 5000 ) );
+    m_address = QString::fromUtf8( m_daemon.readLine() ).trimmed();
+    QVERIFY( bus().isConnected() );
+}
+
+void MprisPlayersTest::cleanupTestCase()
+{
+    QDBusConnection::disconnectFromBus( k_registryConnection );
+    m_daemon.terminate();
+    m_daemon.waitForFinished();
+}
+
+void MprisPlayersTest::runningPlayersAreListed()
+{
+    FakePlayer player( m_address, "org.mpris.MediaPlayer2.listed" );
+    FakePlayer other( m_address, "org.example.NotAPlayer" );
+
+    MprisPlayerRegistry registry( bus() );
+    QVERIFY( !registry.isReady() );
+
+    QTRY_VERIFY( registry.isReady() );
+    QCOMPARE( registry.players(),
+              QStringList{ "org.mpris.MediaPlayer2.listed" } );
+}
+
+void MprisPlayersTest::playersAreFollowed()
+{
+    MprisPlayerRegistry registry( bus() );
+    QTRY_VERIFY( registry.isReady() );
+    QVERIFY( registry.players().isEmpty() );
+
+    {
+        FakePlayer first( m_address, "org.mpris.MediaPlayer2.first" );
+        QTRY_COMPARE( registry.players(),
+                      QStringList{ "org.mpris.MediaPlayer2.first" } );
+
+        auto second = std::make_unique<FakePlayer>(
+            m_address, "org.mpris.MediaPlayer2.second" );
+        QTRY_COMPARE( registry.players(),
+                      ( QStringList{ "org.mpris.MediaPlayer2.first",
+                                     "org.mpris.MediaPlayer2.second" } ) );
+
+        second.reset();
+        QTRY_COMPARE( registry.players(),
+                      QStringList{ "org.mpris.MediaPlayer2.first" } );
+    }
+    QTRY_VERIFY( registry.players().isEmpty() );
+}
+
+void MprisPlayersTest::callsReachOnlyActivePlayer()
+{
+    FakePlayer first( m_address, "org.mpris.MediaPlayer2.first" );
+    FakePlayer second( m_address, "org.mpris.MediaPlayer2.second" );
+    FakePlayer third( m_address, "org.mpris.MediaPlayer2.third" );
+    MprisPlayerRegistry registry( bus() );
+    QTRY_COMPARE( registry.players().size(), 3 );
+    second.setPlaybackStatus( "Playing" );
+    QTRY_COMPARE( registry.activePlayer(),
+                  QString( "org.mpris.MediaPlayer2.second" ) );
+
+    registry.callActive( "Next" );
+    registry.callActive( "PlayPause" );
+
+    QTRY_COMPARE( second.calls( "Next" ), 1 );
+    QTRY_COMPARE( second.calls( "PlayPause" ), 1 );
+    QCOMPARE( first.calls( "Next" ) + third.calls( "Next" ), 0 );
+    QCOMPARE( first.calls( "PlayPause" ) + third.calls( "PlayPause" ), 0 );
+}
+
+void MprisPlayersTest::callsBeforeListingAreSent()
+{
+    FakePlayer player( m_address, "org.mpris.MediaPlayer2.early" );
+    MprisPlayerRegistry registry( bus() );
+
+    registry.callActive( "Stop" );
+
+    QTRY_COMPARE( player.calls( "Stop" ), 1 );
+}
+
+void MprisPlayersTest::callsDontWaitForReplies()
+{
+    FakePlayer hung( m_address,
+                     "org.mpris.MediaPlayer2.hung",
+                     FakePlayer::Replies::Never );
+    FakePlayer player( m_address, "org.mpris.MediaPlayer2.player" );
+    MprisPlayerRegistry registry( bus() );
+    QTRY_COMPARE( registry.players().size(), 2 );
+    registry.pinPlayer( "org.mpris.MediaPlayer2.hung" );
+
+    constexpr int k_presses = 100;
+    QElapsedTimer timer;
+    timer.start();
+    for ( int i = 0; i < k_presses; ++i )
+    {
+        registry.callActive( "PlayPause" );
+    }
+    const auto elapsed = timer.nsecsElapsed();
+
+    QTRY_COMPARE( hung.calls( "PlayPause" ), k_presses );
+    QCOMPARE( player.calls( "PlayPause" ), 0 );
+    qInfo() << "Dispatching" << k_presses << "presses took"
+            << elapsed / 1000 << "us";
+    // A blocking call would wait for the hung player until it times out.
+    QVERIFY( elapsed < 100 * 1000 * 1000 );
+}
+
+void MprisPlayersTest::trackIsFetched()
+{
+    FakePlayer player( m_address, "org.mpris.MediaPlayer2.fetched" );
+    player.setTrack( "Title", { "First", "Second" }, 180'000'000 );
+    player.setPlaybackStatus( "Paused" );
+    player.seek( 42'000'000 );
+
+    MprisPlayerRegistry registry( bus() );
+
+    QTRY_COMPARE( registry.nowPlaying().title, QString( "Title" ) );
+    const auto state = registry.nowPlaying();
+    QCOMPARE( state.player, QString( "fetched" ) );
+    QCOMPARE( state.artist, QString( "First, Second" ) );
+    QCOMPARE( state.playbackStatus, QString( "Paused" ) );
+    QCOMPARE( state.positionUs, qint64{ 42'000'000 } );
+    QCOMPARE( state.lengthUs, qint64{ 180'000'000 } );
+}
+
+void MprisPlayersTest::changesAreFollowed()
+{
+    FakePlayer player( m_address, "org.mpris.MediaPlayer2.changing" );
+    MprisPlayerRegistry registry( bus() );
+    QTRY_COMPARE( registry.nowPlaying().playbackStatus, QString( "Stopped" ) );
+
+    player.setTrack( "New", { "Artist" }, 1'000'000 );
+    player.setPlaybackStatus( "Playing" );
+
+    QTRY_COMPARE( registry.nowPlaying().title, QString( "New" ) );
+    QTRY_COMPARE( registry.nowPlaying().playbackStatus, QString( "Playing" ) );
+    QCOMPARE( registry.nowPlaying().artist, QString( "Artist" ) );
+}
+
+void MprisPlayersTest::seeksAreFollowed()
+{
+    FakePlayer player( m_address, "org.mpris.MediaPlayer2.seeking" );
+    player.setTrack( "Track", {}, 60'000'000 );
+    MprisPlayerRegistry registry( bus() );
+    QTRY_COMPARE( registry.nowPlaying().title, QString( "Track" ) );
+
+    player.seek( 30'000'000 );
+
+    QTRY_COMPARE( registry.nowPlaying().positionUs, qint64{ 30'000'000 } );
+}
+
+void MprisPlayersTest::lastPlayingPlayerIsActive()
+{
+    FakePlayer first( m_address, "org.mpris.MediaPlayer2.first" );
+    FakePlayer second( m_address, "org.mpris.MediaPlayer2.second" );
+    first.setTrack( "First track", {}, 0 );
+    second.setTrack( "Second track", {}, 0 );
+    MprisPlayerRegistry registry( bus() );
+    QTRY_COMPARE( registry.nowPlaying().title, QString( "First track" ) );
+
+    second.setPlaybackStatus( "Playing" );
+    QTRY_COMPARE( registry.activePlayer(),
+                  QString( "org.mpris.MediaPlayer2.second" ) );
+    QCOMPARE( registry.nowPlaying().title, QString( "Second track" ) );
+
+    first.setPlaybackStatus( "Playing" );
+    QTRY_COMPARE( registry.activePlayer(),
+                  QString( "org.mpris.MediaPlayer2.first" ) );
+
+    // Pausing doesn't hand over to the other player.
+    first.setPlaybackStatus( "Paused" );
+    QTRY_COMPARE( registry.nowPlaying().playbackStatus, QString( "Paused" ) );
+    QCOMPARE( registry.activePlayer(),
+              QString( "org.mpris.MediaPlayer2.first" ) );
+}
+
+void MprisPlayersTest::nowPlayingOnlyChangesOnChange()
+{
+    FakePlayer player( m_address, "org.mpris.MediaPlayer2.model" );
+    player.setTrack( "Song", { "Band" }, 0 );
+    MprisPlayerRegistry registry( bus() );
+    NowPlaying model;
+    connect( &registry, &MprisPlayerRegistry::nowPlayingChanged, [&] {
+        model.setState( registry.nowPlaying() );
+    } );
+    QTRY_COMPARE( model.title(), QString( "Song" ) );
+    QSignalSpy changes( &model, &NowPlaying::changed );
+
+    // The same values again, and a player that isn't active.
+    player.setTrack( "Song", { "Band" }, 0 );
+    FakePlayer other( m_address, "org.mpris.MediaPlayer2.other" );
+    other.setTrack( "Other song", {}, 0 );
+    QTRY_COMPARE( registry.players().size(), 2 );
+    QTest::qWait( 100 );
+    QCOMPARE( changes.count(), 0 );
+
+    player.setPlaybackStatus( "Playing" );
+    QTRY_COMPARE( model.playbackStatus(), QString( "Playing" ) );
+    QCOMPARE( changes.count(), 1 );
+}
+
+void MprisPlayersTest::applicationNames()
+{
+    QCOMPARE( MprisPlayerRegistry::shortName( "org.mpris.MediaPlayer2.vlc" ),
+              QString( "vlc" ) );
+    QCOMPARE( MprisPlayerRegistry::shortName(
+                  "org.mpris.MediaPlayer2.vlc.instance42" ),
+              QString( "vlc.instance42" ) );
+    QCOMPARE( MprisPlayerRegistry::applicationName(
+                  "org.mpris.MediaPlayer2.vlc.instance42" ),
+              QString( "vlc" ) );
+    QCOMPARE( MprisPlayerRegistry::applicationName(
+                  "org.mpris.MediaPlayer2.spotify" ),
+              QString( "spotify" ) );
+    QCOMPARE( MprisPlayerRegistry::applicationName(
+                  "org.mpris.MediaPlayer2.io.bassi.Amberol.instance7" ),
+              QString( "io.bassi.Amberol" ) );
+}
+
+void MprisPlayersTest::pinnedPlayerIsActive()
+{
+    auto pinned = std::make_unique<FakePlayer>(
+        m_address, "org.mpris.MediaPlayer2.pinned" );
+    FakePlayer playing( m_address, "org.mpris.MediaPlayer2.playing" );
+    MprisPlayerRegistry registry( bus() );
+    QTRY_COMPARE( registry.players().size(), 2 );
+
+    playing.setPlaybackStatus( "Playing" );
+    QTRY_COMPARE( registry.activePlayer(),
+                  QString( "org.mpris.MediaPlayer2.playing" ) );
+
+    registry.pinPlayer( "org.mpris.MediaPlayer2.pinned" );
+    QCOMPARE( registry.activePlayer(),
+              QString( "org.mpris.MediaPlayer2.pinned" ) );
+
+    registry.callActive( "Stop" );
+    QTRY_COMPARE( pinned->calls( "Stop" ), 1 );
+    QCOMPARE( playing.calls( "Stop" ), 0 );
+
+    // Closing unpins.
+    pinned.reset();
+    QTRY_COMPARE( registry.activePlayer(),
+                  QString( "org.mpris.MediaPlayer2.playing" ) );
+    QVERIFY( registry.pinnedPlayer().isEmpty() );
+}
+
+void MprisPlayersTest::preferredApplicationIsActive()
+{
+    FakePlayer first( m_address, "org.mpris.MediaPlayer2.vlc.instance1" );
+    FakePlayer second( m_address, "org.mpris.MediaPlayer2.vlc.instance2" );
+    FakePlayer other( m_address, "org.mpris.MediaPlayer2.spotify" );
+    MprisPlayerRegistry registry( bus() );
+    QTRY_COMPARE( registry.players().size(), 3 );
+    other.setPlaybackStatus( "Playing" );
+    QTRY_COMPARE( registry.activePlayer(),
+                  QString( "org.mpris.MediaPlayer2.spotify" ) );
+
+    registry.setPreferredApplication( "vlc" );
+    QCOMPARE( registry.activePlayer(),
+              QString( "org.mpris.MediaPlayer2.vlc.instance1" ) );
+
+    // Of the preferred players, the one that started playing last.
+    second.setPlaybackStatus( "Playing" );
+    QTRY_COMPARE( registry.activePlayer(),
+                  QString( "org.mpris.MediaPlayer2.vlc.instance2" ) );
+
+    registry.setPreferredApplication( "mpv" );
+    QCOMPARE( registry.activePlayer(),
+              QString( "org.mpris.MediaPlayer2.vlc.instance2" ) );
+}
+
+QTEST_GUILESS_MAIN( MprisPlayersTest )
+
+#include "./release/tst_mprisplayerstest.moc"
@@ -0,0 +1,24 @@
+QT += testlib
+QT -= gui
+CONFIG   += c++1z
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += ../../src/settings \
+    ../../third-party/easylogging++
+
+SOURCES +=  tst_profilestoretest.cpp \
+    ../../src/settings/settings_object.cpp \
+    ../../src/settings/profile_list_model.cpp \
+    ../../src/settings/profile_collection.cpp \
+    ../../third-party/easylogging++/easylogging++.cc
+
+HEADERS += \
+    ../../src/settings/settings_object.h \
+    ../../src/settings/profile_store.h \
+    ../../src/settings/profile_list_model.h \
+    ../../src/settings/profile_collection.h \
+    ../../src/settings/internal/settings_object_data.h
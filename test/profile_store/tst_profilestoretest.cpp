@@ -0,0 +1,401 @@
+#include <QtTest>
+#include <QSettings>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <memory>
+#include "profile_store.h"
+
+INITIALIZE_EASYLOGGINGPP
+
+namespace
+{
+std::unique_ptr<QTemporaryDir> g_settingsDir;
+std::unique_ptr<QSettings> g_settings;
+
+// Roughly the size of a chaperone profile with a detailed boundary.
+constexpr int k_geometryValuesPerProfile = 1024;
+
+struct TestProfile : settings::ISettingsObject
+{
+    std::string profileName;
+    int mode = 0;
+    std::vector<double> geometry;
+
+    settings::SettingsObjectData saveSettings() const override
+    {
+        settings::SettingsObjectData o;
+
+        o.addValue( profileName );
+        o.addValue( mode );
+        o.reserve<double>( geometry.size() + 1 );
+        o.addValue( static_cast<int>( geometry.size() ) );
+        for ( const auto v : geometry )
+        {
+            o.addValue( v );
+        }
+
+        return o;
+    }
+
+    void loadSettings( settings::SettingsObjectData& obj ) override
+    {
+        profileName = obj.getNextValueOrDefault( "" );
+        mode = obj.getNextValueOrDefault( 0 );
+        const auto size = obj.getNextValueOrDefault( 0 );
+        geometry.resize( static_cast<std::size_t>( size ) );
+        for ( auto& v : geometry )
+        {
+            v = obj.getNextValueOrDefault( 0.0 );
+        }
+    }
+
+    std::string settingsName() const override
+    {
+        return "testProfiles";
+    }
+};
+
+// Like the audio profiles, one of them can be applied on start.
+struct DefaultTestProfile : TestProfile
+{
+    bool defaultProfile = false;
+
+    settings::SettingsObjectData saveSettings() const override
+    {
+        auto o = TestProfile::saveSettings();
+        o.addValue( defaultProfile );
+        return o;
+    }
+
+    void loadSettings( settings::SettingsObjectData& obj ) override
+    {
+        TestProfile::loadSettings( obj );
+        defaultProfile = obj.getNextValueOrDefault( false );
+    }
+
+    std::string settingsName() const override
+    {
+        return "defaultTestProfiles";
+    }
+};
+
+TestProfile createProfile( const int i )
+{
+    TestProfile p;
+    p.profileName = "Profile " + std::to_string( i );
+    p.mode = i;
+    p.geometry.assign( k_geometryValuesPerProfile, static_cast<double>( i ) );
+    return p;
+}
+
+void fillStore( settings::ProfileStore<TestProfile>& store, const int count )
+{
+    for ( int i = 0; i < count; ++i )
+    {
+        store.put( createProfile( i ) );
+    }
+    store.save();
+}
+
+void resetSettingsFile()
+{
+    g_settings.reset();
+    g_settingsDir = std::make_unique<QTemporaryDir>();
+    g_settings = std::make_unique<QSettings>(
+        g_settingsDir->filePath( "settings.ini" ), QSettings::IniFormat );
+}
+
+void addProfileCountRows()
+{
+    QTest::addColumn<int>( "profileCount" );
+
+    QTest::newRow( "100 profiles" ) << 100;
+    QTest::newRow( "500 profiles" ) << 500;
+}
+
+} // namespace
+
+namespace settings
+{
+// Stands in for the application settings file.
+QSettings& getQSettings()
+{
+    return *g_settings;
+}
+} // namespace settings
+
+class ProfileStoreTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+
+    void loadOnlyReadsNames();
+
+    void putReplacesProfileWithSameName();
+
+    void removeCompactsSlots();
+
+    void renameUpdatesIndex();
+
+    void missingNameIndexIsRebuilt();
+
+    void staleNameIndexIsReplaced();
+
+    void defaultFlagsAreIndexed();
+
+    void modelHasEmptyFirstRow();
+
+    void importOnlyChangesDifferentProfiles();
+
+    void loadNamesBenchmarked_data();
+    void loadNamesBenchmarked();
+
+    void loadAllObjectsBenchmarked_data();
+    void loadAllObjectsBenchmarked();
+};
+
+void ProfileStoreTest::init()
+{
+    resetSettingsFile();
+}
+
+void ProfileStoreTest::loadOnlyReadsNames()
+{
+    {
+        settings::ProfileStore<TestProfile> store;
+        fillStore( store, 3 );
+    }
+
+    settings::ProfileStore<TestProfile> store;
+    store.load();
+
+    QCOMPARE( store.size(), std::size_t{ 3 } );
+    QCOMPARE( store.name( 1 ), std::string( "Profile 1" ) );
+    QCOMPARE( store.loadedCount(), std::size_t{ 0 } );
+
+    QCOMPARE( store.at( 2 ).mode, 2 );
+    QCOMPARE( store.at( 2 ).geometry.size(),
+              std::size_t{ k_geometryValuesPerProfile } );
+    QCOMPARE( store.loadedCount(), std::size_t{ 1 } );
+}
+
+void ProfileStoreTest::putReplacesProfileWithSameName()
+{
+    settings::ProfileStore<TestProfile> store;
+    fillStore( store, 2 );
+
+    auto replacement = createProfile( 0 );
+    replacement.mode = 42;
+    QCOMPARE( store.put( replacement ), std::size_t{ 0 } );
+    store.save();
+
+    settings::ProfileStore<TestProfile> loaded;
+    loaded.load();
+    QCOMPARE( loaded.size(), std::size_t{ 2 } );
+    QCOMPARE( loaded.at( 0 ).mode, 42 );
+}
+
+void ProfileStoreTest::removeCompactsSlots()
+{
+    settings::ProfileStore<TestProfile> store;
+    fillStore( store, 4 );
+
+    store.remove( 1 );
+    store.save();
+
+    TestProfile prototype;
+    QCOMPARE( settings::getAmountOfSavedObjects( prototype ), 3 );
+
+    settings::ProfileStore<TestProfile> loaded;
+    loaded.load();
+    QCOMPARE( loaded.size(), std::size_t{ 3 } );
+    QCOMPARE( loaded.name( 1 ), std::string( "Profile 2" ) );
+    QCOMPARE( loaded.at( 1 ).mode, 2 );
+    QCOMPARE( loaded.at( 2 ).mode, 3 );
+    QVERIFY( !loaded.indexOf( "Profile 1" ) );
+}
+
+void ProfileStoreTest::renameUpdatesIndex()
+{
+    settings::ProfileStore<TestProfile> store;
+    fillStore( store, 2 );
+
+    store.rename( 0, "Renamed" );
+    store.save();
+
+    QVERIFY( !store.indexOf( "Profile 0" ) );
+    QCOMPARE( *store.indexOf( "Renamed" ), std::size_t{ 0 } );
+
+    settings::ProfileStore<TestProfile> loaded;
+    loaded.load();
+    QCOMPARE( loaded.name( 0 ), std::string( "Renamed" ) );
+    QCOMPARE( loaded.at( 0 ).profileName, std::string( "Renamed" ) );
+}
+
+void ProfileStoreTest::missingNameIndexIsRebuilt()
+{
+    // Profiles saved before the store existed have no name index.
+    std::vector<TestProfile> profiles{ createProfile( 0 ), createProfile( 1 ) };
+    settings::saveAllObjects( profiles );
+
+    settings::ProfileStore<TestProfile> store;
+    store.load();
+    QCOMPARE( store.size(), std::size_t{ 2 } );
+    QCOMPARE( store.name( 1 ), std::string( "Profile 1" ) );
+
+    settings::ProfileStore<TestProfile> loaded;
+    loaded.load();
+    QCOMPARE( loaded.loadedCount(), std::size_t{ 0 } );
+    QCOMPARE( loaded.name( 1 ), std::string( "Profile 1" ) );
+}
+
+void ProfileStoreTest::staleNameIndexIsReplaced()
+{
+    {
+        settings::ProfileStore<TestProfile> store;
+        fillStore( store, 2 );
+    }
+    // Same number of slots, written without updating the index.
+    std::vector<TestProfile> profiles{ createProfile( 5 ), createProfile( 6 ) };
+    settings::saveAllObjects( profiles );
+
+    settings::ProfileStore<TestProfile> store;
+    store.load();
+    QCOMPARE( store.name( 1 ), std::string( "Profile 1" ) );
+
+    QCOMPARE( store.at( 0 ).mode, 5 );
+    QCOMPARE( store.name( 0 ), std::string( "Profile 5" ) );
+    QCOMPARE( store.name( 1 ), std::string( "Profile 6" ) );
+    QVERIFY( !store.indexOf( "Profile 1" ) );
+    QCOMPARE( *store.indexOf( "Profile 6" ), std::size_t{ 1 } );
+
+    settings::ProfileStore<TestProfile> loaded;
+    loaded.load();
+    QCOMPARE( loaded.name( 1 ), std::string( "Profile 6" ) );
+    QCOMPARE( loaded.loadedCount(), std::size_t{ 0 } );
+}
+
+void ProfileStoreTest::defaultFlagsAreIndexed()
+{
+    {
+        settings::ProfileStore<DefaultTestProfile> store;
+        for ( int i = 0; i < 3; ++i )
+        {
+            DefaultTestProfile p;
+            p.profileName = "Profile " + std::to_string( i );
+            p.defaultProfile = i == 1;
+            store.put( std::move( p ) );
+        }
+        store.save();
+    }
+
+    settings::ProfileStore<DefaultTestProfile> store;
+    store.load();
+    QVERIFY( !store.isDefault( 0 ) );
+    QVERIFY( store.isDefault( 1 ) );
+    QCOMPARE( store.loadedCount(), std::size_t{ 0 } );
+
+    // Seen before the next save, and written with it.
+    store.edit( 1 ).defaultProfile = false;
+    store.edit( 2 ).defaultProfile = true;
+    QVERIFY( !store.isDefault( 1 ) );
+    QVERIFY( store.isDefault( 2 ) );
+    store.save();
+
+    settings::ProfileStore<DefaultTestProfile> loaded;
+    loaded.load();
+    QVERIFY( !loaded.isDefault( 1 ) );
+    QVERIFY( loaded.isDefault( 2 ) );
+    QCOMPARE( loaded.loadedCount(), std::size_t{ 0 } );
+}
+
+void ProfileStoreTest::modelHasEmptyFirstRow()
+{
+    settings::ProfileStore<TestProfile> store;
+    auto& model = store.model();
+    QSignalSpy inserted( &model, &QAbstractItemModel::rowsInserted );
+
+    store.put( createProfile( 0 ) );
+
+    QCOMPARE( inserted.count(), 1 );
+    QCOMPARE( model.rowCount(), 2 );
+    QCOMPARE( model.data( model.index( 0 ) ).toString(), QString() );
+    QCOMPARE( model.data( model.index( 1 ) ).toString(),
+              QString( "Profile 0" ) );
+}
+
+void ProfileStoreTest::importOnlyChangesDifferentProfiles()
+{
+    settings::ProfileStore<TestProfile> store;
+    fillStore( store, 3 );
+
+    QCOMPARE( settings::profileCollections().size(), std::size_t{ 1 } );
+    auto profiles = store.exportProfiles();
+    QCOMPARE( profiles.size(), std::size_t{ 3 } );
+
+    QCOMPARE( store.importProfiles( profiles ), 0 );
+
+    auto edited = createProfile( 1 );
+    edited.mode = 42;
+    profiles[1] = edited.saveSettings();
+    profiles.pop_back();
+    QCOMPARE( store.importProfiles( profiles ), 2 );
+
+    settings::ProfileStore<TestProfile> loaded;
+    loaded.load();
+    QCOMPARE( loaded.size(), std::size_t{ 2 } );
+    QCOMPARE( loaded.at( 1 ).mode, 42 );
+    QCOMPARE( loaded.at( 0 ).mode, 0 );
+}
+
+void ProfileStoreTest::loadNamesBenchmarked_data()
+{
+    addProfileCountRows();
+}
+
+void ProfileStoreTest::loadNamesBenchmarked()
+{
+    QFETCH( int, profileCount );
+
+    {
+        settings::ProfileStore<TestProfile> store;
+        fillStore( store, profileCount );
+    }
+
+    settings::ProfileStore<TestProfile> store;
+    QBENCHMARK_ONCE
+    {
+        store.load();
+    }
+
+    QCOMPARE( store.size(), static_cast<std::size_t>( profileCount ) );
+}
+
+void ProfileStoreTest::loadAllObjectsBenchmarked_data()
+{
+    addProfileCountRows();
+}
+
+void ProfileStoreTest::loadAllObjectsBenchmarked()
+{
+    QFETCH( int, profileCount );
+
+    {
+        settings::ProfileStore<TestProfile> store;
+        fillStore( store, profileCount );
+    }
+
+    std::vector<TestProfile> loaded;
+    QBENCHMARK_ONCE
+    {
+        settings::loadAllObjects( loaded );
+    }
+
+    QCOMPARE( loaded.size(), static_cast<std::size_t>( profileCount ) );
+}
+
+QTEST_APPLESS_MAIN( ProfileStoreTest )
+
+#include "./release/tst_profilestoretest.moc"
@@ -0,0 +1,243 @@
+#include <QtTest>
+#include <QSettings>
+#include <QTemporaryDir>
+#include <string>
+#include <type_traits>
+#include "settings_controller.h"
+
+INITIALIZE_EASYLOGGINGPP
+
+using settings::BoolSetting;
+using settings::DirtySettings;
+using settings::DoubleSetting;
+using settings::IntSetting;
+using settings::SettingsController;
+using settings::StringSetting;
+
+class DirtySettingsTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void sizedFromLastEnumerator();
+
+    void settingValueReportsChanges();
+
+    void unchangedValueIsNotMarked();
+
+    void lastValueReachesFile();
+
+    void millionSetsStayBounded();
+
+    void minuteOfTicksBenchmarked_data();
+    void minuteOfTicksBenchmarked();
+
+private:
+    QTemporaryDir m_settingsDir;
+};
+
+namespace
+{
+// A separate instance only sees what reached the file.
+QVariant savedValue( const QString& group, const QString& key )
+{
+    QSettings s( settings::getQSettings().fileName(), QSettings::IniFormat );
+    s.beginGroup( group );
+    const auto v = s.value( key );
+    s.endGroup();
+    return v;
+}
+
+// One minute of event loop ticks at the default tick rate of 20 ms.
+constexpr int k_ticksPerMinute = 60 * 1000 / 20;
+
+} // namespace
+
+void DirtySettingsTest::initTestCase()
+{
+    QVERIFY( m_settingsDir.isValid() );
+    // Has to happen before the first call of getQSettings.
+    QSettings::setPath(
+        QSettings::IniFormat, QSettings::UserScope, m_settingsDir.path() );
+    QVERIFY( settings::getQSettings().fileName().startsWith(
+        m_settingsDir.path() ) );
+}
+
+void DirtySettingsTest::sizedFromLastEnumerator()
+{
+    QCOMPARE( DirtySettings<BoolSetting>::size,
+              static_cast<std::size_t>( BoolSetting::LAST_ENUMERATOR ) + 1 );
+    QCOMPARE( DirtySettings<StringSetting>::size,
+              static_cast<std::size_t>( StringSetting::LAST_ENUMERATOR ) + 1 );
+
+    // No heap allocations, the tracker can't grow no matter how often
+    // settings are set.
+    QVERIFY( std::is_trivially_copyable<DirtySettings<IntSetting>>::value );
+}
+
+void DirtySettingsTest::settingValueReportsChanges()
+{
+    settings::IntSettingValue value( IntSetting::PLAYSPACE_snapTurnAngle,
+                                     settings::SettingCategory::Playspace,
+                                     settings::QtInfo{ "snapTurnAngle" },
+                                     4500 );
+
+    // The default is created in the file when the setting is missing.
+    QVERIFY( savedValue( "playspaceSettings", "snapTurnAngle" ).isValid() );
+
+    const auto current = value.value();
+    QVERIFY( !value.setValue( current ) );
+    QVERIFY( value.setValue( current + 1 ) );
+    QCOMPARE( value.value(), current + 1 );
+}
+
+void DirtySettingsTest::unchangedValueIsNotMarked()
+{
+    SettingsController c;
+    const auto setting = IntSetting::PLAYSPACE_smoothTurnRate;
+    const auto current = c.getSetting<int>( setting );
+    const auto published = c.publishedChanges();
+
+    c.setSetting( setting, current );
+    QCOMPARE( c.unsavedChanges(), std::size_t{ 0 } );
+    QCOMPARE( c.publishedChanges(), published );
+
+    c.setSetting( setting, current + 1 );
+    QCOMPARE( c.unsavedChanges(), std::size_t{ 1 } );
+    QCOMPARE( c.publishedChanges(), published + 1 );
+
+    c.saveChangedSettings();
+    QCOMPARE( c.unsavedChanges(), std::size_t{ 0 } );
+
+    c.setSetting( setting, current + 1 );
+    QCOMPARE( c.unsavedChanges(), std::size_t{ 0 } );
+}
+
+void DirtySettingsTest::lastValueReachesFile()
+{
+    {
+        SettingsController c;
+        for ( int i = 0; i < 10; ++i )
+        {
+            c.setSetting( DoubleSetting::PLAYSPACE_gravityStrength,
+                          1.0 + i );
+            c.setSetting( StringSetting::KEYBOARDSHORTCUT_keyboardOne,
+                          std::to_string( i ) );
+        }
+        QCOMPARE( c.unsavedChanges(), std::size_t{ 2 } );
+
+        c.saveChangedSettings();
+        QCOMPARE( c.unsavedChanges(), std::size_t{ 0 } );
+        // The queued write is finished when the controller is destroyed.
+    }
+
+    QCOMPARE( savedValue( "playspaceSettings", "gravityStrength" ).toDouble(),
+              10.0 );
+    QCOMPARE( savedValue( "keyboardShortcuts", "keyboardOne" ).toString(),
+              QString( "9" ) );
+}
+
+void DirtySettingsTest::millionSetsStayBounded()
+{
+    SettingsController c;
+    const auto writesBefore = c.fileWrites();
+
+    constexpr int iterations = 1000000;
+    // Roughly how often the GUI thread saves during a busy session.
+    constexpr int saveInterval = 100000;
+    for ( int i = 0; i < iterations; ++i )
+    {
+        // Alternate so every call is an actual change.
+        c.setSetting( DoubleSetting::PLAYSPACE_heightToggleOffset,
+                      ( i % 2 == 0 ) ? 0.5 : 0.25 );
+        c.setSetting( BoolSetting::PLAYSPACE_lockXToggle, i % 2 == 0 );
+
+        QVERIFY( c.unsavedChanges() <= std::size_t{ 2 } );
+        if ( ( i + 1 ) % saveInterval == 0 )
+        {
+            c.saveChangedSettings();
+            QCOMPARE( c.unsavedChanges(), std::size_t{ 0 } );
+        }
+    }
+
+    // Two million changes reach the file in one write per save.
+    QCOMPARE( c.fileWrites() - writesBefore,
+              static_cast<unsigned long long>( iterations / saveInterval ) );
+    QCOMPARE( savedValue( "playspaceSettings", "heightToggleOffset" )
+                  .toDouble(),
+              0.25 );
+}
+
+void DirtySettingsTest::minuteOfTicksBenchmarked_data()
+{
+    QTest::addColumn<bool>( "subscribed" );
+
+    // Before: the setting is read on every tick.
+    QTest::newRow( "polling" ) << false;
+    // After: a subscription keeps a copy that is updated on changes.
+    QTest::newRow( "subscribed" ) << true;
+}
+
+void DirtySettingsTest::minuteOfTicksBenchmarked()
+{
+    QFETCH( bool, subscribed );
+
+    SettingsController c;
+    const auto setting = IntSetting::CHAPERONE_reloadDebounceTicks;
+    const auto initial = c.getSetting<int>( setting );
+
+    int reads = 0;
+    int notifications = 0;
+    auto debounceTicks = initial;
+    const auto id = c.subscribe( setting, [&]( const int value ) {
+        if ( subscribed )
+        {
+            debounceTicks = value;
+            ++notifications;
+        }
+    } );
+
+    long long elapsedTicks = 0;
+    QBENCHMARK
+    {
+        reads = 0;
+        notifications = 0;
+        for ( int tick = 0; tick < k_ticksPerMinute; ++tick )
+        {
+            // The user changes the setting once a minute.
+            if ( tick == k_ticksPerMinute / 2 )
+            {
+                c.setSetting( setting,
+                              c.getSetting<int>( setting ) == initial
+                                  ? initial + 1
+                                  : initial );
+            }
+            if ( !subscribed )
+            {
+                debounceTicks = c.getSetting<int>( setting );
+                ++reads;
+            }
+            elapsedTicks += debounceTicks;
+        }
+    }
+    c.unsubscribe( id );
+
+    QVERIFY( elapsedTicks > 0 );
+    QCOMPARE( debounceTicks, c.getSetting<int>( setting ) );
+    if ( subscribed )
+    {
+        QCOMPARE( reads, 0 );
+        QCOMPARE( notifications, 1 );
+    }
+    else
+    {
+        QCOMPARE( reads, k_ticksPerMinute );
+        QCOMPARE( notifications, 0 );
+    }
+}
+
+QTEST_GUILESS_MAIN( DirtySettingsTest )
+
+#include "./release/tst_dirtysettingstest.moc"
@@ -0,0 +1,274 @@
+#include <QtTest>
+#include <QSettings>
+#include <QTemporaryDir>
+#include <memory>
+#include "settings_object.h"
+
+INITIALIZE_EASYLOGGINGPP
+
+namespace
+{
+std::unique_ptr<QTemporaryDir> g_settingsDir;
+std::unique_ptr<QSettings> g_settings;
+
+// Roughly the size of a chaperone profile with a detailed boundary.
+constexpr int k_geometryValuesPerProfile = 1024;
+
+struct TestProfile : settings::ISettingsObject
+{
+    std::string name;
+    bool enabled = false;
+    int mode = 0;
+    std::vector<double> geometry;
+
+    settings::SettingsObjectData saveSettings() const override
+    {
+        settings::SettingsObjectData o;
+
+        o.addValue( name );
+        o.addValue( enabled );
+        o.addValue( mode );
+        o.reserve<double>( geometry.size() + 1 );
+        o.addValue( static_cast<int>( geometry.size() ) );
+        for ( const auto v : geometry )
+        {
+            o.addValue( v );
+        }
+
+        return o;
+    }
+
+    void loadSettings( settings::SettingsObjectData& obj ) override
+    {
+        name = obj.getNextValueOrDefault( "" );
+        enabled = obj.getNextValueOrDefault( false );
+        mode = obj.getNextValueOrDefault( 0 );
+        const auto size = obj.getNextValueOrDefault( 0 );
+        geometry.resize( static_cast<std::size_t>( size ) );
+        for ( auto& v : geometry )
+        {
+            v = obj.getNextValueOrDefault( 0.0 );
+        }
+    }
+
+    std::string settingsName() const override
+    {
+        return "testProfiles";
+    }
+};
+
+std::vector<TestProfile> createProfiles( const int count )
+{
+    std::vector<TestProfile> profiles( static_cast<std::size_t>( count ) );
+    auto value = 0.0;
+    for ( int i = 0; i < count; ++i )
+    {
+        auto& p = profiles[static_cast<std::size_t>( i )];
+        p.name = "Profile " + std::to_string( i );
+        p.enabled = i % 2 == 0;
+        p.mode = i;
+        p.geometry.resize( k_geometryValuesPerProfile );
+        for ( auto& v : p.geometry )
+        {
+            v = value;
+            value += 0.25;
+        }
+    }
+    return profiles;
+}
+
+void resetSettingsFile()
+{
+    g_settings.reset();
+    g_settingsDir = std::make_unique<QTemporaryDir>();
+    g_settings = std::make_unique<QSettings>(
+        g_settingsDir->filePath( "settings.ini" ), QSettings::IniFormat );
+}
+
+void addProfileCountRows()
+{
+    QTest::addColumn<int>( "profileCount" );
+
+    QTest::newRow( "100 profiles" ) << 100;
+    QTest::newRow( "1000 profiles" ) << 1000;
+    QTest::newRow( "5000 profiles" ) << 5000;
+}
+
+} // namespace
+
+namespace settings
+{
+// Stands in for the application settings file.
+QSettings& getQSettings()
+{
+    return *g_settings;
+}
+} // namespace settings
+
+class SettingsObjectTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+
+    void valuesAreReadInOrder();
+
+    void missingValuesReturnDefault();
+
+    void takeValuesSkipsReadValues();
+
+    void onlyUnreadValuesAreCompared();
+
+    void profilesRoundTrip();
+
+    void objectDataBenchmarked();
+
+    void saveProfilesBenchmarked_data();
+    void saveProfilesBenchmarked();
+
+    void loadProfilesBenchmarked_data();
+    void loadProfilesBenchmarked();
+};
+
+void SettingsObjectTest::init()
+{
+    resetSettingsFile();
+}
+
+void SettingsObjectTest::valuesAreReadInOrder()
+{
+    settings::SettingsObjectData o;
+    o.addValue( 1 );
+    o.addValue( true );
+    o.addValue( 2 );
+    o.addValue( "text" );
+    o.addValue( 3 );
+
+    QCOMPARE( o.getNextValueOrDefault( 0 ), 1 );
+    QCOMPARE( o.getNextValueOrDefault( 0 ), 2 );
+    QCOMPARE( o.getNextValueOrDefault( false ), true );
+    QCOMPARE( o.getNextValueOrDefault( 0 ), 3 );
+    QCOMPARE( o.getNextValueOrDefault( "" ), std::string( "text" ) );
+    QVERIFY( !o.hasValuesOfType<int>() );
+}
+
+void SettingsObjectTest::missingValuesReturnDefault()
+{
+    settings::SettingsObjectData o;
+
+    QCOMPARE( o.getNextValueOrDefault( 5 ), 5 );
+    QCOMPARE( o.getNextValueOrDefault( 2.5 ), 2.5 );
+    QCOMPARE( o.getNextValueOrDefault( "default" ), std::string( "default" ) );
+}
+
+void SettingsObjectTest::takeValuesSkipsReadValues()
+{
+    settings::SettingsObjectData o;
+    o.addValue( 1.0 );
+    o.addValue( 2.0 );
+    o.addValue( 3.0 );
+
+    o.consumeDeprecatedValue<double>();
+
+    const auto values = o.takeValues<double>();
+    QCOMPARE( values.size(), std::size_t{ 2 } );
+    QCOMPARE( values[0], 2.0 );
+    QVERIFY( !o.hasValuesOfType<double>() );
+}
+
+void SettingsObjectTest::onlyUnreadValuesAreCompared()
+{
+    const auto create = []( const char* first ) {
+        settings::SettingsObjectData o;
+        o.addValue( first );
+        o.addValue( "second" );
+        o.addValue( 1 );
+        return o;
+    };
+    auto a = create( "first" );
+    auto b = create( "first" );
+    QVERIFY( a == b );
+
+    // Only one string is left to read in a.
+    a.getNextValueOrDefault( "" );
+    QVERIFY( !( a == b ) );
+    b.getNextValueOrDefault( "" );
+    QVERIFY( a == b );
+
+    // Values that were read don't count.
+    auto c = create( "other" );
+    c.getNextValueOrDefault( "" );
+    QVERIFY( a == c );
+}
+
+void SettingsObjectTest::profilesRoundTrip()
+{
+    const auto saved = createProfiles( 3 );
+    settings::saveAllObjects( saved );
+
+    std::vector<TestProfile> loaded;
+    settings::loadAllObjects( loaded );
+
+    QCOMPARE( loaded.size(), saved.size() );
+    for ( std::size_t i = 0; i < saved.size(); ++i )
+    {
+        QCOMPARE( loaded[i].name, saved[i].name );
+        QCOMPARE( loaded[i].enabled, saved[i].enabled );
+        QCOMPARE( loaded[i].mode, saved[i].mode );
+        QVERIFY( loaded[i].geometry == saved[i].geometry );
+    }
+}
+
+void SettingsObjectTest::objectDataBenchmarked()
+{
+    const auto profile = createProfiles( 1 ).front();
+
+    QBENCHMARK
+    {
+        auto o = profile.saveSettings();
+        TestProfile loaded;
+        loaded.loadSettings( o );
+    }
+}
+
+void SettingsObjectTest::saveProfilesBenchmarked_data()
+{
+    addProfileCountRows();
+}
+
+void SettingsObjectTest::saveProfilesBenchmarked()
+{
+    QFETCH( int, profileCount );
+
+    const auto profiles = createProfiles( profileCount );
+
+    QBENCHMARK_ONCE
+    {
+        settings::saveAllObjects( profiles );
+    }
+}
+
+void SettingsObjectTest::loadProfilesBenchmarked_data()
+{
+    addProfileCountRows();
+}
+
+void SettingsObjectTest::loadProfilesBenchmarked()
+{
+    QFETCH( int, profileCount );
+
+    settings::saveAllObjects( createProfiles( profileCount ) );
+
+    std::vector<TestProfile> loaded;
+    QBENCHMARK_ONCE
+    {
+        settings::loadAllObjects( loaded );
+    }
+
+    QCOMPARE( loaded.size(), static_cast<std::size_t>( profileCount ) );
+}
+
+QTEST_APPLESS_MAIN( SettingsObjectTest )
+
+#include "./release/tst_settingsobjecttest.moc"
@@ -0,0 +1,17 @@
+QT += testlib
+QT -= gui
+CONFIG   += c++1z
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += ../../src/settings/internal \
+    ../../third-party/easylogging++
+
+SOURCES +=  tst_settingspersistertest.cpp \
+    ../../third-party/easylogging++/easylogging++.cc
+
+HEADERS += \
+    ../../src/settings/internal/settings_persister.h
@@ -0,0 +1,97 @@
+#include <QtTest>
+#include <QSettings>
+#include <QTemporaryDir>
+#include "settings_persister.h"
+
+INITIALIZE_EASYLOGGINGPP
+
+using settings::SettingsPersister;
+using settings::SettingsSnapshot;
+
+class SettingsPersisterTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void flushWritesAllSnapshots();
+
+    void laterSnapshotsWin();
+
+    void destructorDrainsQueue();
+
+    void emptySnapshotIsIgnored();
+};
+
+namespace
+{
+SettingsSnapshot snapshotWithValue( const int value )
+{
+    return { { "group", "int", value },
+             { "group", "string", QString::number( value ) } };
+}
+
+} // namespace
+
+void SettingsPersisterTest::flushWritesAllSnapshots()
+{
+    QTemporaryDir dir;
+    const auto fileName = dir.filePath( "settings.ini" );
+
+    SettingsPersister persister( fileName );
+    persister.persist( { { "first", "a", true } } );
+    persister.persist( { { "second", "b", 2.5 } } );
+    persister.flush();
+
+    QSettings s( fileName, QSettings::IniFormat );
+    QCOMPARE( s.value( "first/a" ).toBool(), true );
+    QCOMPARE( s.value( "second/b" ).toDouble(), 2.5 );
+}
+
+void SettingsPersisterTest::laterSnapshotsWin()
+{
+    QTemporaryDir dir;
+    const auto fileName = dir.filePath( "settings.ini" );
+
+    SettingsPersister persister( fileName );
+    for ( int i = 0; i < 100; ++i )
+    {
+        persister.persist( snapshotWithValue( i ) );
+    }
+    persister.flush();
+
+    QSettings s( fileName, QSettings::IniFormat );
+    QCOMPARE( s.value( "group/int" ).toInt(), 99 );
+    QCOMPARE( s.value( "group/string" ).toString(), QString( "99" ) );
+}
+
+void SettingsPersisterTest::destructorDrainsQueue()
+{
+    QTemporaryDir dir;
+    const auto fileName = dir.filePath( "settings.ini" );
+
+    {
+        SettingsPersister persister( fileName );
+        persister.persist( snapshotWithValue( 42 ) );
+    }
+
+    QSettings s( fileName, QSettings::IniFormat );
+    QCOMPARE( s.value( "group/int" ).toInt(), 42 );
+}
+
+void SettingsPersisterTest::emptySnapshotIsIgnored()
+{
+    QTemporaryDir dir;
+    const auto fileName = dir.filePath( "settings.ini" );
+
+    {
+        SettingsPersister persister( fileName );
+        persister.persist( {} );
+        persister.flush();
+    }
+
+    QVERIFY( !QFile::exists( fileName ) );
+}
+
+QTEST_APPLESS_MAIN( SettingsPersisterTest )
+
+#include "./release/tst_settingspersistertest.moc"
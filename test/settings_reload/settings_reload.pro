@@ -0,0 +1,24 @@
+QT += testlib
+QT -= gui
+CONFIG   += c++1z
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += ELPP_QT_LOGGING \
+    ELPP_THREAD_SAFE \
+    APPLICATION_VERSION=\\\"test\\\"
+
+INCLUDEPATH += ../../src/settings/internal \
+    ../../third-party/easylogging++
+
+SOURCES +=  tst_settingsreloadtest.cpp \
+    ../../third-party/easylogging++/easylogging++.cc
+
+HEADERS += \
+    ../../src/settings/internal/ini_group_hashes.h \
+    ../../src/settings/internal/settings_controller.h \
+    ../../src/settings/internal/settings_persister.h \
+    ../../src/settings/internal/settings_file_watcher.h
@@ -0,0 +1,274 @@
+#include <QtTest>
+#include <QSettings>
+#include <QLockFile>
+#include <QTemporaryDir>
+#include "ini_group_hashes.h"
+#include "settings_controller.h"
+#include "settings_file_watcher.h"
+
+INITIALIZE_EASYLOGGINGPP
+
+using settings::BoolSetting;
+using settings::DoubleSetting;
+using settings::IniGroupHashes;
+using settings::SettingsController;
+using settings::SettingsFileWatcher;
+
+class SettingsReloadTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void allGroupsChangeOnFirstRead();
+
+    void onlyEditedGroupsChange();
+
+    void removedGroupsChange();
+
+    void whitespaceIsIgnored();
+
+    void watcherReloadsOnceAfterBurst();
+
+    void watcherSurvivesFileReplacement();
+
+    void failedReloadIsRetried();
+
+    void controllerAppliesEditedValues();
+
+    void unsavedSettingsKeepTheirValue();
+
+    void reloadWaitsForOwnWrites();
+
+    void ownWritesAreNotRepublished();
+
+private:
+    QTemporaryDir m_settingsDir;
+};
+
+namespace
+{
+const QByteArray k_ini = "[audioSettings]\n"
+                         "pttEnabled=false\n"
+                         "[videoSettings]\n"
+                         "colorRed=1\n"
+                         "colorGreen=1\n";
+
+void writeValue( const QString& fileName, const int value )
+{
+    QSettings s( fileName, QSettings::IniFormat );
+    s.beginGroup( "group" );
+    s.setValue( "value", value );
+    s.endGroup();
+    s.sync();
+}
+
+// Edits the settings file the way another program would.
+void editSetting( const QString& key, const QVariant& value )
+{
+    QSettings s( settings::getQSettings().fileName(), QSettings::IniFormat );
+    s.beginGroup( "playspaceSettings" );
+    s.setValue( key, value );
+    s.endGroup();
+    s.sync();
+}
+
+} // namespace
+
+void SettingsReloadTest::initTestCase()
+{
+    QVERIFY( m_settingsDir.isValid() );
+    // Has to happen before the first call of getQSettings.
+    QSettings::setPath(
+        QSettings::IniFormat, QSettings::UserScope, m_settingsDir.path() );
+    QVERIFY( settings::getQSettings().fileName().startsWith(
+        m_settingsDir.path() ) );
+}
+
+void SettingsReloadTest::allGroupsChangeOnFirstRead()
+{
+    IniGroupHashes hashes;
+
+    const auto changed = hashes.update( k_ini );
+
+    QCOMPARE( changed,
+              ( std::set<std::string>{ "audioSettings", "videoSettings" } ) );
+    QVERIFY( hashes.update( k_ini ).empty() );
+}
+
+void SettingsReloadTest::onlyEditedGroupsChange()
+{
+    IniGroupHashes hashes;
+    hashes.update( k_ini );
+
+    auto edited = k_ini;
+    edited.replace( "colorGreen=1", "colorGreen=0.5" );
+
+    QCOMPARE( hashes.update( edited ),
+              std::set<std::string>{ "videoSettings" } );
+}
+
+void SettingsReloadTest::removedGroupsChange()
+{
+    IniGroupHashes hashes;
+    hashes.update( k_ini );
+
+    QCOMPARE( hashes.update( "[videoSettings]\n"
+                             "colorRed=1\n"
+                             "colorGreen=1\n" ),
+              std::set<std::string>{ "audioSettings" } );
+}
+
+void SettingsReloadTest::whitespaceIsIgnored()
+{
+    IniGroupHashes hashes;
+    hashes.update( k_ini );
+
+    auto reformatted = k_ini;
+    reformatted.replace( "\n", "\r\n\r\n" );
+
+    QVERIFY( hashes.update( reformatted ).empty() );
+}
+
+void SettingsReloadTest::watcherReloadsOnceAfterBurst()
+{
+    QTemporaryDir dir;
+    const auto fileName = dir.filePath( "settings.ini" );
+    writeValue( fileName, 0 );
+
+    int reloads = 0;
+    SettingsFileWatcher watcher( fileName, [&] {
+        ++reloads;
+        return true;
+    } );
+
+    for ( int i = 1; i <= 5; ++i )
+    {
+        writeValue( fileName, i );
+    }
+
+    QTRY_COMPARE( reloads, 1 );
+    QTest::qWait( SettingsFileWatcher::k_debounceMs * 2 );
+    QCOMPARE( reloads, 1 );
+}
+
+void SettingsReloadTest::watcherSurvivesFileReplacement()
+{
+    QTemporaryDir dir;
+    const auto fileName = dir.filePath( "settings.ini" );
+    writeValue( fileName, 0 );
+
+    int reloads = 0;
+    SettingsFileWatcher watcher( fileName, [&] {
+        ++reloads;
+        return true;
+    } );
+
+    // QSettings renames a temporary file over the original every time.
+    writeValue( fileName, 1 );
+    QTRY_COMPARE( reloads, 1 );
+
+    writeValue( fileName, 2 );
+    QTRY_COMPARE( reloads, 2 );
+}
+
+void SettingsReloadTest::failedReloadIsRetried()
+{
+    QTemporaryDir dir;
+    const auto fileName = dir.filePath( "settings.ini" );
+    writeValue( fileName, 0 );
+
+    int attempts = 0;
+    SettingsFileWatcher watcher( fileName, [&] { return ++attempts >= 3; } );
+
+    writeValue( fileName, 1 );
+
+    QTRY_COMPARE( attempts, 3 );
+    QTest::qWait( SettingsFileWatcher::k_debounceMs * 2 );
+    QCOMPARE( attempts, 3 );
+}
+
+void SettingsReloadTest::controllerAppliesEditedValues()
+{
+    SettingsController c;
+    // The first read only records the state of the file.
+    QVERIFY( c.reloadChangedGroups() );
+
+    const auto setting = DoubleSetting::PLAYSPACE_gravityStrength;
+    const auto edited = c.getSetting<double>( setting ) + 1.0;
+    const auto published = c.publishedChanges();
+
+    editSetting( "gravityStrength", edited );
+    QVERIFY( c.reloadChangedGroups() );
+
+    QCOMPARE( c.getSetting<double>( setting ), edited );
+    QCOMPARE( c.publishedChanges(), published + 1 );
+    // Reloaded values are already in the file.
+    QCOMPARE( c.unsavedChanges(), std::size_t{ 0 } );
+}
+
+void SettingsReloadTest::unsavedSettingsKeepTheirValue()
+{
+    SettingsController c;
+    QVERIFY( c.reloadChangedGroups() );
+
+    const auto unsaved = DoubleSetting::PLAYSPACE_heightToggleOffset;
+    const auto inMemory = c.getSetting<double>( unsaved ) + 0.5;
+    c.setSetting( unsaved, inMemory );
+
+    const auto other = BoolSetting::PLAYSPACE_lockXToggle;
+    const auto edited = !c.getSetting<bool>( other );
+
+    editSetting( "heightToggleOffset", inMemory + 1.0 );
+    editSetting( "lockXToggle", edited );
+    QVERIFY( c.reloadChangedGroups() );
+
+    QCOMPARE( c.getSetting<double>( unsaved ), inMemory );
+    QCOMPARE( c.getSetting<bool>( other ), edited );
+    QCOMPARE( c.unsavedChanges(), std::size_t{ 1 } );
+}
+
+void SettingsReloadTest::reloadWaitsForOwnWrites()
+{
+    SettingsController c;
+    QVERIFY( c.reloadChangedGroups() );
+    const auto writes = c.fileWrites();
+
+    // QSettings takes this lock before writing, holding it keeps the
+    // persister busy.
+    QLockFile lock( settings::getQSettings().fileName() + ".lock" );
+    QVERIFY( lock.lock() );
+
+    const auto setting = DoubleSetting::PLAYSPACE_flingStrength;
+    c.setSetting( setting, c.getSetting<double>( setting ) + 1.0 );
+    c.saveChangedSettings();
+
+    QVERIFY( !c.reloadChangedGroups() );
+
+    lock.unlock();
+    QCOMPARE( c.fileWrites(), writes + 1 );
+    QVERIFY( c.reloadChangedGroups() );
+}
+
+void SettingsReloadTest::ownWritesAreNotRepublished()
+{
+    SettingsController c;
+    QVERIFY( c.reloadChangedGroups() );
+
+    const auto setting = DoubleSetting::PLAYSPACE_gravityStrength;
+    c.setSetting( setting, c.getSetting<double>( setting ) + 1.0 );
+    c.saveChangedSettings();
+    const auto writes = c.fileWrites();
+    QVERIFY( writes > 0 );
+    const auto published = c.publishedChanges();
+
+    // The file changed, but only to what is already in memory.
+    QVERIFY( c.reloadChangedGroups() );
+    QCOMPARE( c.publishedChanges(), published );
+    QCOMPARE( c.unsavedChanges(), std::size_t{ 0 } );
+}
+
+QTEST_GUILESS_MAIN( SettingsReloadTest )
+
+#include "./release/tst_settingsreloadtest.moc"
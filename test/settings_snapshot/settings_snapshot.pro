@@ -0,0 +1,19 @@
+QT += testlib
+QT -= gui
+CONFIG   += c++1z
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += ../../src/settings \
+    ../../third-party/easylogging++
+
+SOURCES +=  tst_settingssnapshottest.cpp \
+    ../../src/settings/settings_snapshot.cpp \
+    ../../third-party/easylogging++/easylogging++.cc
+
+HEADERS += \
+    ../../src/settings/settings_snapshot.h \
+    ../../src/settings/internal/settings_object_data.h
@@ -0,0 +1,139 @@
+#include <QtTest>
+#include "settings_snapshot.h"
+
+INITIALIZE_EASYLOGGINGPP
+
+namespace
+{
+// Roughly the size of a chaperone profile with a detailed boundary.
+constexpr int k_doublesPerProfile = 1024;
+
+settings::SettingsObjectData createProfile( const int i )
+{
+    settings::SettingsObjectData o;
+    o.addValue( i % 2 == 0 );
+    o.addValue( i );
+    for ( int j = 0; j < k_doublesPerProfile; ++j )
+    {
+        o.addValue( static_cast<double>( i ) + j * 0.25 );
+    }
+    o.addValue( "Profile " + std::to_string( i ) );
+    return o;
+}
+
+settings::Snapshot createSnapshot( const int profileCount )
+{
+    settings::Snapshot snapshot;
+    snapshot.settings = { { "audioSettings", "pttEnabled", true },
+                          { "videoSettings", "brightnessOpacity", 0.5 },
+                          { "utilitiesSettings", "alarmHour", 7 },
+                          { "applicationSettings", "name", "station 1" } };
+    snapshot.runtimeSettings = { { "steamvr", "enableHomeApp", false },
+                                 { "steamvr", "supersampleScale", 1.5f } };
+
+    settings::SnapshotProfiles profiles{ "testProfiles", {} };
+    for ( int i = 0; i < profileCount; ++i )
+    {
+        profiles.profiles.push_back( createProfile( i ) );
+    }
+    snapshot.profiles.push_back( std::move( profiles ) );
+    return snapshot;
+}
+
+} // namespace
+
+class SettingsSnapshotTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void snapshotRoundTrips();
+
+    void corruptSnapshotIsRejected();
+
+    void unknownVersionIsRejected();
+
+    void truncatedSnapshotIsRejected();
+
+    void encodeBenchmarked();
+
+    void decodeBenchmarked();
+};
+
+void SettingsSnapshotTest::snapshotRoundTrips()
+{
+    const auto saved = createSnapshot( 3 );
+
+    const auto loaded = settings::decodeSnapshot(
+        settings::encodeSnapshot( saved ) );
+
+    QVERIFY( loaded.has_value() );
+    QCOMPARE( loaded->settings.size(), saved.settings.size() );
+    for ( std::size_t i = 0; i < saved.settings.size(); ++i )
+    {
+        QCOMPARE( loaded->settings[i].group, saved.settings[i].group );
+        QCOMPARE( loaded->settings[i].key, saved.settings[i].key );
+        QCOMPARE( loaded->settings[i].value, saved.settings[i].value );
+    }
+    QCOMPARE( loaded->runtimeSettings.size(), std::size_t{ 2 } );
+    QCOMPARE( loaded->runtimeSettings[1].value.toFloat(), 1.5f );
+
+    QCOMPARE( loaded->profiles.size(), std::size_t{ 1 } );
+    QCOMPARE( loaded->profiles[0].settingsName,
+              std::string( "testProfiles" ) );
+    QVERIFY( loaded->profiles[0].profiles == saved.profiles[0].profiles );
+}
+
+void SettingsSnapshotTest::corruptSnapshotIsRejected()
+{
+    auto data = settings::encodeSnapshot( createSnapshot( 1 ) );
+    data[data.size() / 2] = static_cast<char>( data[data.size() / 2] ^ 0x20 );
+
+    QVERIFY( !settings::decodeSnapshot( data ) );
+}
+
+void SettingsSnapshotTest::unknownVersionIsRejected()
+{
+    auto data = settings::encodeSnapshot( createSnapshot( 1 ) );
+    data[4] = static_cast<char>( settings::k_snapshotVersion + 1 );
+
+    QVERIFY( !settings::decodeSnapshot( data ) );
+}
+
+void SettingsSnapshotTest::truncatedSnapshotIsRejected()
+{
+    const auto data = settings::encodeSnapshot( createSnapshot( 1 ) );
+
+    QVERIFY( !settings::decodeSnapshot( data.left( data.size() - 10 ) ) );
+    QVERIFY( !settings::decodeSnapshot( data.left( 3 ) ) );
+}
+
+void SettingsSnapshotTest::encodeBenchmarked()
+{
+    const auto snapshot = createSnapshot( 100 );
+
+    QByteArray data;
+    QBENCHMARK
+    {
+        data = settings::encodeSnapshot( snapshot );
+    }
+
+    QVERIFY( !data.isEmpty() );
+}
+
+void SettingsSnapshotTest::decodeBenchmarked()
+{
+    const auto data = settings::encodeSnapshot( createSnapshot( 100 ) );
+
+    std::optional<settings::Snapshot> snapshot;
+    QBENCHMARK
+    {
+        snapshot = settings::decodeSnapshot( data );
+    }
+
+    QVERIFY( snapshot.has_value() );
+}
+
+QTEST_APPLESS_MAIN( SettingsSnapshotTest )
+
+#include "./release/tst_settingssnapshottest.moc"
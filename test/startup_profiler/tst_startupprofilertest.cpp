@@ -0,0 +1,80 @@
+#include <QtTest>
+#include <chrono>
+#include "StartupProfiler.h"
+
+using utils::StartupProfiler;
+using namespace std::chrono_literals;
+
+class StartupProfilerTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void phasesMeasureTimeSincePreviousMark();
+    void marksAfterFinishAreIgnored();
+    void reportListsPhasesAndTotal();
+    void deferredReportAddsToTotal();
+};
+
+void StartupProfilerTest::phasesMeasureTimeSincePreviousMark()
+{
+    const auto start = StartupProfiler::Clock::time_point{};
+    StartupProfiler profiler( start );
+
+    profiler.mark( "settings", start + 10ms );
+    profiler.mark( "QML", start + 35ms );
+
+    const auto& phases = profiler.phases();
+    QCOMPARE( phases.size(), std::size_t{ 2 } );
+    QCOMPARE( phases[0].name, std::string( "settings" ) );
+    QVERIFY( phases[0].duration == 10ms );
+    QCOMPARE( phases[1].name, std::string( "QML" ) );
+    QVERIFY( phases[1].duration == 25ms );
+    QVERIFY( profiler.total() == 35ms );
+    QVERIFY( !profiler.finished() );
+}
+
+void StartupProfilerTest::marksAfterFinishAreIgnored()
+{
+    const auto start = StartupProfiler::Clock::time_point{};
+    StartupProfiler profiler( start );
+
+    profiler.finish( "first tick", start + 5ms );
+    profiler.mark( "late", start + 50ms );
+
+    QVERIFY( profiler.finished() );
+    QCOMPARE( profiler.phases().size(), std::size_t{ 1 } );
+    QVERIFY( profiler.total() == 5ms );
+}
+
+void StartupProfilerTest::reportListsPhasesAndTotal()
+{
+    const auto start = StartupProfiler::Clock::time_point{};
+    StartupProfiler profiler( start );
+
+    profiler.mark( "OpenVR", start + 1500us );
+    profiler.finish( "first tick", start + 4ms );
+
+    QCOMPARE( profiler.report(),
+              std::string(
+                  "OpenVR: 1.5 ms, first tick: 2.5 ms, total: 4.0 ms" ) );
+}
+
+void StartupProfilerTest::deferredReportAddsToTotal()
+{
+    const auto start = StartupProfiler::Clock::time_point{};
+    StartupProfiler profiler( start );
+
+    profiler.finish( "first tick", start + 4ms );
+    profiler.deferred( "audio devices", 20ms );
+    profiler.deferred( "media keys", 1500us );
+
+    QCOMPARE( profiler.deferredReport(),
+              std::string( "audio devices: 20.0 ms, media keys: 1.5 ms, "
+                           "deferred: 21.5 ms, first tick without "
+                           "deferring: 25.5 ms" ) );
+}
+
+QTEST_APPLESS_MAIN( StartupProfilerTest )
+
+#include "./release/tst_startupprofilertest.moc"
@@ -0,0 +1,16 @@
+QT += testlib
+QT -= gui
+CONFIG   += c++1z
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += ../../src/utils
+
+SOURCES +=  tst_taskschedulertest.cpp \
+    ../../src/utils/TaskScheduler.cpp
+
+HEADERS += \
+    ../../src/utils/TaskScheduler.h
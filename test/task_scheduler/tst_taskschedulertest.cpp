@@ -0,0 +1,276 @@
+#include <QtTest>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include "TaskScheduler.h"
+
+using utils::TaskScheduler;
+using namespace std::chrono_literals;
+using Clock = TaskScheduler::Clock;
+
+namespace
+{
+struct Run
+{
+    int task;
+    Clock::time_point due;
+    Clock::time_point time;
+};
+
+// Records which task ran when, from any worker.
+class RunLog
+{
+public:
+    TaskScheduler::Task task( int number, Clock::time_point due )
+    {
+        return [this, number, due] {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_runs.push_back( { number, due, Clock::now() } );
+        };
+    }
+
+    std::vector<Run> runs()
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        return m_runs;
+    }
+
+    int count()
+    {
+        return static_cast<int>( runs().size() );
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<Run> m_runs;
+};
+
+} // namespace
+
+class TaskSchedulerTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void timersRunInDueOrder();
+
+    void timersAreNeverEarly();
+
+    void timersOfHigherLevelsCascade();
+
+    void cancelledTimersDontRun();
+
+    void periodicTimersRepeat();
+
+    void slowPeriodicRunsDontOverlap();
+
+    void blockingTasksDontDelayTimers();
+
+    void blockingCallsDontTakeWorkers();
+
+    void stopDiscardsPendingTimers();
+};
+
+void TaskSchedulerTest::timersRunInDueOrder()
+{
+    RunLog log;
+    TaskScheduler scheduler;
+    const auto now = Clock::now();
+    for ( int i = 4; i >= 0; --i )
+    {
+        const auto due = now + 30ms * ( i + 1 );
+        scheduler.scheduleAt( due, log.task( i, due ) );
+    }
+    QCOMPARE( scheduler.pendingTimers(), std::size_t{ 5 } );
+
+    QTRY_COMPARE( log.count(), 5 );
+
+    const auto runs = log.runs();
+    for ( int i = 0; i < 5; ++i )
+    {
+        QCOMPARE( runs[static_cast<std::size_t>( i )].task, i );
+    }
+    QCOMPARE( scheduler.pendingTimers(), std::size_t{ 0 } );
+    QTRY_COMPARE( scheduler.completedTasks(), 5ull );
+}
+
+void TaskSchedulerTest::timersAreNeverEarly()
+{
+    constexpr int timers = 1000;
+    RunLog log;
+    TaskScheduler scheduler;
+    std::mt19937 random( 42 );
+    std::uniform_int_distribution<int> delayMs( 0, 300 );
+    for ( int i = 0; i < timers; ++i )
+    {
+        const auto due = Clock::now() + std::chrono::milliseconds(
+                                            delayMs( random ) );
+        scheduler.scheduleAt( due, log.task( i, due ) );
+    }
+
+    QTRY_COMPARE( log.count(), timers );
+
+    Clock::duration latest{};
+    for ( const auto& run : log.runs() )
+    {
+        QVERIFY( run.time >= run.due );
+        latest = std::max( latest, run.time - run.due );
+    }
+    qInfo() << "Latest timer, ms:"
+            << std::chrono::duration<double, std::milli>( latest ).count();
+}
+
+void TaskSchedulerTest::timersOfHigherLevelsCascade()
+{
+    // Beyond one turn of level 0, the timer starts out on level 1.
+    const auto delay = TaskScheduler::k_tick * TaskScheduler::k_slots + 75ms;
+    RunLog log;
+    TaskScheduler scheduler;
+    const auto due = Clock::now() + delay;
+    scheduler.scheduleAt( due, log.task( 0, due ) );
+    // Far beyond every level, only cancelled.
+    const auto far = scheduler.scheduleAfter( 24h * 365 * 10, [] {} );
+
+    QTRY_COMPARE_WITH_TIMEOUT( log.count(), 1, 2000 );
+
+    const auto late = log.runs().front().time - due;
+    QVERIFY( late >= 0ms );
+    QVERIFY( late < 100ms );
+    QCOMPARE( scheduler.pendingTimers(), std::size_t{ 1 } );
+    QVERIFY( scheduler.cancel( far ) );
+    QCOMPARE( scheduler.pendingTimers(), std::size_t{ 0 } );
+}
+
+void TaskSchedulerTest::cancelledTimersDontRun()
+{
+    RunLog log;
+    TaskScheduler scheduler;
+    const auto due = Clock::now() + 50ms;
+    const auto cancelled = scheduler.scheduleAt( due, log.task( 0, due ) );
+    scheduler.scheduleAt( due, log.task( 1, due ) );
+
+    QVERIFY( scheduler.cancel( cancelled ) );
+    QVERIFY( !scheduler.cancel( cancelled ) );
+    QVERIFY( !scheduler.cancel( 0 ) );
+
+    QTRY_COMPARE( log.count(), 1 );
+    QTest::qWait( 100 );
+    QCOMPARE( log.count(), 1 );
+    QCOMPARE( log.runs().front().task, 1 );
+}
+
+void TaskSchedulerTest::periodicTimersRepeat()
+{
+    constexpr auto period = 20ms;
+    RunLog log;
+    TaskScheduler scheduler;
+    const auto start = Clock::now();
+    const auto id = scheduler.scheduleEvery( period, log.task( 0, start ) );
+
+    QTRY_VERIFY( log.count() >= 5 );
+    QVERIFY( scheduler.cancel( id ) );
+    const auto count = log.count();
+    QTest::qWait( 100 );
+    QVERIFY( log.count() <= count + 1 );
+
+    // Runs are due at multiples of the period from the start.
+    const auto runs = log.runs();
+    for ( std::size_t i = 0; i < runs.size(); ++i )
+    {
+        QVERIFY( runs[i].time - start
+                 >= period * static_cast<int>( i + 1 ) );
+    }
+}
+
+void TaskSchedulerTest::slowPeriodicRunsDontOverlap()
+{
+    std::atomic<int> running{ 0 };
+    std::atomic<int> mostRunning{ 0 };
+    std::atomic<int> runs{ 0 };
+    TaskScheduler scheduler( 4 );
+    scheduler.scheduleEvery( TaskScheduler::k_tick, [&] {
+        const auto now = ++running;
+        mostRunning = std::max( mostRunning.load(), now );
+        std::this_thread::sleep_for( 50ms );
+        --running;
+        ++runs;
+    } );
+
+    QTRY_VERIFY( runs >= 3 );
+    scheduler.stop();
+    QCOMPARE( mostRunning.load(), 1 );
+}
+
+void TaskSchedulerTest::blockingTasksDontDelayTimers()
+{
+    std::atomic<bool> release{ false };
+    RunLog log;
+    TaskScheduler scheduler;
+    // Like a modal message waiting for the user.
+    scheduler.post( [&release] {
+        while ( !release )
+        {
+            std::this_thread::sleep_for( 1ms );
+        }
+    } );
+    const auto due = Clock::now() + 30ms;
+    scheduler.scheduleAt( due, log.task( 0, due ) );
+
+    QTRY_COMPARE_WITH_TIMEOUT( log.count(), 1, 500 );
+    QCOMPARE( scheduler.completedTasks(), 1ull );
+    release = true;
+    QTRY_COMPARE( scheduler.completedTasks(), 2ull );
+}
+
+void TaskSchedulerTest::blockingCallsDontTakeWorkers()
+{
+    std::atomic<bool> release{ false };
+    std::atomic<int> returned{ 0 };
+    RunLog log;
+    TaskScheduler scheduler;
+    // Two modal messages, as many as there are workers.
+    for ( std::size_t i = 0; i < TaskScheduler::k_defaultWorkers; ++i )
+    {
+        scheduler.postBlocking( [&release, &returned] {
+            while ( !release )
+            {
+                std::this_thread::sleep_for( 1ms );
+            }
+            ++returned;
+        } );
+    }
+    const auto due = Clock::now() + 30ms;
+    scheduler.scheduleAt( due, log.task( 0, due ) );
+    scheduler.post( log.task( 1, due ) );
+
+    QTRY_COMPARE_WITH_TIMEOUT( log.count(), 2, 500 );
+    QCOMPARE( returned.load(), 0 );
+    release = true;
+    scheduler.stop();
+    QCOMPARE( returned.load(), 2 );
+}
+
+void TaskSchedulerTest::stopDiscardsPendingTimers()
+{
+    RunLog log;
+    TaskScheduler scheduler;
+    const auto due = Clock::now() + 50ms;
+    scheduler.scheduleAt( due, log.task( 0, due ) );
+    scheduler.scheduleEvery( 10ms, log.task( 1, due ) );
+
+    scheduler.stop();
+
+    QCOMPARE( scheduler.pendingTimers(), std::size_t{ 0 } );
+    QCOMPARE( scheduler.scheduleAfter( 10ms, [] {} ),
+              TaskScheduler::TaskId{ 0 } );
+    QTest::qWait( 100 );
+    QCOMPARE( log.count(), 0 );
+}
+
+QTEST_GUILESS_MAIN( TaskSchedulerTest )
+
+#include "./release/tst_taskschedulertest.moc"
@@ -0,0 +1,293 @@
+#include <QtTest>
+#include <QDir>
+#include <QElapsedTimer>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include "input_session_uinput.h"
+#include "evdev_keycodes.h"
+// Last, its KEY_* macros have the same names as some Token values.
+#include <linux/input.h>
+
+INITIALIZE_EASYLOGGINGPP
+
+using namespace std::chrono_literals;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+struct KeyChange
+{
+    unsigned short code;
+    int value;
+
+    bool operator==( const KeyChange& other ) const noexcept
+    {
+        return code == other.code && value == other.value;
+    }
+};
+
+struct ReadBack
+{
+    std::vector<KeyChange> keys;
+    int reports = 0;
+    bool dropped = false;
+};
+
+// udev creates the device node shortly after the device.
+int openDeviceNode( const char* const name )
+{
+    const auto deadline = Clock::now() + 2s;
+    do
+    {
+        for ( const auto& entry :
+              QDir( "/dev/input" ).entryList( { "event*" }, QDir::System ) )
+        {
+            const auto path = QString( "/dev/input/" ) + entry;
+            const auto fd = open( path.toLocal8Bit().constData(),
+                                  O_RDONLY | O_NONBLOCK | O_CLOEXEC );
+            if ( fd < 0 )
+            {
+                continue;
+            }
+            char deviceName[256] = {};
+            const auto length = sizeof( deviceName ) - 1;
+            if ( ioctl( fd, EVIOCGNAME( length ), deviceName ) >= 0
+                 && std::strcmp( deviceName, name ) == 0 )
+            {
+                return fd;
+            }
+            close( fd );
+        }
+        std::this_thread::sleep_for( 10ms );
+    } while ( Clock::now() < deadline );
+    return -1;
+}
+
+// Reads until \a count key changes and the report after them arrived.
+ReadBack readKeys( const int fd, const std::size_t count )
+{
+    ReadBack result;
+    const auto deadline = Clock::now() + 1s;
+    while ( Clock::now() < deadline )
+    {
+        pollfd p{ fd, POLLIN, 0 };
+        if ( poll( &p, 1, 10 ) <= 0 )
+        {
+            continue;
+        }
+        input_event events[64];
+        const auto bytes = read( fd, events, sizeof( events ) );
+        if ( bytes <= 0 )
+        {
+            continue;
+        }
+        const auto received
+            = static_cast<std::size_t>( bytes ) / sizeof( input_event );
+        for ( std::size_t i = 0; i < received; ++i )
+        {
+            const auto& e = events[i];
+            if ( e.type == EV_KEY )
+            {
+                result.keys.push_back( { e.code, e.value } );
+            }
+            else if ( e.type == EV_SYN && e.code == SYN_REPORT )
+            {
+                ++result.reports;
+                if ( result.keys.size() >= count )
+                {
+                    return result;
+                }
+            }
+            else if ( e.type == EV_SYN && e.code == SYN_DROPPED )
+            {
+                result.dropped = true;
+            }
+        }
+    }
+    return result;
+}
+
+void drain( const int fd )
+{
+    input_event events[64];
+    while ( read( fd, events, sizeof( events ) ) > 0 )
+    {
+    }
+}
+
+} // namespace
+
+class UinputSessionTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void init();
+    void cleanupTestCase();
+
+    void keycodesMatchKernel();
+    void eventsAreReadBack();
+    void onlyRepeatedKeysSplitReports();
+    void latency();
+    void eventsPerSecond();
+
+private:
+    std::unique_ptr<UinputInputSession> m_session;
+    int m_reader = -1;
+};
+
+void UinputSessionTest::initTestCase()
+{
+    if ( access( "/dev/uinput", W_OK ) != 0 )
+    {
+        return;
+    }
+    m_session = std::make_unique<UinputInputSession>();
+    QVERIFY( m_session->isOpen() );
+    m_reader = openDeviceNode( UinputInputSession::k_deviceName );
+}
+
+void UinputSessionTest::init()
+{
+    if ( m_reader >= 0 )
+    {
+        drain( m_reader );
+    }
+}
+
+void UinputSessionTest::cleanupTestCase()
+{
+    if ( m_reader >= 0 )
+    {
+        close( m_reader );
+    }
+    m_session.reset();
+}
+
+void UinputSessionTest::keycodesMatchKernel()
+{
+    // Only keys whose kernel names don't clash with Token values.
+    QVERIFY( evdev::keycode( Token::KEY_a ) == KEY_A );
+    QVERIFY( evdev::keycode( Token::KEY_z ) == KEY_Z );
+    QVERIFY( evdev::keycode( Token::KEY_EQUALS ) == KEY_EQUAL );
+    QVERIFY( evdev::keycode( Token::KEY_PERIOD ) == KEY_DOT );
+    QVERIFY( evdev::keycode( Token::KEY_PGDN ) == KEY_PAGEDOWN );
+    QVERIFY( evdev::keycode( Token::KEY_PRNSCRN ) == KEY_SYSRQ );
+    QVERIFY( evdev::keycode( Token::KEY_KPSTAR ) == KEY_KPASTERISK );
+    QVERIFY( evdev::keycode( Token::MODIFIER_CTRL ) == KEY_LEFTCTRL );
+    QVERIFY( evdev::keycode( Token::MODIFIER_SUPER ) == KEY_LEFTMETA );
+    QVERIFY( evdev::keycode( Token::MODIFIER_TILDE ) == KEY_GRAVE );
+    QVERIFY( evdev::keycode( Token::TOKEN_NEW_SEQUENCE ) == 0 );
+}
+
+void UinputSessionTest::eventsAreReadBack()
+{
+    if ( m_reader < 0 )
+    {
+        QSKIP( "Needs write access to /dev/uinput and its event device." );
+    }
+
+    m_session->send( toKeyEvents( { Token::MODIFIER_CTRL, Token::KEY_c } ) );
+
+    const auto read = readKeys( m_reader, 4 );
+    const std::vector<KeyChange> expected{ { KEY_LEFTCTRL, 1 },
+                                           { KEY_C, 1 },
+                                           { KEY_C, 0 },
+                                           { KEY_LEFTCTRL, 0 } };
+    QVERIFY( read.keys == expected );
+    // c changes twice, so it needs a second report.
+    QCOMPARE( read.reports, 2 );
+}
+
+void UinputSessionTest::onlyRepeatedKeysSplitReports()
+{
+    if ( m_reader < 0 )
+    {
+        QSKIP( "Needs write access to /dev/uinput and its event device." );
+    }
+
+    const auto reportsBefore = m_session->sentReports();
+    m_session->send( { { Token::MODIFIER_CTRL, KeyStatus::Down },
+                       { Token::MODIFIER_SHIFT, KeyStatus::Down },
+                       { Token::KEY_a, KeyStatus::Down } } );
+    m_session->send( { { Token::KEY_a, KeyStatus::Up },
+                       { Token::MODIFIER_SHIFT, KeyStatus::Up },
+                       { Token::MODIFIER_CTRL, KeyStatus::Up } } );
+
+    QCOMPARE( m_session->sentReports() - reportsBefore, 2ull );
+    const auto read = readKeys( m_reader, 6 );
+    QCOMPARE( read.keys.size(), std::size_t{ 6 } );
+    QCOMPARE( read.reports, 2 );
+}
+
+void UinputSessionTest::latency()
+{
+    if ( m_reader < 0 )
+    {
+        QSKIP( "Needs write access to /dev/uinput and its event device." );
+    }
+
+    constexpr int k_samples = 200;
+    std::vector<std::chrono::duration<double, std::micro>> latencies;
+    for ( int i = 0; i < k_samples; ++i )
+    {
+        for ( const auto status : { KeyStatus::Down, KeyStatus::Up } )
+        {
+            const auto start = Clock::now();
+            m_session->send( { { Token::KEY_a, status } } );
+            const auto read = readKeys( m_reader, 1 );
+            latencies.push_back( Clock::now() - start );
+            QCOMPARE( read.keys.size(), std::size_t{ 1 } );
+        }
+    }
+
+    std::sort( latencies.begin(), latencies.end() );
+    const auto median = latencies[latencies.size() / 2];
+    qInfo() << "Send to read back latency, median:" << median.count()
+            << "us, max:" << latencies.back().count() << "us";
+    QVERIFY( median < 5ms );
+}
+
+void UinputSessionTest::eventsPerSecond()
+{
+    if ( m_reader < 0 )
+    {
+        QSKIP( "Needs write access to /dev/uinput and its event device." );
+    }
+
+    // Small enough for evdev's client buffer, the batch is read back before
+    // the next one is sent.
+    constexpr int k_sends = 500;
+    const auto batch = toKeyEvents( std::vector<Token>( 8, Token::KEY_a ) );
+    const auto sentBefore = m_session->sentEvents();
+
+    QElapsedTimer timer;
+    timer.start();
+    std::size_t readBack = 0;
+    for ( int i = 0; i < k_sends; ++i )
+    {
+        m_session->send( batch );
+        const auto read = readKeys( m_reader, batch.size() );
+        QVERIFY( !read.dropped );
+        readBack += read.keys.size();
+    }
+    const auto seconds = static_cast<double>( timer.nsecsElapsed() ) / 1e9;
+    const auto events = m_session->sentEvents() - sentBefore;
+
+    QCOMPARE( events, static_cast<unsigned long long>( k_sends * 16 ) );
+    QCOMPARE( readBack, static_cast<std::size_t>( events ) );
+    qInfo() << "Key events per second, read back:"
+            << static_cast<double>( events ) / seconds;
+}
+
+QTEST_APPLESS_MAIN( UinputSessionTest )
+
+#include "./release/tst_uinputsessiontest.moc"
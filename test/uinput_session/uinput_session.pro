@@ -0,0 +1,26 @@
+QT += testlib
+QT -= gui
+CONFIG   += c++1z
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+# Needs write access to /dev/uinput and read access to the created
+# /dev/input/event* device, for example as root.
+
+INCLUDEPATH += ../../src/keyboard_input \
+    ../../third-party/easylogging++
+
+SOURCES +=  tst_uinputsessiontest.cpp \
+    ../../src/keyboard_input/input_session_uinput.cpp \
+    ../../src/keyboard_input/input_sender.cpp \
+    ../../src/keyboard_input/input_parser.cpp \
+    ../../third-party/easylogging++/easylogging++.cc
+
+HEADERS += \
+    ../../src/keyboard_input/input_session_uinput.h \
+    ../../src/keyboard_input/evdev_keycodes.h \
+    ../../src/keyboard_input/input_sender.h \
+    ../../src/keyboard_input/input_parser.h
@@ -0,0 +1,293 @@
+#include <QtTest>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "VRSettingsCache.h"
+
+using utils::VRSettingsCache;
+using utils::VRSettingType;
+using utils::VRSettingValue;
+
+namespace
+{
+constexpr auto k_section = "steamvr";
+
+// Stands in for vr::VRSettings().
+class FakeBackend : public utils::VRSettingsBackend
+{
+public:
+    std::optional<VRSettingValue> read( const std::string& section,
+                                        const std::string& key,
+                                        VRSettingType ) override
+    {
+        ++reads;
+        const auto it = values.find( { section, key } );
+        if ( it == values.end() )
+        {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    bool write( const std::string& section,
+                const std::string& key,
+                const VRSettingValue& value ) override
+    {
+        ++writes;
+        values[{ section, key }] = value;
+        return true;
+    }
+
+    std::map<std::pair<std::string, std::string>, VRSettingValue> values;
+    int reads = 0;
+    int writes = 0;
+};
+
+struct CacheWithBackend
+{
+    CacheWithBackend()
+    {
+        auto fake = std::make_unique<FakeBackend>();
+        backend = fake.get();
+        cache = std::make_unique<VRSettingsCache>( std::move( fake ) );
+    }
+
+    void tick( const unsigned count )
+    {
+        for ( unsigned i = 0; i < count; ++i )
+        {
+            cache->tick();
+        }
+    }
+
+    FakeBackend* backend;
+    std::unique_ptr<VRSettingsCache> cache;
+};
+
+} // namespace
+
+class VRSettingsCacheTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void watchReportsCurrentValue();
+
+    void sharedKeysAreReadOnce();
+
+    void pollsOnlyReportChanges();
+
+    void pollIntervalBacksOff();
+
+    void writesAreCoalesced();
+
+    void unchangedWritesAreSkipped();
+
+    void pollKeepsQueuedWrites();
+
+    void subscriberEchoesAreNotCounted();
+
+    void readErrorsAreReported();
+
+    void unwatchedKeysAreNotPolled();
+};
+
+void VRSettingsCacheTest::watchReportsCurrentValue()
+{
+    CacheWithBackend c;
+    c.backend->values[{ k_section, "bool" }] = true;
+    c.backend->values[{ k_section, "string" }] = std::string( "device" );
+
+    bool boolValue = false;
+    std::string stringValue;
+    c.cache->watchBool(
+        k_section, "bool", [&]( bool value ) { boolValue = value; } );
+    c.cache->watchString( k_section,
+                          "string",
+                          [&]( const std::string& value ) {
+                              stringValue = value;
+                          } );
+
+    QVERIFY( boolValue );
+    QCOMPARE( stringValue, std::string( "device" ) );
+}
+
+void VRSettingsCacheTest::sharedKeysAreReadOnce()
+{
+    CacheWithBackend c;
+    c.backend->values[{ k_section, "int" }] = 3;
+
+    int first = 0;
+    int second = 0;
+    c.cache->watchInt32(
+        k_section, "int", [&]( int value ) { first = value; } );
+    c.cache->watchInt32(
+        k_section, "int", [&]( int value ) { second = value; } );
+
+    QCOMPARE( first, 3 );
+    QCOMPARE( second, 3 );
+    QCOMPARE( c.backend->reads, 1 );
+}
+
+void VRSettingsCacheTest::pollsOnlyReportChanges()
+{
+    CacheWithBackend c;
+    c.cache->setPollIntervals( 1, 1 );
+    c.backend->values[{ k_section, "float" }] = 1.0f;
+
+    int calls = 0;
+    c.cache->watchFloat( k_section, "float", [&]( float ) { ++calls; } );
+    QCOMPARE( calls, 1 );
+
+    c.tick( 10 );
+    QCOMPARE( calls, 1 );
+
+    c.backend->values[{ k_section, "float" }] = 1.5f;
+    c.tick( 1 );
+    QCOMPARE( calls, 2 );
+}
+
+void VRSettingsCacheTest::pollIntervalBacksOff()
+{
+    CacheWithBackend c;
+    c.cache->setPollIntervals( 2, 8 );
+    c.backend->values[{ k_section, "bool" }] = false;
+    c.cache->watchBool( k_section, "bool", []( bool ) {} );
+
+    c.tick( 2 );
+    QCOMPARE( c.cache->pollIntervalTicks(), 4u );
+    c.tick( 4 );
+    QCOMPARE( c.cache->pollIntervalTicks(), 8u );
+    c.tick( 8 );
+    QCOMPARE( c.cache->pollIntervalTicks(), 8u );
+
+    c.backend->values[{ k_section, "bool" }] = true;
+    c.tick( 8 );
+    QCOMPARE( c.cache->pollIntervalTicks(), 2u );
+
+    c.cache->requestPoll();
+    const auto readsBefore = c.backend->reads;
+    c.tick( 1 );
+    QCOMPARE( c.backend->reads, readsBefore + 1 );
+}
+
+void VRSettingsCacheTest::writesAreCoalesced()
+{
+    CacheWithBackend c;
+    c.backend->values[{ k_section, "float" }] = 1.0f;
+
+    std::vector<float> seen;
+    c.cache->watchFloat(
+        k_section, "float", [&]( float value ) { seen.push_back( value ); } );
+
+    c.cache->set( k_section, "float", 1.1f );
+    c.cache->set( k_section, "float", 1.2f );
+    c.cache->set( k_section, "float", 1.3f );
+    QCOMPARE( c.backend->writes, 0 );
+    QCOMPARE( seen.size(), size_t{ 4 } );
+
+    c.cache->tick();
+    QCOMPARE( c.backend->writes, 1 );
+    QVERIFY( std::get<float>( c.backend->values[{ k_section, "float" }] )
+             == 1.3f );
+    QCOMPARE( c.cache->coalescedWrites(), 2ull );
+}
+
+void VRSettingsCacheTest::unchangedWritesAreSkipped()
+{
+    CacheWithBackend c;
+    c.backend->values[{ k_section, "bool" }] = true;
+    c.cache->watchBool( k_section, "bool", []( bool ) {} );
+
+    c.cache->set( k_section, "bool", true );
+    c.cache->flushWrites();
+
+    QCOMPARE( c.backend->writes, 0 );
+    QCOMPARE( c.cache->runtimeWrites(), 0ull );
+}
+
+void VRSettingsCacheTest::pollKeepsQueuedWrites()
+{
+    CacheWithBackend c;
+    c.backend->values[{ k_section, "float" }] = 1.0f;
+    std::vector<float> seen;
+    c.cache->watchFloat(
+        k_section, "float", [&]( float value ) { seen.push_back( value ); } );
+
+    c.cache->set( k_section, "float", 2.0f );
+    // Like applying a profile, polled between ticks.
+    c.cache->poll();
+
+    QCOMPARE( c.backend->writes, 1 );
+    QVERIFY( std::get<float>( c.backend->values[{ k_section, "float" }] )
+             == 2.0f );
+    QCOMPARE( seen, ( std::vector<float>{ 1.0f, 2.0f } ) );
+    QVERIFY( std::get<float>( c.cache->watchedValues().front().value )
+             == 2.0f );
+}
+
+void VRSettingsCacheTest::subscriberEchoesAreNotCounted()
+{
+    CacheWithBackend c;
+    c.cache->setPollIntervals( 1, 1 );
+    c.backend->values[{ k_section, "float" }] = 1.0f;
+    // Like a tab controller setter called from its own watch.
+    c.cache->watchFloat( k_section, "float", [&]( float value ) {
+        c.cache->set( k_section, "float", value );
+    } );
+
+    c.backend->values[{ k_section, "float" }] = 1.5f;
+    c.tick( 2 );
+
+    QCOMPARE( c.backend->writes, 0 );
+    QCOMPARE( c.cache->runtimeWrites(), 0ull );
+    QCOMPARE( c.cache->coalescedWrites(), 0ull );
+}
+
+void VRSettingsCacheTest::readErrorsAreReported()
+{
+    CacheWithBackend c;
+    c.cache->setPollIntervals( 1, 1 );
+
+    int values = 0;
+    int errors = 0;
+    c.cache->watchFloat(
+        k_section,
+        "missing",
+        [&]( float ) { ++values; },
+        [&] { ++errors; } );
+    QCOMPARE( values, 0 );
+    QCOMPARE( errors, 1 );
+
+    c.tick( 1 );
+    QCOMPARE( errors, 2 );
+
+    c.backend->values[{ k_section, "missing" }] = 2.0f;
+    c.tick( 1 );
+    QCOMPARE( values, 1 );
+    QCOMPARE( errors, 2 );
+}
+
+void VRSettingsCacheTest::unwatchedKeysAreNotPolled()
+{
+    CacheWithBackend c;
+    c.cache->setPollIntervals( 1, 1 );
+    c.backend->values[{ k_section, "int" }] = 1;
+
+    int calls = 0;
+    const auto id
+        = c.cache->watchInt32( k_section, "int", [&]( int ) { ++calls; } );
+    c.cache->unwatch( id );
+
+    const auto readsBefore = c.backend->reads;
+    c.backend->values[{ k_section, "int" }] = 2;
+    c.tick( 5 );
+
+    QCOMPARE( calls, 1 );
+    QCOMPARE( c.backend->reads, readsBefore );
+}
+
+QTEST_APPLESS_MAIN( VRSettingsCacheTest )
+
+#include "./release/tst_vrsettingscachetest.moc"
@@ -0,0 +1,188 @@
+#include <QtTest>
+#include <QDir>
+#include <QElapsedTimer>
+#include <chrono>
+#include <thread>
+#include "input_session_X11.h"
+#include "keyboard_macro.h"
+#include <X11/keysym.h>
+
+INITIALIZE_EASYLOGGINGPP
+
+namespace
+{
+int openFileDescriptors()
+{
+    return static_cast<int>(
+        QDir( "/proc/self/fd" ).entryList( QDir::NoDotAndDotDot ).size() );
+}
+
+std::vector<KeyEvent> backspaces( const std::size_t count )
+{
+    return toKeyEvents( std::vector<Token>( count, Token::KEY_BACKSPACE ) );
+}
+
+} // namespace
+
+class X11InputSessionTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void keycodesAreResolved();
+    void modifiersAreReleased();
+    void noFileDescriptorGrowth();
+    void keycodesFollowMappingChanges();
+    void eventsPerSecond();
+    void symbolsAreResolved();
+    void macroBatchEventsPerSecond();
+};
+
+void X11InputSessionTest::initTestCase()
+{
+    if ( qEnvironmentVariableIsEmpty( "DISPLAY" ) )
+    {
+        QSKIP( "Needs an X server, run with xvfb-run." );
+    }
+}
+
+void X11InputSessionTest::keycodesAreResolved()
+{
+    X11InputSession session;
+    QVERIFY( session.isOpen() );
+
+    QVERIFY( session.keycode( Token::KEY_a ) != 0 );
+    QVERIFY( session.keycode( Token::KEY_BACKSPACE ) != 0 );
+    QVERIFY( session.keycode( Token::MODIFIER_CTRL ) != 0 );
+    QCOMPARE( session.keycode( Token::TOKEN_NEW_SEQUENCE ), KeyCode{ 0 } );
+}
+
+void X11InputSessionTest::modifiersAreReleased()
+{
+    X11InputSession session;
+
+    // Ctrl down, a down, a up, Ctrl up.
+    session.send( toKeyEvents( { Token::MODIFIER_CTRL, Token::KEY_a } ) );
+
+    QCOMPARE( session.sentEvents(), 4ull );
+}
+
+void X11InputSessionTest::noFileDescriptorGrowth()
+{
+    X11InputSession session;
+    session.send( backspaces( 1 ) );
+
+    const auto before = openFileDescriptors();
+    for ( int i = 0; i < 1000; ++i )
+    {
+        session.send( backspaces( 1 ) );
+    }
+
+    QCOMPARE( openFileDescriptors(), before );
+}
+
+void X11InputSessionTest::keycodesFollowMappingChanges()
+{
+    X11InputSession session;
+    const auto original = session.keycode( Token::KEY_a );
+    QVERIFY( original != 0 );
+
+    Display* const other = XOpenDisplay( nullptr );
+    QVERIFY( other );
+    int keySymsPerKeycode = 0;
+    KeySym* const originalKeySyms
+        = XGetKeyboardMapping( other, original, 1, &keySymsPerKeycode );
+    KeySym f20 = XK_F20;
+    XChangeKeyboardMapping( other, original, 1, &f20, 1 );
+    XSync( other, False );
+
+    // MappingNotify is read at the start of the next send.
+    for ( int i = 0; i < 100 && session.keycode( Token::KEY_a ) == original;
+          ++i )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+        session.send( {} );
+    }
+    const auto remapped = session.keycode( Token::KEY_a );
+
+    XChangeKeyboardMapping(
+        other, original, keySymsPerKeycode, originalKeySyms, 1 );
+    XSync( other, False );
+    XFree( originalKeySyms );
+    XCloseDisplay( other );
+
+    QVERIFY( remapped != original );
+}
+
+void X11InputSessionTest::eventsPerSecond()
+{
+    constexpr int k_sends = 200;
+    X11InputSession session;
+    const auto batch = backspaces( 64 );
+    const auto sentBefore = session.sentEvents();
+
+    QElapsedTimer timer;
+    timer.start();
+    for ( int i = 0; i < k_sends; ++i )
+    {
+        session.send( batch );
+    }
+    const auto seconds = static_cast<double>( timer.nsecsElapsed() ) / 1e9;
+    const auto events = session.sentEvents() - sentBefore;
+
+    // A down and an up event per backspace.
+    QCOMPARE( events, static_cast<unsigned long long>( k_sends * 64 * 2 ) );
+    qInfo() << "Key events per second:"
+            << static_cast<double>( events ) / seconds;
+}
+
+void X11InputSessionTest::symbolsAreResolved()
+{
+    X11InputSession session;
+
+    for ( const auto token : { Token::KEY_MINUS,
+                               Token::KEY_EQUALS,
+                               Token::KEY_LEFTBRACKET,
+                               Token::KEY_RIGHTBRACKET,
+                               Token::KEY_BACKSLASH,
+                               Token::KEY_SEMICOLON,
+                               Token::KEY_APOSTROPHE,
+                               Token::KEY_COMMA,
+                               Token::KEY_PERIOD,
+                               Token::KEY_SLASH } )
+    {
+        QVERIFY( session.keycode( token ) != 0 );
+    }
+}
+
+void X11InputSessionTest::macroBatchEventsPerSecond()
+{
+    constexpr int k_sends = 200;
+    X11InputSession session;
+    // Text, repeats and an explicit hold, lowered to a single step.
+    const auto macro = parseMacro(
+        "\"Hello, World!\"{x4} {+>}abc{->} BACKSPACE{x30}" );
+    QCOMPARE( macro.size(), std::size_t{ 1 } );
+    const auto& batch = macro.front().events;
+    const auto sentBefore = session.sentEvents();
+
+    QElapsedTimer timer;
+    timer.start();
+    for ( int i = 0; i < k_sends; ++i )
+    {
+        session.send( batch );
+    }
+    const auto seconds = static_cast<double>( timer.nsecsElapsed() ) / 1e9;
+    const auto events = session.sentEvents() - sentBefore;
+
+    QCOMPARE( events,
+              static_cast<unsigned long long>( k_sends * batch.size() ) );
+    qInfo() << "Macro key events per second:"
+            << static_cast<double>( events ) / seconds;
+}
+
+QTEST_APPLESS_MAIN( X11InputSessionTest )
+
+#include "./release/tst_x11inputsessiontest.moc"
@@ -0,0 +1,28 @@
+QT += testlib
+QT -= gui
+CONFIG   += c++1z
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+# Needs an X server with the XTEST extension, for example
+# xvfb-run ./x11_input_session
+LIBS += -lX11 -lXtst
+
+INCLUDEPATH += ../../src/keyboard_input \
+    ../../third-party/easylogging++
+
+SOURCES +=  tst_x11inputsessiontest.cpp \
+    ../../src/keyboard_input/input_session_X11.cpp \
+    ../../src/keyboard_input/input_sender.cpp \
+    ../../src/keyboard_input/input_parser.cpp \
+    ../../src/keyboard_input/keyboard_macro.cpp \
+    ../../third-party/easylogging++/easylogging++.cc
+
+HEADERS += \
+    ../../src/keyboard_input/input_session_X11.h \
+    ../../src/keyboard_input/input_sender.h \
+    ../../src/keyboard_input/input_parser.h \
+    ../../src/keyboard_input/keyboard_macro.h